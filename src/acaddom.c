@@ -9,7 +9,9 @@
 #include <string.h>
 
 #include "bool.h"
+#include "damage.h"
 #include "events.h"
+#include "hud.h"
 #include "input.h"
 #include "in_vbl.h"
 #include "ikbdcode.h"
@@ -21,7 +23,9 @@
 #include "mus_vbl.h"
 #include "psg.h"
 #include "renderer.h"
-#include "super.h"
+#include "sched.h"
+#include "surface.h"
+#include "timer.h"
 #include "types.h"
 #include "vector.h"
 #include "vbl.h"
@@ -45,6 +49,31 @@
 #define NUM_TICKS_IN_TWO_SEC       140
 #define SCRN_ALIGN                 256
 
+/**
+ * @brief The most ticks that the synchronous events are run for in a single
+ * iteration of the main game loop.
+ * @details Any more ticks than this that have passed are dropped, so that the
+ * main game loop never falls further behind when it cannot keep up.
+ */
+#define MAX_SYNC_STEPS              4
+
+/**
+ * @brief The cost that may be spent on rendering after every vertical blank.
+ * @details Costs are in units of roughly the time taken to copy a byte. The
+ * rest of the frame is left for the interrupts and the synchronous events.
+ */
+#define RENDER_BUDGET           16000u
+
+#define CELL_COST               ((UINT32)(CELL_LEN / 8) * CELL_HEIGHT)
+#define HAZARD_COST               384u
+#define PLAYER_COST               384u
+#define HUD_COST                  256u
+
+/**
+ * @brief The most frames in a row that may be skipped in favour of newer ones.
+ */
+#define MAX_SKIPPED_FRAMES          2
+
 #define MAX_WIN_MSG_LEN             13
 #define YOU_WIN_MSG_IDX              0
 #define OTHER_WIN_MSG_IDX            1
@@ -53,28 +82,54 @@
 typedef enum
 {
 	PRIMARY_SCREEN_BUFFER = 0,
-	OTHER_SCREEN_BUFFER   = 1
+	OTHER_SCREEN_BUFFER   = 1,
+	THIRD_SCREEN_BUFFER   = 2
 } ScreenBufferChoice;
 
-World  gameWorld;
-BOOL   dead = FALSE;
+#define NUM_SCREEN_BUFFERS 3
 
-UINT32 timeNow         =  0;
+/**
+ * @brief How far the renderer has got with the snapshot it is rendering.
+ */
+typedef enum
+{
+	RENDER_IDLE,
+	RENDER_WORLD_ROWS,
+	RENDER_WORLD_UPDATE,
+	RENDER_FRAME,
+	RENDER_COMPOSE
+} RenderStage;
 
-/* Holds the total number of clock ticks that must be reached before handling
-synchronous events. */
-UINT32 timeDesired     =  0;
+#define NUM_SNAPSHOTS      2
+
+World  gameWorld;
+BOOL   dead = FALSE;
 
-UINT32 immunityTimer   = UINT32_MAX;
-UINT32 playerMoveTimer = UINT32_MAX;
-int    loopCounter     =  1;
 int    deathCounter    =  1;
 UINT8  gameStart       =  FALSE;
 
+/* The number of ticks that the synchronous events have been run for. */
+UINT32 syncTime        =  0;
+
+/* The tick given by the VBL clock when the synchronous events were last
+caught up with it. */
+UINT32 lastVblTime     =  0;
+
 /* The menu object is defined outside of any functions as it tends to cause
    alignment issues when placed on the stack. */
 Menu   menu;
 
+/* The timers that run the synchronous events. They are moved on once for every
+tick counted by syncTime. */
+TimerWheel syncTimers;
+
+Timer  hazardTimer;
+Timer  featherTimer;
+Timer  carTimer;
+Timer  repopulateTimer;
+Timer  immunityTimer;
+Timer  playerMoveTimer;
+
 /**
  * @brief Temporarily pauses any game-related operations.
  */
@@ -89,13 +144,14 @@ Menu   menu;
  * @brief Sets the frame buffer start address if and only if it is not already
  * set to the desired address.
  * @details It also makes sure the frame buffer has been updated by pausing
- * until the next vertical sync.
+ * until the next vertical sync. Any frame buffer still waiting to be flipped to
+ * is replaced, so that it cannot be shown afterwards.
  * @param base The desired frame buffer start address.
  */
 #define update_video_base(base) \
-	if ((UINT16 *)(base) != get_video_base()) \
+	if ((UINT16 *)(base) != get_video_base() || get_queued_base() != NULL) \
 	{ \
-		set_video_base((UINT16 *)(base)); \
+		queue_flip((UINT16 *)(base)); \
 		vert_sync(); \
 	}
 
@@ -113,32 +169,90 @@ void gameOverScreen(UINT32* const screenBuffer, BOOL* goToTitleScrn,
 					World* gameWorld, Menu* goverScrn);
 void getGoverScoreCoord(int numPlayers, int playerNum, int* x, int* y);
 void menuLoop(UINT32* const screenBuffer, Menu* menu);
-void mainGameLoop(World* gameWorld, UINT32* const screenBuffer,
-				  UINT32* const otherScreenBuffer,
+void mainGameLoop(World* gameWorld, UINT32* const screenBuffers[],
 				  UINT32* const worldScreenBuffer,
 				  BOOL* quitToTitleScrn, int* numPlayers, BOOL* dead);
-void renderGame(ScreenBufferChoice* nextScreenBuffer,
-				UINT32* const screenBuffer, 
-				UINT32* const otherScreenBuffer,
+void renderGame(UINT32* const screenBuffers[],
 				UINT32* const worldScreenBuffer, World *gameWorld);
+void publishSnapshot(const World* const gameWorld);
+World* takeSnapshot(World* gameWorld);
+void addWorldDamage(Damage* const damage, const World* const gameWorld);
+UINT32 estimateUpdateCost(const World* const gameWorld);
+UINT32 estimateComposeCost(const World* const gameWorld,
+						   const Damage* const stale);
+void composeFrame(UINT32* const base, SaveList* const saves, Hud* const hud,
+				  const Damage* const stale, UINT32* const worldScreenBuffer,
+				  World* gameWorld);
 void copyScrnBuffer(UINT8* dest, const UINT8* const src, int startRow,
 					int endRow);
-void processSync(World* gameWorld, BOOL* dead, UINT32* timeNow, 
-				 UINT32* timeDesired, UINT32* immunityTimer,
-				 UINT32* playerMoveTimer, int* loopCounter,
-				 int* deathCounter);
+void initSyncEvents(void);
+void hazardEvent(void);
+void featherEvent(void);
+void carEvent(void);
+void repopulateEvent(void);
+void immunityEvent(void);
+void playerMoveEvent(void);
+void chkPlayerHit(void);
 void processAsync(BOOL* quitToTitleScrn, World* gameWorld);
 
 void game_end(void);
 void game_start(void);
-void sync_events_vbl(void);
+void runSyncEvents(void);
 
 UINT8	otherFrameBufferMEM[SCRN_BYTES + SCRN_ALIGN];
+UINT8	thirdFrameBufferMEM[SCRN_BYTES + SCRN_ALIGN];
 UINT8	worldFrameBufferMEM[SCRN_BYTES + SCRN_ALIGN];
 
+/* The backgrounds under the inhabitants last plotted on each screen buffer,
+indexed by ScreenBufferChoice. */
+SaveList saveLists[NUM_SCREEN_BUFFERS];
+
+/* The number of frames composed since each screen buffer was last composed,
+indexed by ScreenBufferChoice. Zero if its contents are unknown. */
+int bufferAges[NUM_SCREEN_BUFFERS];
+
+/* The scores and lives last plotted on each screen buffer, indexed by
+ScreenBufferChoice. */
+Hud huds[NUM_SCREEN_BUFFERS];
+
+/* The world cells changed by each of the latest frames. */
+DamageHistory cellHistory;
+
+/* Copies of the world handed from the synchronous events to the renderer. */
+World  snapshots[NUM_SNAPSHOTS];
+
+/* The newest snapshot that the renderer has yet to take, or NULL if there is
+none. */
+World* volatile publishedSnapshot = NULL;
+
+/* The index of the snapshot last taken by the renderer, which is never written
+to while the renderer may still be reading it. */
+int    heldSnapshot = 0;
+
+/* Keeps the rendering done after every vertical blank within RENDER_BUDGET. */
+FrameSched  frameSched;
+
+/* The snapshot being rendered and how far rendering it has got. */
+World*      renderSnapshot = NULL;
+RenderStage renderStage    = RENDER_IDLE;
+int         nextWorldRow   = 0;
+
+/* The world cells changed since the last frame was composed, including those
+changed by any frames skipped since then. */
+Damage      frameDamage;
+int         skippedFrames  = 0;
+
+#ifdef GUARD_BAND
+/* The rows whose hazards cross the edge of the screen are composed here, where
+the hazards can be plotted without clipping, before being cropped back onto
+the screen buffer. It is never displayed, so it needs no alignment. */
+UINT32	compSurfaceMEM[GUARD_SURFACE_LONGS];
+Surface	compSurface;
+#endif
+
 /**
  * @brief Handles program loop.
- * @details Initializes all three frame buffers. Handles switching between the 
+ * @details Initializes all four frame buffers. Handles switching between the 
  * Title screen, game screen and Game Over screen. The player can only exit the
  * program from the Title screen. Leaving any other screen will return the
  * player to the Title screen. Only if the player has played the game and died
@@ -153,18 +267,35 @@ int main(int argc, char **argv)
 	UINT32* const screenBuffer = (UINT32 *)get_video_base();
 
 	int otherFBOffset = (SCRN_ALIGN -
-						(UINT32)(&otherFrameBufferMEM[0]) % SCRN_ALIGN);
+						(UINTPTR)(&otherFrameBufferMEM[0]) % SCRN_ALIGN);
 	UINT32* const otherScreenBuffer =
 					(UINT32 *)(&otherFrameBufferMEM[otherFBOffset]);
 
+	int thirdFBOffset = (SCRN_ALIGN -
+						(UINTPTR)(&thirdFrameBufferMEM[0]) % SCRN_ALIGN);
+	UINT32* const thirdScreenBuffer =
+					(UINT32 *)(&thirdFrameBufferMEM[thirdFBOffset]);
+
+	UINT32* screenBuffers[NUM_SCREEN_BUFFERS];
+
 	int worldFBOffset = (SCRN_ALIGN -
-						(UINT32)(&worldFrameBufferMEM[0]) % SCRN_ALIGN);
+						(UINTPTR)(&worldFrameBufferMEM[0]) % SCRN_ALIGN);
 	UINT32* const worldScreenBuffer =
 					(UINT32 *)(&worldFrameBufferMEM[worldFBOffset]);
 
 	const Vector sysVbl  = vbl_init();
 	const Vector sysKybd = initKybd();
 
+	screenBuffers[PRIMARY_SCREEN_BUFFER] = screenBuffer;
+	screenBuffers[OTHER_SCREEN_BUFFER]   = otherScreenBuffer;
+	screenBuffers[THIRD_SCREEN_BUFFER]   = thirdScreenBuffer;
+
+	initRenderer();
+
+#ifdef GUARD_BAND
+	init_guard_surface(&compSurface, compSurfaceMEM);
+#endif
+
 	reg_music_vbl();
 
 	while (!exitPgrm)
@@ -176,9 +307,8 @@ int main(int argc, char **argv)
 
 		if (!exitPgrm)
 		{
-			mainGameLoop(&gameWorld, screenBuffer, otherScreenBuffer,
-						 worldScreenBuffer, &goToTitleScrn, &numPlayers,
-						 &dead);
+			mainGameLoop(&gameWorld, screenBuffers, worldScreenBuffer,
+						 &goToTitleScrn, &numPlayers, &dead);
 
 			if (!goToTitleScrn && !isPlayerAlive(gameWorld.mainPlayer))
 			{
@@ -521,13 +651,12 @@ void menuLoop(UINT32* const screenBuffer, Menu* menu)
 }
 
 /**
- * @brief Manages the entire game including asynchronous events and rendering.
+ * @brief Manages the entire game including the synchronous and asynchronous
+ * events and rendering.
  * 
  * @param gameWorld The world object which holds all game data.
- * @param screenBuffer One of the framebuffers to plot to as part of triple
- * buffering.
- * @param otherScreenBuffer One of the framebuffers to plot to as part of triple
- * buffering.
+ * @param screenBuffers The framebuffers to plot to as part of triple buffering,
+ * indexed by ScreenBufferChoice.
  * @param worldScreenBuffer A framebuffer that holds a copy of all the cells
  * that make up the world.
  * @param quitToTitleScrn A boolean value returned by reference that governs
@@ -537,12 +666,12 @@ void menuLoop(UINT32* const screenBuffer, Menu* menu)
  * @param dead A boolean value indicating whether the player is dead (TRUE) or
  * not (FALSE).
  */
-void mainGameLoop(World* gameWorld, UINT32* const screenBuffer,
-				  UINT32* const otherScreenBuffer,
+void mainGameLoop(World* gameWorld, UINT32* const screenBuffers[],
 				  UINT32* const worldScreenBuffer,
 				  BOOL* quitToTitleScrn, int* numPlayers, BOOL* dead)
 {
-	ScreenBufferChoice nextScreenBuffer = OTHER_SCREEN_BUFFER;
+	UINT32* const screenBuffer = screenBuffers[PRIMARY_SCREEN_BUFFER];
+	int           buffer;
 
 	/* Needs to be set to an expected framebuffer; otherwise, if the current
 	framebuffer is one that is being written to, strange graphical artifacts
@@ -550,10 +679,32 @@ void mainGameLoop(World* gameWorld, UINT32* const screenBuffer,
 	update_video_base(screenBuffer);
 
 	initWorld(gameWorld, *numPlayers);
+	initSyncEvents();
 	renderPlayArea(screenBuffer, gameWorld);
-	dupScrnBuffer((UINT8 *)otherScreenBuffer, (UINT8 *)screenBuffer);
 	renderWorld(worldScreenBuffer, gameWorld);
 
+	/* The inhabitants were plotted by renderPlayArea() without saving what was
+	under them, so the first frame on each buffer redraws the play area. */
+	for (buffer = 0; buffer < NUM_SCREEN_BUFFERS; buffer++)
+	{
+		if (screenBuffers[buffer] != screenBuffer)
+		{
+			dupScrnBuffer((UINT8 *)screenBuffers[buffer],
+						  (UINT8 *)screenBuffer);
+		}
+
+		init_save_list(&saveLists[buffer], screenBuffers[buffer]);
+		initHud(&huds[buffer]);
+		bufferAges[buffer] = 0;
+	}
+	init_damage_history(&cellHistory);
+	publishedSnapshot = NULL;
+
+	init_sched(&frameSched, RENDER_BUDGET);
+	renderStage   = RENDER_IDLE;
+	skippedFrames = 0;
+	clear_damage(&frameDamage);
+
 	game_start();
 	start_music();
 	*quitToTitleScrn = FALSE;
@@ -561,11 +712,11 @@ void mainGameLoop(World* gameWorld, UINT32* const screenBuffer,
 	while (!(*quitToTitleScrn) && !(*dead))
 	{
 		processAsync(quitToTitleScrn, gameWorld);
+		runSyncEvents();
 
 		if (rend_req())
 		{
-			renderGame(&nextScreenBuffer, screenBuffer, otherScreenBuffer, 
-					   worldScreenBuffer, gameWorld);
+			renderGame(screenBuffers, worldScreenBuffer, gameWorld);
 		}
 	}
 
@@ -651,196 +802,507 @@ void processAsync(BOOL* quitToTitleScrn, World* gameWorld)
 }
 
 /**
- * @brief Handles all synchronous events related to the game.
- * 
- * @param gameWorld The world object which holds all game data.
- * @param dead A boolean value indicating whether the player is dead (TRUE) or
- * not (FALSE).
- * @param timeNow The current value given by a timer.
- * @param timeDesired The time that is desired before most of the synchronous
- * events occur.
- * @param immunityTimer The time that is desired before ending player damage
- * immunity.
- * @param playerMoveTimer The time that is desired before moving a player after
- * a movement request has been accepted.
- * @param loopCounter Keeps track of the number of iterations so that events
- * can occur at the proper times.
- * @param deathCounter The time that is desired before officially declaring a
- * player dead (as opposed to the process of dying).
- */
-void processSync(World* gameWorld, BOOL* dead, UINT32* timeNow, 
-				 UINT32* timeDesired, UINT32* immunityTimer,
-				 UINT32* playerMoveTimer, int* loopCounter,
-				 int* deathCounter)
+ * @brief Readies the timers that run the synchronous events for a new game.
+ * @details The hazards are moved every MIN_NUM_TICKS ticks. The feathers, the
+ * cars and the repopulation of the world each happen on a different one of
+ * every MIN_NUM_TICKS_IN_SEC of those moves.
+ */
+void initSyncEvents(void)
 {
-	*timeNow = get_time();
+	const UINT32 SEC_TICKS = (UINT32)MIN_NUM_TICKS * MIN_NUM_TICKS_IN_SEC;
+
+	syncTime     = 0;
+	deathCounter = 1;
+	init_timer_wheel(&syncTimers, syncTime);
+
+	init_timer(&hazardTimer, hazardEvent);
+	init_timer(&featherTimer, featherEvent);
+	init_timer(&carTimer, carEvent);
+	init_timer(&repopulateTimer, repopulateEvent);
+	init_timer(&immunityTimer, immunityEvent);
+	init_timer(&playerMoveTimer, playerMoveEvent);
+
+	start_timer(&syncTimers, &hazardTimer, MIN_NUM_TICKS, MIN_NUM_TICKS);
+	start_timer(&syncTimers, &featherTimer,
+				(UINT32)MIN_NUM_TICKS * MIN_NUM_TICKS_IN_0_6_SEC, SEC_TICKS);
+	start_timer(&syncTimers, &carTimer,
+				(UINT32)MIN_NUM_TICKS * MIN_NUM_TICKS_IN_0_8_SEC, SEC_TICKS);
+	start_timer(&syncTimers, &repopulateTimer, SEC_TICKS, SEC_TICKS);
+}
 
-	if (*timeNow > *immunityTimer)
+/**
+ * @brief Moves the train and lets the main player move again, or carries on
+ * with the death of the main player.
+ * @details Once the main player has been dying for long enough, the player is
+ * declared dead.
+ */
+void hazardEvent(void)
+{
+	if (isPlayerAlive(gameWorld.mainPlayer))
 	{
-		toggleImmunity(gameWorld->mainPlayer);
-		*immunityTimer = UINT32_MAX;
-	}
+		updateTrain(&gameWorld);
+		chkPlayerHit();
 
-	if (*timeNow > *playerMoveTimer)
-	{
-		if (movePlayer(gameWorld, &gameWorld->mainPlayer))
+		if (playerMayMove(&gameWorld.mainPlayer) &&
+			!timer_pending(&playerMoveTimer))
 		{
-			if (handleHazardCollision(gameWorld, &gameWorld->mainPlayer) >= 0)
-			{
-				*immunityTimer = get_time() + NUM_TICKS_IN_TWO_SEC;
-			}
-
-			handleCollectableCollision(gameWorld, &gameWorld->mainPlayer);
-
-			*playerMoveTimer = UINT32_MAX;
+			start_timer(&syncTimers, &playerMoveTimer, NUM_TICKS_IN_0_5_SEC, 0);
 		}
 	}
-
-	if (*timeNow >= *timeDesired)
+	else
 	{
-		if (isPlayerAlive(gameWorld->mainPlayer))
+		if (deathCounter > MIN_NUM_TICKS_IN_0_6_SEC)
 		{
-			updateTrain(gameWorld);
-
-			if (*loopCounter == MIN_NUM_TICKS_IN_0_6_SEC)
-			{
-				updateFeathers(gameWorld);
-			}
-
-			if (*loopCounter == MIN_NUM_TICKS_IN_0_8_SEC)
-			{
-				updateCar(gameWorld);
-			}
-
-			if (*loopCounter == MIN_NUM_TICKS_IN_SEC)
-			{
-				repopulateWorld(gameWorld);
-			}
-
-			if (handleHazardCollision(gameWorld, &gameWorld->mainPlayer) >= 0)
-			{
-				*immunityTimer = get_time() + NUM_TICKS_IN_TWO_SEC;
-			}
-
-			if (playerMayMove(&gameWorld->mainPlayer) &&
-				*playerMoveTimer == UINT32_MAX)
-			{
-				*playerMoveTimer = get_time() + NUM_TICKS_IN_0_5_SEC;
-			}
+			dead = TRUE;
+			stop_timer(&immunityTimer);
+			deathCounter = 1;
 		}
 		else
 		{
-			if (*deathCounter > MIN_NUM_TICKS_IN_0_6_SEC)
-			{
-				*dead = TRUE;
-				*immunityTimer = UINT32_MAX;
-				*deathCounter = 1;
-			}
-			else
-			{
-				handleDeath();
-				(*deathCounter)++;
-			}
+			handleDeath();
+			deathCounter++;
 		}
+	}
+}
 
-		if (*loopCounter >= MIN_NUM_TICKS_IN_SEC)
-		{
-			*loopCounter = 1;
-		}
-		else
-		{
-			(*loopCounter)++;
-		}
+/**
+ * @brief Moves the feathers while the main player is alive.
+ */
+void featherEvent(void)
+{
+	if (isPlayerAlive(gameWorld.mainPlayer))
+	{
+		updateFeathers(&gameWorld);
+		chkPlayerHit();
+	}
+}
+
+/**
+ * @brief Moves the cars while the main player is alive.
+ */
+void carEvent(void)
+{
+	if (isPlayerAlive(gameWorld.mainPlayer))
+	{
+		updateCar(&gameWorld);
+		chkPlayerHit();
+	}
+}
+
+/**
+ * @brief Adds new hazards to the world while the main player is alive.
+ */
+void repopulateEvent(void)
+{
+	if (isPlayerAlive(gameWorld.mainPlayer))
+	{
+		repopulateWorld(&gameWorld);
+		chkPlayerHit();
+	}
+}
+
+/**
+ * @brief Ends the damage immunity of the main player.
+ */
+void immunityEvent(void)
+{
+	toggleImmunity(gameWorld.mainPlayer);
+}
 
-		*timeDesired = get_time() + MIN_NUM_TICKS;
+/**
+ * @brief Moves the main player once a movement request has been accepted.
+ * @details If the move is cancelled, it is tried again on the next tick.
+ */
+void playerMoveEvent(void)
+{
+	if (movePlayer(&gameWorld, &gameWorld.mainPlayer))
+	{
+		chkPlayerHit();
+		handleCollectableCollision(&gameWorld, &gameWorld.mainPlayer);
+	}
+	else
+	{
+		start_timer(&syncTimers, &playerMoveTimer, 1, 0);
 	}
 }
 
 /**
- * @brief Handles the rendering of the game onto alternating screen buffers.
+ * @brief Handles the main player being hit by a hazard, which makes the player
+ * immune to damage for a while.
+ */
+void chkPlayerHit(void)
+{
+	if (handleHazardCollision(&gameWorld, &gameWorld.mainPlayer) >= 0)
+	{
+		start_timer(&syncTimers, &immunityTimer, NUM_TICKS_IN_TWO_SEC, 0);
+	}
+}
+
+/**
+ * @brief Handles the rendering of the game onto rotating screen buffers.
+ * @details Renders as much as fits in RENDER_BUDGET of the snapshots of the
+ * world published by the synchronous events since the last frame. Rendering a
+ * snapshot is split into jobs whose cost is estimated before they are started,
+ * and a job that does not fit is left for the next call. Drawing every cell of
+ * the world again is done a row at a time, so that it can be spread over
+ * several calls. Since it is all done to the world cells buffer, which is
+ * never shown, nothing is flipped to until the frame is complete. At most one
+ * frame is composed per call.
+ * 
+ * If a newer snapshot has been published by the time the world cells are up
+ * to date, the frame is skipped in favour of the newer one (up to
+ * MAX_SKIPPED_FRAMES in a row). The cells it changed are kept, so that they
+ * are copied with the next frame that is composed.
  * 
- * @param nextScreenBuffer The screen buffer that should be utilized on screen.
- * @param screenBuffer One of the framebuffers to plot to as part of triple
- * buffering.
- * @param otherScreenBuffer One of the framebuffers to plot to as part of triple
- * buffering.
+ * The frames are rendered from the snapshots with interrupts enabled, since the
+ * synchronous events never write to a snapshot that has been taken by the
+ * renderer. The screen buffers are never copied between. Instead, each one is
+ * brought up to date with the world cells changed since it was last composed,
+ * which are found from its age and the history of changed cells.
+ * 
+ * Each frame is composed on the screen buffer that is neither being shown nor
+ * waiting to be shown, and is then queued to be flipped to at the next vertical
+ * blank instead of waiting for it. That way the next frame can be composed
+ * while this one is still being shown. If a frame is still waiting when the
+ * next one is queued, it is skipped in favour of the newer one.
+ * 
+ * @param screenBuffers The framebuffers to plot to as part of triple buffering,
+ * indexed by ScreenBufferChoice.
  * @param worldScreenBuffer A framebuffer that holds a copy of all the cells
  * that make up the world.
  * @param gameWorld The world object which holds all game data.
  */
-void renderGame(ScreenBufferChoice* nextScreenBuffer,
-				UINT32* const screenBuffer, 
-				UINT32* const otherScreenBuffer,
+void renderGame(UINT32* const screenBuffers[],
 				UINT32* const worldScreenBuffer, World *gameWorld)
 {
-	const BOOL IS_SUPER = isSu();
+	UINT16* queuedBuffer;
+	UINT16* shownBuffer;
+	UINT32 cost;
+	BOOL   sliceOver = FALSE;
+	int    buffer;
+	int    backBuffer;
+	Damage stale;
+	BOOL   staleKnown;
+
+	begin_slice(&frameSched);
+
+	while (!sliceOver)
+	{
+		switch (renderStage)
+		{
+			case RENDER_IDLE:
+				renderSnapshot = takeSnapshot(gameWorld);
 
-	UINT32 oldSsp;
-	int    oldIpl;
-	BOOL   RENDER_CELLS;
-	BOOL   COPY_CELLS;
-	
-	if (!IS_SUPER) oldSsp = Su(0);
-	oldIpl = set_ipl(MASK_ALL_INTERRUPTS);
-	if (!IS_SUPER) Su(oldSsp);
+				if (renderSnapshot == NULL)
+				{
+					sliceOver = TRUE;
+				}
+				else
+				{
+					addWorldDamage(&frameDamage, renderSnapshot);
+					nextWorldRow = 0;
+					renderStage  = (worldRedrawNeeded(renderSnapshot) ?
+									RENDER_WORLD_ROWS : RENDER_WORLD_UPDATE);
+				}
+				break;
 
-	RENDER_CELLS = gameWorld->renderCells;
-	COPY_CELLS   = gameWorld->copyCells;
+			case RENDER_WORLD_ROWS:
+				cost = (UINT32)ROW_STRIP_BYTES +
+					   (nextWorldRow == 0 ? SCRN_BYTES : 0);
 
-	if (RENDER_CELLS)
-	{
-		renderUpdateWorld(worldScreenBuffer, gameWorld);
-	}
+				if (fits_slice(&frameSched, cost))
+				{
+					nextWorldRow = renderWorldRows(worldScreenBuffer,
+												   renderSnapshot,
+												   nextWorldRow, 1);
+					spend_slice(&frameSched, cost);
+
+					if (nextWorldRow >= renderSnapshot->usableRows)
+					{
+						renderStage = RENDER_FRAME;
+					}
+				}
+				else
+				{
+					sliceOver = TRUE;
+				}
+				break;
 
-	if (*nextScreenBuffer == PRIMARY_SCREEN_BUFFER)
-	{
-		if (COPY_CELLS || RENDER_CELLS)
-		{
-			copyScrnBuffer((UINT8 *)screenBuffer, (UINT8 *)worldScreenBuffer,
-						   getTopBorderHeight(gameWorld->numPlayers),
-						   BOTTOM_BORDER - 1);
-			renderUpdate((UINT32 *)screenBuffer, gameWorld);
+			case RENDER_WORLD_UPDATE:
+				cost = estimateUpdateCost(renderSnapshot);
+
+				if (fits_slice(&frameSched, cost))
+				{
+					if (cellsChanged(renderSnapshot))
+					{
+						renderUpdateWorld(worldScreenBuffer, renderSnapshot);
+					}
+
+					spend_slice(&frameSched, cost);
+					renderStage = RENDER_FRAME;
+				}
+				else
+				{
+					sliceOver = TRUE;
+				}
+				break;
+
+			case RENDER_FRAME:
+				if (publishedSnapshot != NULL &&
+					skippedFrames < MAX_SKIPPED_FRAMES)
+				{
+					skippedFrames++;
+					renderStage = RENDER_IDLE;
+				}
+				else
+				{
+					push_damage(&cellHistory, &frameDamage);
+					clear_damage(&frameDamage);
+					skippedFrames = 0;
+					renderStage   = RENDER_COMPOSE;
+				}
+				break;
+
+			case RENDER_COMPOSE:
+				/* With three buffers, at least one is neither shown nor
+				   queued. */
+				queuedBuffer = get_queued_base();
+				shownBuffer  = get_video_base();
+				backBuffer   = PRIMARY_SCREEN_BUFFER;
+				while ((UINT16 *)screenBuffers[backBuffer] == queuedBuffer ||
+					   (UINT16 *)screenBuffers[backBuffer] == shownBuffer)
+				{
+					backBuffer++;
+				}
+
+				staleKnown = damage_since(&cellHistory, bufferAges[backBuffer],
+										  &stale);
+				cost = estimateComposeCost(renderSnapshot,
+										   staleKnown ? &stale : NULL);
+
+				if (fits_slice(&frameSched, cost))
+				{
+					composeFrame(screenBuffers[backBuffer],
+								 &saveLists[backBuffer], &huds[backBuffer],
+								 staleKnown ? &stale : NULL, worldScreenBuffer,
+								 renderSnapshot);
+					spend_slice(&frameSched, cost);
+
+					/* Stops counting once a buffer is too old to be brought up
+					   to date. */
+					for (buffer = 0; buffer < NUM_SCREEN_BUFFERS; buffer++)
+					{
+						if (bufferAges[buffer] > 0 &&
+							bufferAges[buffer] <= MAX_DAMAGE_AGE)
+						{
+							bufferAges[buffer]++;
+						}
+					}
+					bufferAges[backBuffer] = 1;
+
+					queue_flip((UINT16 *)screenBuffers[backBuffer]);
+					renderStage = RENDER_IDLE;
+				}
+
+				sliceOver = TRUE;
+				break;
 		}
+	}
+}
+
+/**
+ * @brief Adds the world cells changed in the given world to a Damage.
+ * 
+ * @param damage The Damage to add to.
+ * @param gameWorld The world object which holds all game data.
+ */
+void addWorldDamage(Damage* const damage, const World* const gameWorld)
+{
+	const int TOP_ROW = getTopBorderHeight(gameWorld->numPlayers);
+
+	const CellRef* staleCell;
+	const Row*     staleRow;
+	int            cell;
 
-		set_video_base((UINT16 *)screenBuffer);
-		*nextScreenBuffer = OTHER_SCREEN_BUFFER;
+	if (gameWorld->renderCells || gameWorld->pendingShifts > 0)
+	{
+		add_damage(damage, 0, SCRN_LEN, TOP_ROW, BOTTOM_BORDER - TOP_ROW);
 	}
-	else if (*nextScreenBuffer == OTHER_SCREEN_BUFFER)
+	else
 	{
-		if (COPY_CELLS || RENDER_CELLS)
+		for (cell = 0; cell < gameWorld->numStaleCells; cell++)
 		{
-			copyScrnBuffer((UINT8 *)otherScreenBuffer,
-						   (UINT8 *)worldScreenBuffer,
-						   getTopBorderHeight(gameWorld->numPlayers),
-						   BOTTOM_BORDER - 1);
-			renderUpdate((UINT32 *)otherScreenBuffer, gameWorld);
+			staleCell = &gameWorld->staleCells[cell];
+			staleRow  = &gameWorld->rows[staleCell->row];
+			add_damage(damage, staleRow->cells[staleCell->column].x,
+					   CELL_LEN, staleRow->y, CELL_HEIGHT);
 		}
+	}
+}
+
+/**
+ * @brief Estimates the cost of bringing the world cells buffer up to date with
+ * the given world, when not every cell has to be drawn again.
+ * 
+ * @param gameWorld The world object which holds all game data.
+ * @return The estimated cost (see RENDER_BUDGET).
+ */
+UINT32 estimateUpdateCost(const World* const gameWorld)
+{
+	const int TOP_ROW = getTopBorderHeight(gameWorld->numPlayers);
 
-		set_video_base((UINT16 *)otherScreenBuffer);
-		*nextScreenBuffer = PRIMARY_SCREEN_BUFFER;
+	UINT32 cost = gameWorld->numStaleCells * CELL_COST;
+
+	if (gameWorld->pendingShifts > 0)
+	{
+		cost += (UINT32)(BOTTOM_BORDER - TOP_ROW) * SCRN_LEN_BYTES +
+				(UINT32)gameWorld->pendingShifts * ROW_STRIP_BYTES;
 	}
 
-	if (COPY_CELLS || RENDER_CELLS)
+	return cost;
+}
+
+/**
+ * @brief Estimates the cost of composing a frame of the given world.
+ * 
+ * @param gameWorld The world object which holds all game data.
+ * @param stale The world cells that have changed since the frame buffer was
+ * last composed, or NULL if they are unknown.
+ * @return The estimated cost (see RENDER_BUDGET).
+ */
+UINT32 estimateComposeCost(const World* const gameWorld,
+						   const Damage* const stale)
+{
+	const int    TOP_ROW    = getTopBorderHeight(gameWorld->numPlayers);
+	const UINT32 PLAY_BYTES = (UINT32)(BOTTOM_BORDER - TOP_ROW) *
+							  SCRN_LEN_BYTES;
+
+	UINT32 cost = PLAYER_COST + HUD_COST;
+	int    row;
+
+	cost += (stale == NULL ? PLAY_BYTES : count_damaged(stale) * CELL_COST);
+
+	for (row = 0; row < gameWorld->usableRows; row++)
 	{
-		if (*nextScreenBuffer == PRIMARY_SCREEN_BUFFER)
-		{
-			copyScrnBuffer((UINT8 *)screenBuffer, (UINT8 *)otherScreenBuffer, 0,
-						   SCRN_MAX_Y);
-		}
-		else
+		cost += gameWorld->rows[row].hazardCount * HAZARD_COST;
+
+#ifdef GUARD_BAND
+		/* The band is loaded onto the surface and presented back. */
+		if (hazardsCrossEdge(&gameWorld->rows[row]))
 		{
-			copyScrnBuffer((UINT8 *)otherScreenBuffer, (UINT8 *)screenBuffer, 0,
-						   SCRN_MAX_Y);
+			cost += 2 * (UINT32)ROW_STRIP_BYTES;
 		}
+#endif
+	}
 
-		gameWorld->copyCells   = FALSE;
-		gameWorld->renderCells = FALSE;
+	return cost;
+}
+
+/**
+ * @brief Hands a copy of the world over to the renderer.
+ * @details The copy is made in the snapshot that the renderer is not holding,
+ * replacing any snapshot that the renderer has yet to take. Since the changes
+ * recorded in the world are only forgotten once the renderer takes a snapshot,
+ * a replaced snapshot never loses any of them.
+ * 
+ * Must be called after every change to something that needs to be rendered,
+ * and must not be interrupted by takeSnapshot().
+ * 
+ * @param gameWorld The world object which holds all game data.
+ */
+void publishSnapshot(const World* const gameWorld)
+{
+	World* const snapshot = &snapshots[NUM_SNAPSHOTS - 1 - heldSnapshot];
+
+	*snapshot         = *gameWorld;
+	publishedSnapshot = snapshot;
+}
+
+/**
+ * @brief Takes the newest snapshot of the world for the renderer.
+ * @details The changes recorded in the world are forgotten, as the snapshot
+ * holds all of them. Only this hand-over is done with interrupts masked.
+ * 
+ * @param gameWorld The world object which holds all game data.
+ * @return The snapshot to render from; NULL if none has been published since
+ * the last one was taken.
+ */
+World* takeSnapshot(World* gameWorld)
+{
+	World* snapshot;
+	int    oldIpl;
+
+	oldIpl = set_ipl(MASK_ALL_INTERRUPTS);
+
+	snapshot = publishedSnapshot;
+
+	if (snapshot != NULL)
+	{
+		publishedSnapshot = NULL;
+		heldSnapshot      = snapshot - snapshots;
+
+		gameWorld->copyCells     = FALSE;
+		gameWorld->renderCells   = FALSE;
+		gameWorld->pendingShifts = 0;
+		gameWorld->numStaleCells = 0;
 	}
 
-	if (!IS_SUPER) oldSsp = Su(0);
 	set_ipl(oldIpl);
-	if (!IS_SUPER) Su(oldSsp);
-	vert_sync();
+
+	return snapshot;
+}
+
+/**
+ * @brief Composes the play area of a frame from the world cells and all the
+ * inhabitants of the world.
+ * @details The inhabitants plotted on the frame buffer last time are erased by
+ * restoring the backgrounds saved under them, and only the world cells that
+ * have changed since then are copied from the world cells. The whole play area
+ * is copied when the frame buffer is too old or not every background could be
+ * saved.
+ * 
+ * The scores and lives are brought up to date with the Hud of the frame
+ * buffer, which only plots the digits that have changed.
+ * 
+ * When built with GUARD_BAND defined, the rows with a hazard that crosses the
+ * edge of the screen are instead composed on a guard-banded surface, so that
+ * their hazards need no clipping, and cropped back onto the frame (see
+ * renderBandedUpdate()).
+ * 
+ * @param base The frame buffer to compose the frame on.
+ * @param saves The SaveList of the frame buffer.
+ * @param hud The Hud of the frame buffer.
+ * @param stale The world cells that have changed since the frame buffer was
+ * last composed, or NULL if they are unknown.
+ * @param worldScreenBuffer A framebuffer that holds a copy of all the cells
+ * that make up the world.
+ * @param gameWorld The world object which holds all game data.
+ */
+void composeFrame(UINT32* const base, SaveList* const saves, Hud* const hud,
+				  const Damage* const stale, UINT32* const worldScreenBuffer,
+				  World* gameWorld)
+{
+	const int TOP_ROW = getTopBorderHeight(gameWorld->numPlayers);
+
+	if (stale == NULL || !restore_saves(saves))
+	{
+		init_save_list(saves, base);
+		copyScrnBuffer((UINT8 *)base, (UINT8 *)worldScreenBuffer, TOP_ROW,
+					   BOTTOM_BORDER - 1);
+	}
+	else
+	{
+		copy_damaged(base, worldScreenBuffer, stale);
+	}
+
+	saveUpdate(saves, gameWorld);
+#ifdef GUARD_BAND
+	renderBandedUpdate(base, &compSurface, gameWorld);
+#else
+	renderUpdate(base, gameWorld);
+#endif
+
+	renderHud(base, hud, gameWorld);
 }
 
 /**
@@ -867,49 +1329,58 @@ void copyScrnBuffer(UINT8* dest, const UINT8* const src, int startRow,
  */
 void game_end(void)
 {
-	int    oldIpl;
-
-	oldIpl = set_ipl(MASK_ALL_INTERRUPTS);
+	gameStart = FALSE;
+}
 
-	if (gameStart)
+/**
+ * @brief Sets the appropriate values for the start of a game.
+ * @details The synchronous events carry on from the current tick, so that the
+ * ticks that passed while the game was stopped are never run.
+ */
+void game_start(void)
+{
+	if (!gameStart)
 	{
-		vbl_unregister(sync_events_vbl);
-		gameStart = FALSE;
+		lastVblTime = get_time();
+		gameStart   = TRUE;
 	}
-	set_ipl(oldIpl);
 }
 
 /**
- * @brief Sets the appropriate values for the start of a game.
+ * @brief Runs the synchronous events for every tick that has passed since they
+ * were last run.
+ * @details The VBL ISR only counts the ticks, so that as little time as
+ * possible is spent at interrupt level. The synchronous events are run once
+ * per tick from the main game loop instead, by moving their timers on, up to
+ * MAX_SYNC_STEPS ticks at a time. A snapshot of the world is published for the
+ * renderer whenever something that needs to be rendered has changed.
  */
-void game_start(void)
+void runSyncEvents(void)
 {
-	int    oldIpl;
+	const UINT32 TIME = get_time();
 
-	oldIpl = set_ipl(MASK_ALL_INTERRUPTS);
+	UINT32 ticks;
 
-	if (!gameStart)
+	if (gameStart && TIME > lastVblTime)
 	{
-		vbl_register(sync_events_vbl);
+		ticks       = TIME - lastVblTime;
+		lastVblTime = TIME;
 
-		/* Only adjust the time desired if and only if it hasn't already been
-		assigned a non-zero value. This allows games that have been stopped to be
-		resumed without any ill effect. */
-		if (timeDesired == 0)
+		if (ticks > MAX_SYNC_STEPS)
 		{
-			timeDesired = get_time() + MIN_NUM_TICKS;
+			ticks = MAX_SYNC_STEPS;
 		}
-		gameStart = TRUE;
 
-		set_ipl(oldIpl);
-	}
-}
+		while (ticks > 0 && !dead)
+		{
+			advance_timers(&syncTimers, ++syncTime);
 
-/**
- * @brief The function that handles synchronous events within the VBL ISR.
- */
-void sync_events_vbl(void)
-{
-	processSync(&gameWorld, &dead, &timeNow, &timeDesired, &immunityTimer,
-				&playerMoveTimer, &loopCounter, &deathCounter);
+			if (gameWorld.copyCells || cellsChanged(&gameWorld))
+			{
+				publishSnapshot(&gameWorld);
+			}
+
+			ticks--;
+		}
+	}
 }
\ No newline at end of file
@@ -10,10 +10,20 @@
 #include <string.h>
 
 #include "bitmaps.h"
+#include "bool.h"
+#include "raster.h"
 
-int titleCurrPart = 0;
-int goverCurrPart = 0;
 int trainCurrPart = 0;
+int trainMaskedCurrPart = 0;
+
+BOOL   maskedBuilt = FALSE;
+UINT32 carMaskedBitmap[NUM_HORZ_ORIENTATIONS][CAR_HEIGHT * MASKED_ROW_LONGS];
+UINT32 playerMaskedBitmap[NUM_ORIENTATIONS][PLAYER_HEIGHT * MASKED_ROW_LONGS];
+UINT32 trainMaskedBitmap[NUM_TRAIN_PARTS][TRAIN_HEIGHT * MASKED_ROW_LONGS];
+
+void buildMaskedBitmaps(void);
+void fillMasked(UINT32 *masked, const UINT32 *image, int height,
+				UINT32 clrMask, int clrY, int clrHeight);
 
 /**
  * @brief Sets the index parameter to the index corresponding to the provided
@@ -157,203 +167,241 @@ const UINT32 feathersBitmap[NUM_HORZ_ORIENTATIONS][FEATHERS_HEIGHT] =
 	}
 };
 
-const UINT32 gameOverBitmap[NUM_GAME_OVER_PARTS][GAME_OVER_HEIGHT] =
+const UINT16 gameOverRle[] =
 {
-	{
-		0x00000007u, 0x000000FFu, 0x000007FFu, 0x00001FFFu, 0x00007FFFu, 0x0001FFFFu,
-		0x0003FFFFu, 0x000FFFFFu, 0x001FFFFFu, 0x003FFFFFu, 0x007FFFFFu, 0x00FFFFFCu,
-		0x01FFFF80u, 0x01FFFE00u, 0x03FFF800u, 0x07FFF000u, 0x0FFFC000u, 0x0FFF8000u,
-		0x1FFF0000u, 0x1FFF0000u, 0x3FFE0000u, 0x3FFC0000u, 0x3FFC0000u, 0x7FF80000u,
-		0x7FF00000u, 0x7FF00000u, 0xFFF00000u, 0xFFF00000u, 0xFFE0001Fu, 0xFFE0007Fu,
-		0xFFE0007Fu, 0xFFE000FFu, 0xFFE000FFu, 0xFFE000FFu, 0xFFE000FFu, 0xFFE000FFu,
-		0xFFE0007Fu, 0xFFE0003Fu, 0xFFE0001Fu, 0xFFF0000Fu, 0x7FF00007u, 0x7FF00003u,
-		0x7FF80001u, 0x7FF80000u, 0x3FFC0000u, 0x3FFC0000u, 0x1FFE0000u, 0x1FFF0000u,
-		0x0FFF8000u, 0x0FFFC000u, 0x07FFE000u, 0x07FFF000u, 0x03FFFC00u, 0x01FFFF00u,
-		0x00FFFFE0u, 0x007FFFFFu, 0x007FFFFFu, 0x001FFFFFu, 0x000FFFFFu, 0x0007FFFFu,
-		0x0003FFFFu, 0x0000FFFFu, 0x00003FFFu, 0x00000FFFu, 0x000003FFu, 0x0000003Fu
-	},
-	{
-		0xE0000000u, 0xFF800000u, 0xFFF00000u, 0xFFFE0000u, 0xFFFF8000u, 0xFFFFC000u,
-		0xFFFFF000u, 0xFFFFF800u, 0xFFFFFC00u, 0xFFFFFE00u, 0xFFFFFF00u, 0x0FFFFF00u,
-		0x00FFFF00u, 0x003FFF00u, 0x000FFF00u, 0x0007FE00u, 0x0001FC00u, 0x0000F800u,
-		0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0xFFFFFFFCu, 0xFFFFFFFEu,
-		0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
-		0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFF007FFu, 0xFFF807FFu, 0xFFF80FFFu,
-		0xFFFC0FFEu, 0xFFFE1FFEu, 0x7FFF1FFEu, 0x3FFFBFFCu, 0x1FFFFFFCu, 0x0FFFFFF8u,
-		0x07FFFFF8u, 0x03FFFFF0u, 0x01FFFFF0u, 0x00FFFFE0u, 0x007FFFE0u, 0x007FFFC0u,
-		0x03FFFFC0u, 0xFFFFFFF0u, 0xFFFFFFF8u, 0xFFFFFFFCu, 0xFFFFFFFCu, 0xFFFFFFFFu,
-		0xFFFFFFFFu, 0xFFFFBFFFu, 0xFFFE1FFEu, 0xFFF80FFCu, 0xFFE003F8u, 0xFE0001F0u
-	},
-	{
-		0x00000000u, 0x00000003u, 0x00000007u, 0x0000000Fu, 0x0000000Fu, 0x0000001Fu,
-		0x0000001Fu, 0x0000003Fu, 0x0000003Fu, 0x0000007Fu, 0x0000007Fu, 0x000000FFu,
-		0x000000FFu, 0x000001FFu, 0x000001FFu, 0x000003FFu, 0x000007FFu, 0x000007FFu,
-		0x00000FFFu, 0x00000FFFu, 0x00001FFFu, 0x00001FFEu, 0x00003FFEu, 0x00003FFCu,
-		0x00007FFCu, 0x00007FF8u, 0x0000FFF8u, 0x0000FFF0u, 0x0001FFF0u, 0x0001FFE0u,
-		0x0003FFE0u, 0x0003FFC0u, 0x8007FFC0u, 0x8007FF80u, 0x800FFF00u, 0x800FFF00u,
-		0x001FFF00u, 0x003FFF00u, 0x003FFF80u, 0x007FFFC0u, 0x007FFFC0u, 0x00FFFFE0u,
-		0x00FFFFF0u, 0x01FFFFF8u, 0x01FFFFF8u, 0x03FFFFFCu, 0x03FFFFFEu, 0x07FFFFFEu,
-		0x07FF9FFFu, 0x0FFF9FFFu, 0x0FFF0FFFu, 0x1FFF07FFu, 0x1FFE07FFu, 0x3FFC03FFu,
-		0x3FFC01FFu, 0x7FF801FFu, 0xFFF800FFu, 0xFFF0007Fu, 0xFFF0007Fu, 0xFFE0003Fu,
-		0xFFE0001Fu, 0xFFC0001Fu, 0xFFC0000Fu, 0xFF800007u, 0x7F000003u, 0x1C000001u
-	},
-	{
-		0x00000000u, 0xF0000000u, 0xF8000000u, 0xFC000000u, 0xFE000000u, 0xFE000000u,
-		0xFF000000u, 0xFF000000u, 0xFF800000u, 0xFF800000u, 0xFFC00000u, 0xFFC00000u,
-		0xFFE00000u, 0xFFE00000u, 0xFFF00000u, 0xFFF00000u, 0xFFF80000u, 0xFFF80000u,
-		0xFFFC0000u, 0x3FFE0000u, 0x1FFE0000u, 0x1FFF0000u, 0x0FFF0000u, 0x0FFF8000u,
-		0x07FF8000u, 0x07FFC000u, 0x03FFC000u, 0x03FFE000u, 0x01FFE000u, 0x01FFF000u,
-		0x00FFF000u, 0x00FFF800u, 0x007FF800u, 0x007FFC00u, 0x003FFC00u, 0x001FFE00u,
-		0x001FFF00u, 0x003FFF00u, 0x007FFF80u, 0x007FFF80u, 0x00FFFFC0u, 0x01FFFFC0u,
-		0x01FFFFE0u, 0x03FFFFE0u, 0x07FFFFF0u, 0x07FFFFF0u, 0x0FFFFFF8u, 0x1FFFFFF8u,
-		0x1FFF7FFCu, 0xBFFE3FFCu, 0xFFFE3FFEu, 0xFFFC1FFEu, 0xFFF80FFFu, 0xFFF80FFFu,
-		0xFFF007FFu, 0xFFE007FFu, 0xFFE003FFu, 0xFFC003FFu, 0xFF8001FFu, 0xFF8001FFu,
-		0xFF0000FFu, 0xFE0000FFu, 0xFE00007Fu, 0xFC00007Fu, 0xF800003Fu, 0xE000000Fu
-	},
-	{
-		0x03800000u, 0x0FE00000u, 0x1FF00000u, 0x1FFC0000u, 0x3FFE0000u, 0x3FFF0000u,
-		0x3FFF8000u, 0x3FFFC000u, 0x3FFFE000u, 0x3FFFF800u, 0x3FFFFC00u, 0x3FFFFE00u,
-		0x3FFFFF00u, 0x3FFFFF80u, 0x3FFFFFE0u, 0x3FFFFFF0u, 0x3FFFFFF8u, 0x3FFFFFFFu,
-		0x3FFBFFFFu, 0x3FF9FFFFu, 0x3FF87FFFu, 0x3FF83FFFu, 0x3FF81FFFu, 0x3FF80FFFu,
-		0x3FF807FFu, 0x3FF807FFu, 0x3FF80FFFu, 0x3FF81FFFu, 0x3FF83FFFu, 0x3FF8FFFFu,
-		0x3FF9FFFFu, 0x3FFFFFFFu, 0x3FFFFFFDu, 0x3FFFFFF8u, 0x3FFFFFE0u, 0x3FFFFFC0u,
-		0x3FFFFF80u, 0x3FFFFF00u, 0x3FFFFE00u, 0x3FFFFC00u, 0x3FFFF000u, 0x3FFFE000u,
-		0x3FFFC000u, 0x3FFF8000u, 0x3FFF0000u, 0x3FFC0000u, 0x3FF80000u, 0x3FF80000u,
-		0x3FF80000u, 0x3FF80000u, 0x3FF80000u, 0x3FF80000u, 0x3FF80000u, 0xBFF80000u,
-		0xBFF80000u, 0xFFF80000u, 0xFFF80000u, 0xFFF80000u, 0xFFF80000u, 0xFFF80000u,
-		0xFFF80000u, 0xFFF80000u, 0xFFF80000u, 0xCFF00000u, 0xC7E00000u, 0x01800000u
-	},
-	{
-		0x00000C00u, 0x00007F00u, 0x0000FF80u, 0x0001FFC0u, 0x0003FFC0u, 0x0007FFC1u,
-		0x001FFFC1u, 0x003FFFC1u, 0x007FFFC1u, 0x00FFFFC1u, 0x01FFFFC1u, 0x03FFFFC1u,
-		0x0FFFFFC1u, 0x1FFFFFC1u, 0x3FFFFFC1u, 0x7FFFFFC1u, 0xFFFFFFC1u, 0xFFFFFFC1u,
-		0xFFFDFFC1u, 0xFFF9FFC1u, 0xFFF1FFC1u, 0xFFE1FFC1u, 0xFFC1FFC1u, 0xFF01FFC1u,
-		0xFE01FFC1u, 0xFF01FFC1u, 0xFF81FFC1u, 0xFFC1FFC1u, 0xFFE1FFC1u, 0xFFF1FFC1u,
-		0xFFF9FFC1u, 0xFFFFFFC1u, 0xFFFFFFC1u, 0xFFFFFFC1u, 0x7FFFFFC1u, 0x3FFFFFC1u,
-		0x1FFFFFC1u, 0x07FFFFC1u, 0x03FFFFC1u, 0x01FFFFC1u, 0x00FFFFC1u, 0x007FFFC1u,
-		0x001FFFC1u, 0x000FFFC1u, 0x0007FFC1u, 0x0003FFC1u, 0x0001FFC1u, 0x0001FFC1u,
-		0x0001FFC1u, 0x0001FFC1u, 0x0001FFC1u, 0x0001FFC1u, 0x0001FFC1u, 0x0001FFC1u,
-		0x0001FFC1u, 0x0001FFC1u, 0x0001FFC1u, 0x0001FFC1u, 0x0001FFC1u, 0x0001FFC1u,
-		0x0001FFC1u, 0x0000FFC0u, 0x0000FFC0u, 0x00007F80u, 0x00003F00u, 0x00000C00u
-	},
-	{
-		0x0FFFFFFFu, 0x3FFFFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
-		0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFE000FFu,
-		0xFFC000FFu, 0xFFC001FFu, 0xFFC003FFu, 0xFFC007FFu, 0xFFC00FFFu, 0xFFC01FFFu,
-		0xFFC03FFFu, 0xFFC07FFFu, 0xFFC0FFFEu, 0xFFC1FFFCu, 0xFFC3FFF8u, 0xFFC7FFF0u,
-		0xFFCFFFE0u, 0xFFFFFFC0u, 0xFFFFFF80u, 0xFFFFFF00u, 0xFFFFFE00u, 0xFFFFFC00u,
-		0xFFFFF800u, 0xFFFFF000u, 0xFFFFE000u, 0xFFFFE000u, 0xFFFFFFFFu, 0xFFFFFFFFu,
-		0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
-		0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFC00000u, 0xFFC00000u, 0xFFC00000u,
-		0xFFC00000u, 0xFFC00000u, 0xFFC00000u, 0xFFC00000u, 0xFFC00000u, 0xFFC00000u,
-		0xFFE00000u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
-		0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x7FFFFFFFu, 0x3FFFFFFFu, 0x0FFFFFFFu
-	},
-	{
-		0xFF000000u, 0xFFC00000u, 0xFFE00000u, 0xFFE00000u, 0xFFE00000u, 0xFFF00000u,
-		0xFFE00000u, 0xFFE00000u, 0xFFE00000u, 0xFFC00000u, 0xFF800000u, 0xFF000000u,
-		0xFE000000u, 0xFC000000u, 0xF8000000u, 0xF0000000u, 0xE0000000u, 0xC0000000u,
-		0x80000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0xFF800000u, 0xFFC00000u,
-		0xFFE00000u, 0xFFE00000u, 0xFFE00000u, 0xFFF00000u, 0xFFE00000u, 0xFFE00000u,
-		0xFFC00000u, 0xFF800000u, 0xFE000000u, 0x00000000u, 0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u,
-		0x00000000u, 0xFF800000u, 0xFFC00000u, 0xFFE00000u, 0xFFE00000u, 0xFFE00000u,
-		0xFFF00000u, 0xFFE00000u, 0xFFE00000u, 0xFFC00000u, 0xFF800000u, 0xFE000000u
-	},
-	{
-		0x00000000u, 0x00000001u, 0x0000000Fu, 0x0000003Fu, 0x000000FFu, 0x000003FFu,
-		0x000007FFu, 0x00000FFFu, 0x00001FFFu, 0x00007FFFu, 0x0000FFFFu, 0x0000FFFFu,
-		0x0001FFFFu, 0x0003FFFCu, 0x0007FFF0u, 0x000FFFE0u, 0x000FFFC0u, 0x001FFF80u,
-		0x001FFF00u, 0x003FFE00u, 0x003FFC00u, 0x007FF800u, 0x007FF800u, 0x007FF000u,
-		0x00FFF000u, 0x00FFF000u, 0x00FFE000u, 0x00FFE000u, 0x00FFE000u, 0x01FFC000u,
-		0x01FFC000u, 0x01FFC000u, 0x01FFC000u, 0x01FFC000u, 0x01FFC000u, 0x01FFC000u,
-		0x01FFC000u, 0x00FFE000u, 0x00FFE000u, 0x00FFE000u, 0x00FFE000u, 0x00FFF000u,
-		0x007FF000u, 0x007FF800u, 0x007FF800u, 0x003FFC00u, 0x003FFE00u, 0x003FFE00u,
-		0x001FFF00u, 0x000FFF80u, 0x000FFFC0u, 0x0007FFF0u, 0x0003FFF8u, 0x0003FFFEu,
-		0x0001FFFFu, 0x0000FFFFu, 0x00007FFFu, 0x00003FFFu, 0x00001FFFu, 0x00000FFFu,
-		0x000003FFu, 0x000001FFu, 0x0000007Fu, 0x0000001Fu, 0x00000003u, 0x00000000u
-	},
-	{
-		0x0FF00000u, 0xFFFF8000u, 0xFFFFF000u, 0xFFFFFC00u, 0xFFFFFF00u, 0xFFFFFFC0u,
-		0xFFFFFFE0u, 0xFFFFFFF0u, 0xFFFFFFF8u, 0xFFFFFFFEu, 0xFFFFFFFFu, 0xF81FFFFFu,
-		0x8001FFFFu, 0x00003FFFu, 0x00001FFFu, 0x000007FFu, 0x000003FFu, 0x000001FFu,
-		0x000000FFu, 0x0000007Fu, 0x0000003Fu, 0x0000003Fu, 0x0000001Fu, 0x0000000Fu,
-		0x0000000Fu, 0x0000000Fu, 0x00000007u, 0x00000007u, 0x00000007u, 0x00000007u,
-		0x00000003u, 0x00000003u, 0x00000003u, 0x00000003u, 0x00000003u, 0x00000003u,
-		0x00000003u, 0x00000007u, 0x00000007u, 0x00000007u, 0x00000007u, 0x0000000Fu,
-		0x0000000Fu, 0x0000001Fu, 0x0000001Fu, 0x0000003Fu, 0x0000007Fu, 0x0000007Fu,
-		0x000000FFu, 0x000001FFu, 0x000003FFu, 0x00000FFFu, 0x00003FFFu, 0x00007FFFu,
-		0xE007FFFFu, 0xFFFFFFFFu, 0xFFFFFFFEu, 0xFFFFFFFCu, 0xFFFFFFF8u, 0xFFFFFFF0u,
-		0xFFFFFFC0u, 0xFFFFFF80u, 0xFFFFFE00u, 0xFFFFF800u, 0xFFFFC000u, 0x7FFE0000u
-	},
-	{
-		0x00000000u, 0x0007E000u, 0x000FF800u, 0x000FF800u, 0x001FFC00u, 0x001FFC00u,
-		0x001FFC00u, 0x001FFE00u, 0x000FFE00u, 0x000FFE00u, 0x000FFF00u, 0x0007FF00u,
-		0x8007FF00u, 0xC007FF80u, 0xE003FF80u, 0xF003FF80u, 0xF003FFC0u, 0xF801FFC0u,
-		0xF801FFC0u, 0xFC01FFE0u, 0xFC00FFE0u, 0xFE00FFF0u, 0xFE00FFF0u, 0xFE007FF0u,
-		0xFF007FF8u, 0xFF007FF8u, 0xFF003FF8u, 0xFF003FFCu, 0xFF003FFCu, 0xFF801FFCu,
-		0xFF801FFEu, 0xFF801FFEu, 0xFF800FFEu, 0xFF800FFFu, 0xFF800FFFu, 0xFF8007FFu,
-		0xFF8007FFu, 0xFF0007FFu, 0xFF0003FFu, 0xFF0003FFu, 0xFF0003FFu, 0xFF0001FFu,
-		0xFE0001FFu, 0xFE0001FFu, 0xFE0000FFu, 0xFC0000FFu, 0xFC0000FFu, 0xF800007Fu,
-		0xF800007Fu, 0xF000007Fu, 0xF000003Fu, 0xE000003Fu, 0xC000003Fu, 0xC000001Fu,
-		0x8000001Fu, 0x0000001Fu, 0x0000000Fu, 0x0000000Fu, 0x0000000Fu, 0x00000007u,
-		0x00000007u, 0x00000007u, 0x00000003u, 0x00000003u, 0x00000001u, 0x00000000u
-	},
-	{
-		0x00000000u, 0x00001F80u, 0x00007FC1u, 0x00007FC3u, 0x0000FFE3u, 0x0000FFE7u,
-		0x0000FFE7u, 0x0001FFE7u, 0x0001FFC7u, 0x0003FFC7u, 0x0003FFC7u, 0x0003FF87u,
-		0x0007FF87u, 0x0007FF87u, 0x0007FF07u, 0x000FFF07u, 0x000FFF07u, 0x000FFE07u,
-		0x001FFE07u, 0x001FFE07u, 0x001FFC07u, 0x003FFC07u, 0x003FFC07u, 0x003FF807u,
-		0x007FF807u, 0x007FF807u, 0x007FF007u, 0x00FFF007u, 0x00FFF007u, 0x00FFE007u,
-		0x01FFE007u, 0x01FFE007u, 0x01FFC007u, 0x03FFC007u, 0x03FFC007u, 0x03FF8007u,
-		0x87FF8007u, 0x87FF8007u, 0x87FF0007u, 0xCFFF0007u, 0xCFFF0007u, 0xCFFE0007u,
-		0xFFFE0007u, 0xFFFE0007u, 0xFFFC0007u, 0xFFFC0007u, 0xFFF80007u, 0xFFF80007u,
-		0xFFF80007u, 0xFFF00007u, 0xFFF00007u, 0xFFF00007u, 0xFFE00007u, 0xFFE00007u,
-		0xFFE00007u, 0xFFC00007u, 0xFFC00007u, 0xFFC00007u, 0xFF800007u, 0xFF800007u,
-		0xFF800007u, 0xFF000003u, 0xFF000003u, 0xFE000001u, 0xFE000000u, 0x78000000u
-	},
-	{
-		0x3FFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
-		0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFF8003FFu,
-		0xFF0003FFu, 0xFF0007FFu, 0xFF000FFFu, 0xFF001FFFu, 0xFF003FFFu, 0xFF007FFFu,
-		0xFF00FFFEu, 0xFF01FFFCu, 0xFF03FFF8u, 0xFF07FFF0u, 0xFF0FFFE0u, 0xFF1FFFC0u,
-		0xFF3FFF80u, 0xFFFFFF00u, 0xFFFFFE00u, 0xFFFFFC00u, 0xFFFFF800u, 0xFFFFF000u,
-		0xFFFFE000u, 0xFFFFC000u, 0xFFFF8000u, 0xFFFF8000u, 0xFFFFFFFFu, 0xFFFFFFFFu,
-		0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
-		0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFF000000u, 0xFF000000u, 0xFF000000u,
-		0xFF000000u, 0xFF000000u, 0xFF000000u, 0xFF000000u, 0xFF000000u, 0xFF000000u,
-		0xFF800000u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
-		0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x3FFFFFFFu
-	},
-	{
-		0xFC0007FFu, 0xFF001FFFu, 0xFF803FFFu, 0xFF803FFFu, 0xFF807FFFu, 0xFFC07FFFu,
-		0xFF807FFFu, 0xFF807FFFu, 0xFF807FFFu, 0xFF007FFFu, 0xFE007FFFu, 0xFC007FFFu,
-		0xF8007FFFu, 0xF0007FFFu, 0xE0007FFFu, 0xC0007FFFu, 0x80007FFFu, 0x00007FFFu,
-		0x00007FFFu, 0x00007FFFu, 0x00007FFFu, 0x00007FFFu, 0x00007FFFu, 0x00007FFFu,
-		0x00007FFFu, 0x00007FF7u, 0x00007FF3u, 0x00007FF1u, 0x00007FF1u, 0x00007FF0u,
-		0x00007FF0u, 0x00007FF0u, 0x00007FF0u, 0x00007FF0u, 0xFE007FF0u, 0xFF007FFFu,
-		0xFF807FFFu, 0xFF807FFFu, 0xFF807FFFu, 0xFFC07FFFu, 0xFF807FFFu, 0xFF807FFFu,
-		0xFF007FFFu, 0xFE007FFFu, 0xF8007FFFu, 0x00007FFFu, 0x00007FF0u, 0x00007FF0u,
-		0x00007FF0u, 0x00007FF0u, 0x00007FF0u, 0x00007FF0u, 0x00007FF0u, 0x00007FF0u,
-		0x00007FF0u, 0xFE007FF0u, 0xFF007FF0u, 0xFF807FF0u, 0xFF807FF0u, 0xFF807FF0u,
-		0xFFC07FF0u, 0xFF807FF0u, 0xFF803FE0u, 0xFF003FE0u, 0xFE001FC0u, 0xF8000200u
-	},
-	{
-		0xFE000000u, 0xFFE00000u, 0xFFFC0000u, 0xFFFF0000u, 0xFFFF8000u, 0xFFFFE000u,
-		0xFFFFF000u, 0xFFFFF800u, 0xFFFFFC00u, 0xFFFFFE00u, 0xFFFFFE00u, 0x81FFFF00u,
-		0xC03FFF00u, 0xC01FFF80u, 0xE007FF80u, 0xF003FFC0u, 0xF003FFC0u, 0xF801FFC0u,
-		0xFC01FFE0u, 0xFC00FFE0u, 0xFE00FFE0u, 0xFF00FFE0u, 0xFF00FFE0u, 0xFF80FFE0u,
-		0xFF80FFE0u, 0xFFC0FFE0u, 0xFFE0FFE0u, 0xFFE1FFE0u, 0xFFF1FFC0u, 0xFFFBFFC0u,
-		0x7FFFFFC0u, 0x3FFFFF80u, 0x1FFFFF80u, 0x0FFFFF80u, 0x0FFFFF00u, 0xFFFFFE00u,
-		0xFFFFFE00u, 0xFFFFFC00u, 0xFFFFF800u, 0xFFFFF000u, 0xFFFFF000u, 0xFFFFF800u,
-		0xFFFFF800u, 0xFFFFFC00u, 0xFFFFFE00u, 0xFE3FFE00u, 0x001FFF00u, 0x000FFF80u,
-		0x000FFF80u, 0x0007FFC0u, 0x0003FFE0u, 0x0003FFE0u, 0x0001FFF0u, 0x0000FFF8u,
-		0x0000FFF8u, 0x00007FFCu, 0x00003FFEu, 0x00003FFEu, 0x00001FFFu, 0x00000FFFu,
-		0x00000FFFu, 0x000007FFu, 0x000003FEu, 0x000003FEu, 0x000001FCu, 0x00000010u
-	}
+	/* Column 1 */
+	0x8005u, 0x0000u, 0x0007u, 0x0001u, 0x0003u, 0x000Fu, 0x001Fu, 0x003Fu,
+	0x007Fu, 0x00FFu, 0x8002u, 0x01FFu, 0x0002u, 0x03FFu, 0x07FFu, 0x8002u,
+	0x0FFFu, 0x8002u, 0x1FFFu, 0x0001u, 0x3FFEu, 0x8002u, 0x3FFCu, 0x0001u,
+	0x7FF8u, 0x8002u, 0x7FF0u, 0x8002u, 0xFFF0u, 0x800Bu, 0xFFE0u, 0x0001u,
+	0xFFF0u, 0x8002u, 0x7FF0u, 0x8002u, 0x7FF8u, 0x8002u, 0x3FFCu, 0x0002u,
+	0x1FFEu, 0x1FFFu, 0x8002u, 0x0FFFu, 0x8002u, 0x07FFu, 0x0003u, 0x03FFu,
+	0x01FFu, 0x00FFu, 0x8002u, 0x007Fu, 0x0004u, 0x001Fu, 0x000Fu, 0x0007u,
+	0x0003u, 0x8005u, 0x0000u,
+
+	/* Column 2 */
+	0x0005u, 0x0007u, 0x00FFu, 0x07FFu, 0x1FFFu, 0x7FFFu, 0x8006u, 0xFFFFu,
+	0x0007u, 0xFFFCu, 0xFF80u, 0xFE00u, 0xF800u, 0xF000u, 0xC000u, 0x8000u,
+	0x800Au, 0x0000u, 0x0001u, 0x001Fu, 0x8002u, 0x007Fu, 0x8005u, 0x00FFu,
+	0x0007u, 0x007Fu, 0x003Fu, 0x001Fu, 0x000Fu, 0x0007u, 0x0003u, 0x0001u,
+	0x8005u, 0x0000u, 0x0007u, 0x8000u, 0xC000u, 0xE000u, 0xF000u, 0xFC00u,
+	0xFF00u, 0xFFE0u, 0x8007u, 0xFFFFu, 0x0004u, 0x3FFFu, 0x0FFFu, 0x03FFu,
+	0x003Fu,
+
+	/* Column 3 */
+	0x0004u, 0xE000u, 0xFF80u, 0xFFF0u, 0xFFFEu, 0x8007u, 0xFFFFu, 0x0006u,
+	0x0FFFu, 0x00FFu, 0x003Fu, 0x000Fu, 0x0007u, 0x0001u, 0x800Bu, 0x0000u,
+	0x800Bu, 0xFFFFu, 0x0001u, 0xFFF0u, 0x8002u, 0xFFF8u, 0x000Au, 0xFFFCu,
+	0xFFFEu, 0x7FFFu, 0x3FFFu, 0x1FFFu, 0x0FFFu, 0x07FFu, 0x03FFu, 0x01FFu,
+	0x00FFu, 0x8002u, 0x007Fu, 0x0001u, 0x03FFu, 0x8007u, 0xFFFFu, 0x0004u,
+	0xFFFEu, 0xFFF8u, 0xFFE0u, 0xFE00u,
+
+	/* Column 4 */
+	0x8004u, 0x0000u, 0x0006u, 0x8000u, 0xC000u, 0xF000u, 0xF800u, 0xFC00u,
+	0xFE00u, 0x8005u, 0xFF00u, 0x0003u, 0xFE00u, 0xFC00u, 0xF800u, 0x800Au,
+	0x0000u, 0x0002u, 0xFFFCu, 0xFFFEu, 0x8009u, 0xFFFFu, 0x8002u, 0x07FFu,
+	0x0002u, 0x0FFFu, 0x0FFEu, 0x8002u, 0x1FFEu, 0x0002u, 0xBFFCu, 0xFFFCu,
+	0x8002u, 0xFFF8u, 0x8002u, 0xFFF0u, 0x8002u, 0xFFE0u, 0x8002u, 0xFFC0u,
+	0x0002u, 0xFFF0u, 0xFFF8u, 0x8002u, 0xFFFCu, 0x8002u, 0xFFFFu, 0x0005u,
+	0xBFFFu, 0x1FFEu, 0x0FFCu, 0x03F8u, 0x01F0u,
+
+	/* Column 5 */
+	0x801Cu, 0x0000u, 0x8002u, 0x0001u, 0x8002u, 0x0003u, 0x8002u, 0x8007u,
+	0x8002u, 0x800Fu, 0x0001u, 0x001Fu, 0x8002u, 0x003Fu, 0x8002u, 0x007Fu,
+	0x8002u, 0x00FFu, 0x8002u, 0x01FFu, 0x8002u, 0x03FFu, 0x8002u, 0x07FFu,
+	0x8002u, 0x0FFFu, 0x0002u, 0x1FFFu, 0x1FFEu, 0x8002u, 0x3FFCu, 0x0002u,
+	0x7FF8u, 0xFFF8u, 0x8002u, 0xFFF0u, 0x8002u, 0xFFE0u, 0x8002u, 0xFFC0u,
+	0x0003u, 0xFF80u, 0x7F00u, 0x1C00u,
+
+	/* Column 6 */
+	0x0003u, 0x0000u, 0x0003u, 0x0007u, 0x8002u, 0x000Fu, 0x8002u, 0x001Fu,
+	0x8002u, 0x003Fu, 0x8002u, 0x007Fu, 0x8002u, 0x00FFu, 0x8002u, 0x01FFu,
+	0x0001u, 0x03FFu, 0x8002u, 0x07FFu, 0x8002u, 0x0FFFu, 0x0007u, 0x1FFFu,
+	0x1FFEu, 0x3FFEu, 0x3FFCu, 0x7FFCu, 0x7FF8u, 0xFFF8u, 0x8002u, 0xFFF0u,
+	0x8002u, 0xFFE0u, 0x8002u, 0xFFC0u, 0x0001u, 0xFF80u, 0x8004u, 0xFF00u,
+	0x0001u, 0xFF80u, 0x8002u, 0xFFC0u, 0x0002u, 0xFFE0u, 0xFFF0u, 0x8002u,
+	0xFFF8u, 0x0001u, 0xFFFCu, 0x8002u, 0xFFFEu, 0x8002u, 0x9FFFu, 0x0001u,
+	0x0FFFu, 0x8002u, 0x07FFu, 0x0001u, 0x03FFu, 0x8002u, 0x01FFu, 0x0001u,
+	0x00FFu, 0x8002u, 0x007Fu, 0x0001u, 0x003Fu, 0x8002u, 0x001Fu, 0x0004u,
+	0x000Fu, 0x0007u, 0x0003u, 0x0001u,
+
+	/* Column 7 */
+	0x0004u, 0x0000u, 0xF000u, 0xF800u, 0xFC00u, 0x8002u, 0xFE00u, 0x8002u,
+	0xFF00u, 0x8002u, 0xFF80u, 0x8002u, 0xFFC0u, 0x8002u, 0xFFE0u, 0x8002u,
+	0xFFF0u, 0x8002u, 0xFFF8u, 0x0004u, 0xFFFCu, 0x3FFEu, 0x1FFEu, 0x1FFFu,
+	0x8002u, 0x0FFFu, 0x8002u, 0x07FFu, 0x8002u, 0x03FFu, 0x8002u, 0x01FFu,
+	0x8002u, 0x00FFu, 0x8002u, 0x007Fu, 0x0001u, 0x003Fu, 0x8002u, 0x001Fu,
+	0x0001u, 0x003Fu, 0x8002u, 0x007Fu, 0x0001u, 0x00FFu, 0x8002u, 0x01FFu,
+	0x0001u, 0x03FFu, 0x8002u, 0x07FFu, 0x0001u, 0x0FFFu, 0x8002u, 0x1FFFu,
+	0x0003u, 0xBFFEu, 0xFFFEu, 0xFFFCu, 0x8002u, 0xFFF8u, 0x0001u, 0xFFF0u,
+	0x8002u, 0xFFE0u, 0x0001u, 0xFFC0u, 0x8002u, 0xFF80u, 0x0001u, 0xFF00u,
+	0x8002u, 0xFE00u, 0x0003u, 0xFC00u, 0xF800u, 0xE000u,
+
+	/* Column 8 */
+	0x8017u, 0x0000u, 0x8002u, 0x8000u, 0x8002u, 0xC000u, 0x8002u, 0xE000u,
+	0x8002u, 0xF000u, 0x8002u, 0xF800u, 0x8002u, 0xFC00u, 0x0001u, 0xFE00u,
+	0x8002u, 0xFF00u, 0x8002u, 0xFF80u, 0x8002u, 0xFFC0u, 0x8002u, 0xFFE0u,
+	0x8002u, 0xFFF0u, 0x8002u, 0xFFF8u, 0x0004u, 0x7FFCu, 0x3FFCu, 0x3FFEu,
+	0x1FFEu, 0x8002u, 0x0FFFu, 0x8002u, 0x07FFu, 0x8002u, 0x03FFu, 0x8002u,
+	0x01FFu, 0x8002u, 0x00FFu, 0x8002u, 0x007Fu, 0x0002u, 0x003Fu, 0x000Fu,
+
+	/* Column 9 */
+	0x0005u, 0x0380u, 0x0FE0u, 0x1FF0u, 0x1FFCu, 0x3FFEu, 0x800Du, 0x3FFFu,
+	0x0002u, 0x3FFBu, 0x3FF9u, 0x800Au, 0x3FF8u, 0x0001u, 0x3FF9u, 0x800Eu,
+	0x3FFFu, 0x0001u, 0x3FFCu, 0x8007u, 0x3FF8u, 0x8002u, 0xBFF8u, 0x8008u,
+	0xFFF8u, 0x0003u, 0xCFF0u, 0xC7E0u, 0x0180u,
+
+	/* Column 10 */
+	0x8006u, 0x0000u, 0x000Bu, 0x8000u, 0xC000u, 0xE000u, 0xF800u, 0xFC00u,
+	0xFE00u, 0xFF00u, 0xFF80u, 0xFFE0u, 0xFFF0u, 0xFFF8u, 0x8003u, 0xFFFFu,
+	0x0004u, 0x7FFFu, 0x3FFFu, 0x1FFFu, 0x0FFFu, 0x8002u, 0x07FFu, 0x0003u,
+	0x0FFFu, 0x1FFFu, 0x3FFFu, 0x8003u, 0xFFFFu, 0x000Cu, 0xFFFDu, 0xFFF8u,
+	0xFFE0u, 0xFFC0u, 0xFF80u, 0xFF00u, 0xFE00u, 0xFC00u, 0xF000u, 0xE000u,
+	0xC000u, 0x8000u, 0x8016u, 0x0000u,
+
+	/* Column 11 */
+	0x8003u, 0x0000u, 0x000Du, 0x0001u, 0x0003u, 0x0007u, 0x001Fu, 0x003Fu,
+	0x007Fu, 0x00FFu, 0x01FFu, 0x03FFu, 0x0FFFu, 0x1FFFu, 0x3FFFu, 0x7FFFu,
+	0x8002u, 0xFFFFu, 0x000Du, 0xFFFDu, 0xFFF9u, 0xFFF1u, 0xFFE1u, 0xFFC1u,
+	0xFF01u, 0xFE01u, 0xFF01u, 0xFF81u, 0xFFC1u, 0xFFE1u, 0xFFF1u, 0xFFF9u,
+	0x8003u, 0xFFFFu, 0x000Cu, 0x7FFFu, 0x3FFFu, 0x1FFFu, 0x07FFu, 0x03FFu,
+	0x01FFu, 0x00FFu, 0x007Fu, 0x001Fu, 0x000Fu, 0x0007u, 0x0003u, 0x800Fu,
+	0x0001u, 0x8005u, 0x0000u,
+
+	/* Column 12 */
+	0x0003u, 0x0C00u, 0x7F00u, 0xFF80u, 0x8002u, 0xFFC0u, 0x8038u, 0xFFC1u,
+	0x8002u, 0xFFC0u, 0x0003u, 0x7F80u, 0x3F00u, 0x0C00u,
+
+	/* Column 13 */
+	0x0003u, 0x0FFFu, 0x3FFFu, 0x7FFFu, 0x8008u, 0xFFFFu, 0x0001u, 0xFFE0u,
+	0x8009u, 0xFFC0u, 0x0004u, 0xFFC1u, 0xFFC3u, 0xFFC7u, 0xFFCFu, 0x8014u,
+	0xFFFFu, 0x8009u, 0xFFC0u, 0x0001u, 0xFFE0u, 0x8008u, 0xFFFFu, 0x0003u,
+	0x7FFFu, 0x3FFFu, 0x0FFFu,
+
+	/* Column 14 */
+	0x800Bu, 0xFFFFu, 0x8002u, 0x00FFu, 0x0013u, 0x01FFu, 0x03FFu, 0x07FFu,
+	0x0FFFu, 0x1FFFu, 0x3FFFu, 0x7FFFu, 0xFFFEu, 0xFFFCu, 0xFFF8u, 0xFFF0u,
+	0xFFE0u, 0xFFC0u, 0xFF80u, 0xFF00u, 0xFE00u, 0xFC00u, 0xF800u, 0xF000u,
+	0x8002u, 0xE000u, 0x800Bu, 0xFFFFu, 0x800Au, 0x0000u, 0x800Bu, 0xFFFFu,
+
+	/* Column 15 */
+	0x0002u, 0xFF00u, 0xFFC0u, 0x8003u, 0xFFE0u, 0x0001u, 0xFFF0u, 0x8003u,
+	0xFFE0u, 0x000Au, 0xFFC0u, 0xFF80u, 0xFF00u, 0xFE00u, 0xFC00u, 0xF800u,
+	0xF000u, 0xE000u, 0xC000u, 0x8000u, 0x800Fu, 0x0000u, 0x0002u, 0xFF80u,
+	0xFFC0u, 0x8003u, 0xFFE0u, 0x0001u, 0xFFF0u, 0x8002u, 0xFFE0u, 0x0003u,
+	0xFFC0u, 0xFF80u, 0xFE00u, 0x800Au, 0x0000u, 0x0002u, 0xFF80u, 0xFFC0u,
+	0x8003u, 0xFFE0u, 0x0001u, 0xFFF0u, 0x8002u, 0xFFE0u, 0x0003u, 0xFFC0u,
+	0xFF80u, 0xFE00u,
+
+	/* Column 16 */
+	0x8042u, 0x0000u,
+
+	/* Column 17 */
+	0x800Cu, 0x0000u, 0x0003u, 0x0001u, 0x0003u, 0x0007u, 0x8002u, 0x000Fu,
+	0x8002u, 0x001Fu, 0x8002u, 0x003Fu, 0x8003u, 0x007Fu, 0x8005u, 0x00FFu,
+	0x8008u, 0x01FFu, 0x8005u, 0x00FFu, 0x8003u, 0x007Fu, 0x8003u, 0x003Fu,
+	0x0001u, 0x001Fu, 0x8002u, 0x000Fu, 0x0001u, 0x0007u, 0x8002u, 0x0003u,
+	0x0001u, 0x0001u, 0x800Bu, 0x0000u,
+
+	/* Column 18 */
+	0x000Au, 0x0000u, 0x0001u, 0x000Fu, 0x003Fu, 0x00FFu, 0x03FFu, 0x07FFu,
+	0x0FFFu, 0x1FFFu, 0x7FFFu, 0x8003u, 0xFFFFu, 0x0008u, 0xFFFCu, 0xFFF0u,
+	0xFFE0u, 0xFFC0u, 0xFF80u, 0xFF00u, 0xFE00u, 0xFC00u, 0x8002u, 0xF800u,
+	0x8003u, 0xF000u, 0x8003u, 0xE000u, 0x8008u, 0xC000u, 0x8004u, 0xE000u,
+	0x8002u, 0xF000u, 0x8002u, 0xF800u, 0x0001u, 0xFC00u, 0x8002u, 0xFE00u,
+	0x0006u, 0xFF00u, 0xFF80u, 0xFFC0u, 0xFFF0u, 0xFFF8u, 0xFFFEu, 0x8002u,
+	0xFFFFu, 0x000Au, 0x7FFFu, 0x3FFFu, 0x1FFFu, 0x0FFFu, 0x03FFu, 0x01FFu,
+	0x007Fu, 0x001Fu, 0x0003u, 0x0000u,
+
+	/* Column 19 */
+	0x0001u, 0x0FF0u, 0x800Au, 0xFFFFu, 0x0002u, 0xF81Fu, 0x8001u, 0x8029u,
+	0x0000u, 0x0001u, 0xE007u, 0x800Au, 0xFFFFu, 0x0001u, 0x7FFEu,
+
+	/* Column 20 */
+	0x000Au, 0x0000u, 0x8000u, 0xF000u, 0xFC00u, 0xFF00u, 0xFFC0u, 0xFFE0u,
+	0xFFF0u, 0xFFF8u, 0xFFFEu, 0x8003u, 0xFFFFu, 0x0007u, 0x3FFFu, 0x1FFFu,
+	0x07FFu, 0x03FFu, 0x01FFu, 0x00FFu, 0x007Fu, 0x8002u, 0x003Fu, 0x0001u,
+	0x001Fu, 0x8003u, 0x000Fu, 0x8004u, 0x0007u, 0x8007u, 0x0003u, 0x8004u,
+	0x0007u, 0x8002u, 0x000Fu, 0x8002u, 0x001Fu, 0x0001u, 0x003Fu, 0x8002u,
+	0x007Fu, 0x0006u, 0x00FFu, 0x01FFu, 0x03FFu, 0x0FFFu, 0x3FFFu, 0x7FFFu,
+	0x8002u, 0xFFFFu, 0x000Au, 0xFFFEu, 0xFFFCu, 0xFFF8u, 0xFFF0u, 0xFFC0u,
+	0xFF80u, 0xFE00u, 0xF800u, 0xC000u, 0x0000u,
+
+	/* Column 21 */
+	0x0002u, 0x0000u, 0x0007u, 0x8002u, 0x000Fu, 0x8004u, 0x001Fu, 0x8003u,
+	0x000Fu, 0x0004u, 0x0007u, 0x8007u, 0xC007u, 0xE003u, 0x8002u, 0xF003u,
+	0x8002u, 0xF801u, 0x0002u, 0xFC01u, 0xFC00u, 0x8003u, 0xFE00u, 0x8005u,
+	0xFF00u, 0x8008u, 0xFF80u, 0x8005u, 0xFF00u, 0x8003u, 0xFE00u, 0x8002u,
+	0xFC00u, 0x8002u, 0xF800u, 0x8002u, 0xF000u, 0x0001u, 0xE000u, 0x8002u,
+	0xC000u, 0x0001u, 0x8000u, 0x800Bu, 0x0000u,
+
+	/* Column 22 */
+	0x0002u, 0x0000u, 0xE000u, 0x8002u, 0xF800u, 0x8003u, 0xFC00u, 0x8003u,
+	0xFE00u, 0x8003u, 0xFF00u, 0x8003u, 0xFF80u, 0x8003u, 0xFFC0u, 0x8002u,
+	0xFFE0u, 0x8002u, 0xFFF0u, 0x0001u, 0x7FF0u, 0x8002u, 0x7FF8u, 0x0001u,
+	0x3FF8u, 0x8002u, 0x3FFCu, 0x0001u, 0x1FFCu, 0x8002u, 0x1FFEu, 0x0001u,
+	0x0FFEu, 0x8002u, 0x0FFFu, 0x8003u, 0x07FFu, 0x8003u, 0x03FFu, 0x8003u,
+	0x01FFu, 0x8003u, 0x00FFu, 0x8003u, 0x007Fu, 0x8003u, 0x003Fu, 0x8003u,
+	0x001Fu, 0x8003u, 0x000Fu, 0x8003u, 0x0007u, 0x8002u, 0x0003u, 0x0002u,
+	0x0001u, 0x0000u,
+
+	/* Column 23 */
+	0x8007u, 0x0000u, 0x8002u, 0x0001u, 0x8003u, 0x0003u, 0x8003u, 0x0007u,
+	0x8003u, 0x000Fu, 0x8003u, 0x001Fu, 0x8003u, 0x003Fu, 0x8003u, 0x007Fu,
+	0x8003u, 0x00FFu, 0x8003u, 0x01FFu, 0x8003u, 0x03FFu, 0x8003u, 0x87FFu,
+	0x8002u, 0xCFFFu, 0x0001u, 0xCFFEu, 0x8002u, 0xFFFEu, 0x8002u, 0xFFFCu,
+	0x8003u, 0xFFF8u, 0x8003u, 0xFFF0u, 0x8003u, 0xFFE0u, 0x8003u, 0xFFC0u,
+	0x8003u, 0xFF80u, 0x8002u, 0xFF00u, 0x8002u, 0xFE00u, 0x0001u, 0x7800u,
+
+	/* Column 24 */
+	0x0005u, 0x0000u, 0x1F80u, 0x7FC1u, 0x7FC3u, 0xFFE3u, 0x8003u, 0xFFE7u,
+	0x8003u, 0xFFC7u, 0x8003u, 0xFF87u, 0x8003u, 0xFF07u, 0x8003u, 0xFE07u,
+	0x8003u, 0xFC07u, 0x8003u, 0xF807u, 0x8003u, 0xF007u, 0x8003u, 0xE007u,
+	0x8003u, 0xC007u, 0x8003u, 0x8007u, 0x8017u, 0x0007u, 0x8002u, 0x0003u,
+	0x0001u, 0x0001u, 0x8002u, 0x0000u,
+
+	/* Column 25 */
+	0x0001u, 0x3FFFu, 0x800Au, 0xFFFFu, 0x0001u, 0xFF80u, 0x8007u, 0xFF00u,
+	0x0006u, 0xFF01u, 0xFF03u, 0xFF07u, 0xFF0Fu, 0xFF1Fu, 0xFF3Fu, 0x8014u,
+	0xFFFFu, 0x8009u, 0xFF00u, 0x0001u, 0xFF80u, 0x800Au, 0xFFFFu, 0x0001u,
+	0x3FFFu,
+
+	/* Column 26 */
+	0x800Bu, 0xFFFFu, 0x8002u, 0x03FFu, 0x0013u, 0x07FFu, 0x0FFFu, 0x1FFFu,
+	0x3FFFu, 0x7FFFu, 0xFFFEu, 0xFFFCu, 0xFFF8u, 0xFFF0u, 0xFFE0u, 0xFFC0u,
+	0xFF80u, 0xFF00u, 0xFE00u, 0xFC00u, 0xF800u, 0xF000u, 0xE000u, 0xC000u,
+	0x8002u, 0x8000u, 0x800Bu, 0xFFFFu, 0x800Au, 0x0000u, 0x800Bu, 0xFFFFu,
+
+	/* Column 27 */
+	0x0002u, 0xFC00u, 0xFF00u, 0x8003u, 0xFF80u, 0x0001u, 0xFFC0u, 0x8003u,
+	0xFF80u, 0x0008u, 0xFF00u, 0xFE00u, 0xFC00u, 0xF800u, 0xF000u, 0xE000u,
+	0xC000u, 0x8000u, 0x8011u, 0x0000u, 0x0002u, 0xFE00u, 0xFF00u, 0x8003u,
+	0xFF80u, 0x0001u, 0xFFC0u, 0x8002u, 0xFF80u, 0x0003u, 0xFF00u, 0xFE00u,
+	0xF800u, 0x800Au, 0x0000u, 0x0002u, 0xFE00u, 0xFF00u, 0x8003u, 0xFF80u,
+	0x0001u, 0xFFC0u, 0x8002u, 0xFF80u, 0x0003u, 0xFF00u, 0xFE00u, 0xF800u,
+
+	/* Column 28 */
+	0x0002u, 0x07FFu, 0x1FFFu, 0x8002u, 0x3FFFu, 0x8015u, 0x7FFFu, 0x0002u,
+	0x7FF7u, 0x7FF3u, 0x8002u, 0x7FF1u, 0x8006u, 0x7FF0u, 0x800Bu, 0x7FFFu,
+	0x8010u, 0x7FF0u, 0x8002u, 0x3FE0u, 0x0002u, 0x1FC0u, 0x0200u,
+
+	/* Column 29 */
+	0x0003u, 0xFE00u, 0xFFE0u, 0xFFFCu, 0x8008u, 0xFFFFu, 0x0004u, 0x81FFu,
+	0xC03Fu, 0xC01Fu, 0xE007u, 0x8002u, 0xF003u, 0x0004u, 0xF801u, 0xFC01u,
+	0xFC00u, 0xFE00u, 0x8002u, 0xFF00u, 0x8002u, 0xFF80u, 0x0008u, 0xFFC0u,
+	0xFFE0u, 0xFFE1u, 0xFFF1u, 0xFFFBu, 0x7FFFu, 0x3FFFu, 0x1FFFu, 0x8002u,
+	0x0FFFu, 0x800Au, 0xFFFFu, 0x0002u, 0xFE3Fu, 0x001Fu, 0x8002u, 0x000Fu,
+	0x0001u, 0x0007u, 0x8002u, 0x0003u, 0x0001u, 0x0001u, 0x800Du, 0x0000u,
+
+	/* Column 30 */
+	0x8004u, 0x0000u, 0x0005u, 0x8000u, 0xE000u, 0xF000u, 0xF800u, 0xFC00u,
+	0x8002u, 0xFE00u, 0x8002u, 0xFF00u, 0x8002u, 0xFF80u, 0x8003u, 0xFFC0u,
+	0x800Au, 0xFFE0u, 0x8003u, 0xFFC0u, 0x8003u, 0xFF80u, 0x0001u, 0xFF00u,
+	0x8002u, 0xFE00u, 0x0002u, 0xFC00u, 0xF800u, 0x8002u, 0xF000u, 0x8002u,
+	0xF800u, 0x0001u, 0xFC00u, 0x8002u, 0xFE00u, 0x0001u, 0xFF00u, 0x8002u,
+	0xFF80u, 0x0001u, 0xFFC0u, 0x8002u, 0xFFE0u, 0x0001u, 0xFFF0u, 0x8002u,
+	0xFFF8u, 0x0001u, 0x7FFCu, 0x8002u, 0x3FFEu, 0x0001u, 0x1FFFu, 0x8002u,
+	0x0FFFu, 0x0001u, 0x07FFu, 0x8002u, 0x03FEu, 0x0002u, 0x01FCu, 0x0010u
 };
 
 const UINT32 grassCell[GRASS_CELL_HEIGHT] =
@@ -496,1205 +544,366 @@ const UINT32 roadCell[ROAD_CELL_HEIGHT] =
 	0xFFFFFFFFu, 0xFFFFFFFFu, 0x80000001u, 0xFFFFFFFFu
 };
 
-const UINT32 titleBitmap[NUM_TITLE_PARTS][TITLE_HEIGHT] =
+const UINT16 titleRle[] =
 {
-	{
-		0x00000000u, 0x00000780u,
-		0x00000FC0u, 0x00001FE0u,
-		0x00001FE0u, 0x00003FF0u,
-		0x00003FF0u, 0x00007FF8u,
-		0x00007FFCu, 0x0000FFFCu,
-		0x0000FFFEu, 0x0001FFFEu,
-		0x0001FFFFu, 0x0003FEFFu,
-		0x0003FCFFu, 0x0007FC7Fu,
-		0x0007F87Fu, 0x000FF83Fu,
-		0x000FF03Fu, 0x001FE01Fu,
-		0x001FE01Fu, 0x003FC00Fu,
-		0x003FC007u, 0x007F8007u,
-		0x00FF8003u, 0x00FF8003u,
-		0x01FF8007u, 0x01FFC00Fu,
-		0x03FFE00Fu, 0x03FFE01Fu,
-		0x07FFF03Fu, 0x07FFF83Fu,
-		0x0FFFF87Fu, 0x0FF7FCFFu,
-		0x1FF3FEFFu, 0x1FE3FFFFu,
-		0x3FE1FFFEu, 0x3FC0FFFEu,
-		0x7F80FFFCu, 0x7F807FF8u,
-		0xFF003FF8u, 0xFF001FF0u,
-		0xFE001FE0u, 0xFE000FE0u,
-		0x7C0007C0u, 0x10000100u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x03FFE000u,
-		0x07FFFF00u, 0x0FFFFFC0u,
-		0x0FFFFFF0u, 0x0FFFFFFCu,
-		0x0FFFFFFEu, 0x0FFFFFFFu,
-		0x0FFFFFFFu, 0x0FE007FFu,
-		0x0FE000FFu, 0x0FE0007Fu,
-		0x0FE0003Fu, 0x0FE0001Fu,
-		0x0FE0000Fu, 0x0FE00007u,
-		0x0FE00007u, 0x0FE00007u,
-		0x0FE00003u, 0x0FE00003u,
-		0x0FE00003u, 0x0FE00003u,
-		0x0FE00003u, 0x0FE00003u,
-		0x0FE00003u, 0x0FE00003u,
-		0x0FE00003u, 0x0FE00003u,
-		0x0FE00003u, 0x0FE00007u,
-		0x0FE00007u, 0x0FE0000Fu,
-		0x0FE0000Fu, 0x0FE0001Fu,
-		0x0FE0003Fu, 0x0FE0007Fu,
-		0x0FE001FFu, 0x0FE00FFFu,
-		0x0FFFFFFFu, 0x0FFFFFFEu,
-		0x0FFFFFFCu, 0x0FFFFFF8u,
-		0x0FFFFFE0u, 0x0FFFFFC0u,
-		0x07FFFE00u, 0x01FF0000u
-	},
-	{
-		0x00000003u, 0x0000003Fu,
-		0x000000FFu, 0x000003FFu,
-		0x00000FFFu, 0x00001FFFu,
-		0x00003FFFu, 0x00007FFFu,
-		0x0000FFF8u, 0x0001FFC0u,
-		0x0001FF80u, 0x0003FF00u,
-		0x0003FE00u, 0x0007FC00u,
-		0x8007F800u, 0x800FF000u,
-		0xC00FF000u, 0xC00FF000u,
-		0xE00FE000u, 0xE01FE000u,
-		0xF01FE000u, 0xF01FE000u,
-		0xF81FC000u, 0xF81FC000u,
-		0xFC1FE000u, 0xFE1FE000u,
-		0xFE1FE000u, 0xFF0FE000u,
-		0xFF0FF000u, 0xFF8FF000u,
-		0xFF8FF000u, 0xFFC7F800u,
-		0xFFC7FC00u, 0xBFE3FE00u,
-		0x9FE3FF00u, 0x1FF1FF80u,
-		0x0FF1FFE0u, 0x0FF8FFF8u,
-		0x07F87FFFu, 0x03FC3FFFu,
-		0x03FC1FFFu, 0x01FE07FFu,
-		0x01FC03FFu, 0x00FC00FFu,
-		0x00FC001Fu, 0x00100001u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x003FFF00u,
-		0x00FFFFE0u, 0x00FFFFF8u,
-		0x00FFFFFCu, 0x00FFFFFFu,
-		0x00FFFFFFu, 0x00FFFFFFu,
-		0x80FFFFFFu, 0x80FFE07Fu,
-		0xC0FFE03Fu, 0xE0FFF01Fu,
-		0xE0FFF80Fu, 0xF0FFFC0Fu,
-		0xF0FFFC07u, 0xF0FFFE07u,
-		0xF8FFFF07u, 0xF8FFFF07u,
-		0xF8FEFF87u, 0xF8FE7FCFu,
-		0xF8FE3FCFu, 0xF8FE1FFFu,
-		0xF8FE0FFFu, 0xFCFE0FFFu,
-		0xF8FFFFFFu, 0xF8FFFFFFu,
-		0xF8FFFFFFu, 0xF8FFFFFFu,
-		0xF8FFFFFFu, 0xF8FFFFFFu,
-		0xF8FFFFFFu, 0xF0FFFE7Fu,
-		0xF0FE007Fu, 0xE0FE003Fu,
-		0xE0FE001Fu, 0xE0FE001Fu,
-		0xC0FE000Fu, 0x80FE0007u,
-		0x00FE0007u, 0x00FE0003u,
-		0x00FE0001u, 0x00FE0001u,
-		0x00FE0000u, 0x00FE0000u,
-		0x007C0000u, 0x00300000u
-	},
-	{
-		0xF8000000u, 0xFF800000u,
-		0xFFE00000u, 0xFFF80000u,
-		0xFFFE0000u, 0xFFFF0000u,
-		0xFFFF8000u, 0xFFFF8000u,
-		0x01FFC000u, 0x007FC000u,
-		0x003F8000u, 0x000F0001u,
-		0x00000001u, 0x00000003u,
-		0x00000003u, 0x00000007u,
-		0x00000007u, 0x0000000Fu,
-		0x0000000Fu, 0x0000001Fu,
-		0x0000001Fu, 0x0000003Fu,
-		0x0000003Fu, 0x0000007Fu,
-		0x000000FFu, 0x000000FFu,
-		0x000001FFu, 0x000001FFu,
-		0x000003FFu, 0x000003FFu,
-		0x000007FFu, 0x000007FFu,
-		0x00000FFFu, 0x00000FF7u,
-		0x000F9FF3u, 0x003F9FE3u,
-		0x007FFFE1u, 0x03FFFFC0u,
-		0xFFFFFF80u, 0xFFFFFF80u,
-		0xFFFFFF00u, 0xFFFEFF00u,
-		0xFFF8FE00u, 0xFFE0FE00u,
-		0xFF807C00u, 0xF0001000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x0007FFFFu,
-		0x001FFFFFu, 0x001FFFFFu,
-		0x001FFFFFu, 0x003FFFFFu,
-		0x003FFFFFu, 0x803FFFFFu,
-		0xC03FFFFFu, 0xE03FC01Fu,
-		0xE03FC03Fu, 0xE03FC07Fu,
-		0xF03FC0FFu, 0xF03FC1FFu,
-		0xF03FC3FFu, 0xF03FC7FFu,
-		0xF03FCFFEu, 0xF03FDFFCu,
-		0xF03FFFF8u, 0xF03FFFF0u,
-		0xF03FFFE0u, 0xE03FFFC0u,
-		0xE03FFF80u, 0xE03FFF00u,
-		0xC03FFFFFu, 0x803FFFFFu,
-		0x803FFFFFu, 0x003FFFFFu,
-		0x003FFFFFu, 0x003FFFFFu,
-		0x803FFFFFu, 0xC03FFFFFu,
-		0xC03FC000u, 0xE03FC000u,
-		0xF03FC000u, 0xF03FC000u,
-		0xF83FC000u, 0xFC3FC000u,
-		0xFC3FFFFFu, 0xFE3FFFFFu,
-		0xFE3FFFFFu, 0xFF3FFFFFu,
-		0xFF1FFFFFu, 0x7E1FFFFFu,
-		0x3E0FFFFFu, 0x1803FFFFu
-	},
-	{
-		0x00000000u, 0x07800000u,
-		0x0FC00001u, 0x1FE00003u,
-		0x1FE00003u, 0x3FF00003u,
-		0x3FF00003u, 0x7FF80003u,
-		0x7FFC0003u, 0xFFFC0003u,
-		0xFFFE0003u, 0xFFFE0003u,
-		0xFFFF0003u, 0xFEFF0003u,
-		0xFCFF8003u, 0xFC7F8003u,
-		0xF87FC003u, 0xF83FC003u,
-		0xF03FE003u, 0xE01FE003u,
-		0xE01FF003u, 0xC00FF003u,
-		0xC007F803u, 0x8007F803u,
-		0x8003FC03u, 0x8003FE03u,
-		0x8007FE03u, 0xC00FFF03u,
-		0xE00FFF03u, 0xE01FFF83u,
-		0xF03FFF83u, 0xF83FFFC3u,
-		0xF87FFFC3u, 0xFCFFBFE3u,
-		0xFEFF9FE3u, 0xFFFF1FF3u,
-		0xFFFE0FF3u, 0xFFFE0FFBu,
-		0xFFFC07FFu, 0x7FF803FFu,
-		0x3FF803FFu, 0x1FF001FFu,
-		0x1FE001FFu, 0x0FE000FFu,
-		0x07C000FDu, 0x01000010u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0xFC000003u,
-		0xFF000007u, 0xFF00000Fu,
-		0xFF80000Fu, 0xFF80001Fu,
-		0xFF00001Fu, 0xFF00003Fu,
-		0xFE00003Fu, 0xFC00007Fu,
-		0xF800007Fu, 0xF00000FFu,
-		0xE00000FFu, 0xC00001FFu,
-		0x800001FEu, 0x000003FEu,
-		0x000003FCu, 0x000007FCu,
-		0x000007F8u, 0x00000FF0u,
-		0x00000FF0u, 0x00001FE0u,
-		0x00001FE0u, 0x00003FC0u,
-		0xFC007FC0u, 0xFF007FC0u,
-		0xFF00FFC0u, 0xFF80FFE0u,
-		0xFF81FFF0u, 0xFF01FFF0u,
-		0xFF03FFF8u, 0xF803FFFCu,
-		0x0007FFFCu, 0x0007FBFEu,
-		0x000FF9FFu, 0x000FF1FFu,
-		0x001FF0FFu, 0x001FE07Fu,
-		0xFC3FC07Fu, 0xFF3FC03Fu,
-		0xFFFF801Fu, 0xFFFF800Fu,
-		0xFFFF000Fu, 0xFF7F0007u,
-		0xFF3E0003u, 0xF8080000u
-	},
-	{
-		0x00000000u, 0xFFF80000u,
-		0xFFFFC000u, 0xFFFFF000u,
-		0xFFFFFC00u, 0xFFFFFF00u,
-		0xFFFFFF80u, 0xFFFFFFC0u,
-		0xFFFFFFE0u, 0xF801FFE0u,
-		0xF8003FF0u, 0xF8001FF8u,
-		0xF8000FF8u, 0xF80007FCu,
-		0xF80003FCu, 0xF80001FCu,
-		0xF80001FEu, 0xF80001FEu,
-		0xF80000FEu, 0xF80000FEu,
-		0xF80000FEu, 0xF80000FEu,
-		0xF80000FEu, 0xF80000FFu,
-		0xF80000FEu, 0xF80000FEu,
-		0xF80000FEu, 0xF80000FEu,
-		0xF80000FEu, 0xF80001FEu,
-		0xF80001FEu, 0xF80003FCu,
-		0xF80003FCu, 0xF80007F8u,
-		0xF8000FF8u, 0xF8001FF8u,
-		0xF8007FF0u, 0xF803FFE0u,
-		0xFFFFFFC0u, 0xFFFFFF80u,
-		0xFFFFFF00u, 0xFFFFFE00u,
-		0xFFFFF800u, 0xFFFFF000u,
-		0xFFFF8000u, 0x7FC00000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0xC0000078u,
-		0xE00000FCu, 0xF00001FEu,
-		0xF00001FFu, 0xF80001FFu,
-		0xF80001FFu, 0xFC0001FFu,
-		0xFE0001FFu, 0xFE0001FFu,
-		0xFF0001FFu, 0xFF0001FFu,
-		0xFF8001FFu, 0x7F8001FCu,
-		0x7FC001FCu, 0x3FC001FCu,
-		0x3FE001FCu, 0x1FE001FCu,
-		0x1FF001FCu, 0x0FF001FCu,
-		0x0FF801FCu, 0x07F801FCu,
-		0x03FC01FFu, 0x03FC01FFu,
-		0x01FE01FFu, 0x01FF01FFu,
-		0x03FF01FFu, 0x07FF81FFu,
-		0x07FF81FFu, 0x0FFFC1FFu,
-		0x1FFFC1FFu, 0x1FFFE1FFu,
-		0x3FFFE1FEu, 0x7FDFF1FCu,
-		0x7FCFF1FCu, 0xFF8FF9FCu,
-		0xFF07F9FCu, 0xFF07FDFCu,
-		0xFE03FFFCu, 0xFC01FFFCu,
-		0xFC01FFFCu, 0xF800FFFCu,
-		0xF000FFFCu, 0xF0007FFCu,
-		0xE0007EF8u, 0x80000830u
-	},
-	{
-		0x00000000u, 0x1FFFFFF0u,
-		0x7FFFFFFCu, 0x7FFFFFFCu,
-		0x7FFFFFFEu, 0xFFFFFFFEu,
-		0xFFFFFFFCu, 0xFFFFFFFCu,
-		0xFFFFFFF8u, 0xFF007FF0u,
-		0xFF00FFE0u, 0xFF01FFC0u,
-		0xFF03FF80u, 0xFF07FF00u,
-		0xFF0FFE00u, 0xFF1FFC00u,
-		0xFF3FF800u, 0xFF7FF000u,
-		0xFFFFE000u, 0xFFFFC000u,
-		0xFFFF8000u, 0xFFFF0000u,
-		0xFFFE0000u, 0xFFFC0000u,
-		0xFFFFFFF0u, 0xFFFFFFFCu,
-		0xFFFFFFFCu, 0xFFFFFFFEu,
-		0xFFFFFFFEu, 0xFFFFFFFCu,
-		0xFFFFFFFCu, 0xFFFFFFE0u,
-		0xFF000000u, 0xFF000000u,
-		0xFF000000u, 0xFF000000u,
-		0xFF000000u, 0xFF000000u,
-		0xFFFFFFF0u, 0xFFFFFFFCu,
-		0xFFFFFFFCu, 0xFFFFFFFEu,
-		0x7FFFFFFEu, 0x7FFFFFFCu,
-		0x3FFFFFFCu, 0x0FFFFFE0u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x000000F0u,
-		0x000003F8u, 0x000007F8u,
-		0x00000FF8u, 0xC0001FF8u,
-		0xE0003FF8u, 0xF0007FF8u,
-		0xF801FFF8u, 0xFC03FFF8u,
-		0xFF07FFF8u, 0xFF8FFFF8u,
-		0xFFDFFFF8u, 0xFFFFFBF8u,
-		0x7FFFF3F8u, 0x3FFFE3F8u,
-		0x1FFF83F8u, 0x0FFF03F8u,
-		0x0FFF83F8u, 0x3FFFC3F8u,
-		0x7FFFE3F8u, 0xFFFFFBF8u,
-		0xFFFFFFF8u, 0xFF9FFFF8u,
-		0xFF07FFF8u, 0xFE03FFF8u,
-		0xFC01FFF8u, 0xF000FFF8u,
-		0xE0007FF8u, 0xC0003FF8u,
-		0x80000FF8u, 0x000007F8u,
-		0x000003F8u, 0x000003F8u,
-		0x000003F8u, 0x000003F8u,
-		0x000003F8u, 0x000003F8u,
-		0x000003F8u, 0x000003F8u,
-		0x000003F8u, 0x000003F8u,
-		0x000003F8u, 0x000001F8u,
-		0x000001F0u, 0x00000060u
-	},
-	{
-		0x00000000u, 0x07800000u,
-		0x0FC00000u, 0x1FE00000u,
-		0x1FF00000u, 0x1FFC0001u,
-		0x1FFE0003u, 0x1FFF0007u,
-		0x1FFF801Fu, 0x1FFFC03Fu,
-		0x1FFFF07Fu, 0x1FFFF8FFu,
-		0x1FFFFDFFu, 0x1FCFFFFFu,
-		0x1FC7FFFFu, 0x1FC3FFFEu,
-		0x1FC1FFF8u, 0x1FC0FFF0u,
-		0x1FC0FFF8u, 0x1FC3FFFCu,
-		0x1FC7FFFEu, 0x1FCFFFFFu,
-		0x1FFFFFFFu, 0x1FFFF9FFu,
-		0x1FFFF07Fu, 0x1FFFE03Fu,
-		0x1FFFC01Fu, 0x1FFF000Fu,
-		0x1FFE0007u, 0x1FFC0003u,
-		0x1FF80000u, 0x1FF00000u,
-		0x1FE00000u, 0x1FC00000u,
-		0x1FC00000u, 0x1FC00000u,
-		0x1FC00000u, 0x1FC00000u,
-		0x1FC00000u, 0x1FC00000u,
-		0x1FC00000u, 0x1FC00000u,
-		0x1FC00000u, 0x1FC00000u,
-		0x0F800000u, 0x03000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x0003FFF0u,
-		0x001FFFF8u, 0x007FFFFCu,
-		0x01FFFFFCu, 0x03FFFFFCu,
-		0x07FFFFF8u, 0x0FFFFFF8u,
-		0x0FFFFFF0u, 0x1FF87FE0u,
-		0x1FF0FFC0u, 0x3FE1FF80u,
-		0x3FC3FF00u, 0x3F87FE00u,
-		0x3F8FFC00u, 0x7F9FF800u,
-		0x7FBFF000u, 0x7FFFE000u,
-		0x3FFFC000u, 0x3FFF8000u,
-		0x3FFF0000u, 0x3FFE0000u,
-		0x1FFC0000u, 0x0FF80000u,
-		0x0FFC0000u, 0x07FE0000u,
-		0x03FF0000u, 0x01FF8000u,
-		0x00FFE000u, 0x007FF000u,
-		0x003FF800u, 0x001FFC00u,
-		0x000FFE00u, 0x0007FF00u,
-		0x0003FF80u, 0x0001FFC0u,
-		0x0000FFE0u, 0x00007FF0u,
-		0x0FFFFFF8u, 0x3FFFFFFCu,
-		0x3FFFFFFEu, 0x7FFFFFFEu,
-		0x7FFFFFFEu, 0x3FFFFFFEu,
-		0x1FFFFFFCu, 0x07FFFFF0u
-	},
-	{
-		0x00000000u, 0x0F01FFF8u,
-		0x3F87FFFEu, 0x7F87FFFEu,
-		0xFF87FFFFu, 0xFF87FFFFu,
-		0xFF87FFFEu, 0xFF83FFFEu,
-		0xFF80FFF0u, 0xFF803FC0u,
-		0xFF803FC0u, 0xFF803FC0u,
-		0xFF803FC0u, 0xBF803FC0u,
-		0x3F803FC0u, 0x3F803FC0u,
-		0x3F803FC0u, 0x3F803FC0u,
-		0x3F803FC0u, 0x3F803FC0u,
-		0x3F803FC0u, 0xBF803FC0u,
-		0xFF803FC0u, 0xFF803FC0u,
-		0xFF803FC0u, 0xFF803FC0u,
-		0xFF803FC0u, 0xFF803FC0u,
-		0xFF803FC0u, 0xFF803FC0u,
-		0xFF803FC0u, 0x7F803FC0u,
-		0x3F803FC0u, 0x3F803FC0u,
-		0x3F803FC0u, 0x3F803FC0u,
-		0x3F803FC0u, 0x3F803FC0u,
-		0x3F81FFF9u, 0x3F87FFFFu,
-		0x3F87FFFFu, 0x3F87FFFFu,
-		0x3F87FFFFu, 0x1F87FFFFu,
-		0x1F03FFFFu, 0x0600FFF0u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000001u,
-		0x00000007u, 0x0000001Fu,
-		0x0000007Fu, 0x000000FFu,
-		0x000001FFu, 0x000003FFu,
-		0x000007FFu, 0x00000FFEu,
-		0x00000FFCu, 0x00001FF0u,
-		0x00001FE0u, 0x00003FC0u,
-		0x00003FC0u, 0x00007F80u,
-		0x00007F80u, 0x00007F00u,
-		0x0000FF00u, 0x0000FF00u,
-		0x0000FE00u, 0x0000FE00u,
-		0x0000FE00u, 0x0000FE00u,
-		0x0000FE00u, 0x0000FF00u,
-		0x0000FF00u, 0x0000FF00u,
-		0x00007F00u, 0x00007F80u,
-		0x00007F80u, 0x00003FC0u,
-		0x00003FE0u, 0x00001FE0u,
-		0x00001FF0u, 0x00000FFCu,
-		0x00000FFEu, 0x000007FFu,
-		0x000003FFu, 0x000001FFu,
-		0x000000FFu, 0x0000003Fu,
-		0x0000001Fu, 0x00000007u,
-		0x00000000u, 0x00000000u
-	},
-	{
-		0x00000000u, 0x00001E00u,
-		0x00003F00u, 0x00007F80u,
-		0x00007F80u, 0x0000FFC0u,
-		0x0000FFC0u, 0x0001FFE0u,
-		0x0001FFF0u, 0x0003FFF0u,
-		0x0003FFF8u, 0x0007FFF8u,
-		0x0007FFFCu, 0x000FFBFCu,
-		0x000FF3FEu, 0x001FF1FEu,
-		0x001FE1FFu, 0x003FE0FFu,
-		0x003FC0FFu, 0x007F807Fu,
-		0x007F807Fu, 0x00FF003Fu,
-		0x00FF001Fu, 0x01FE001Fu,
-		0x03FE000Fu, 0x03FE000Fu,
-		0x07FE001Fu, 0x07FF003Fu,
-		0x0FFF803Fu, 0x0FFF807Fu,
-		0x1FFFC0FFu, 0x1FFFE0FFu,
-		0x3FFFE1FFu, 0x3FDFF3FEu,
-		0x7FCFFBFEu, 0x7F8FFFFCu,
-		0xFF87FFF8u, 0xFF03FFF8u,
-		0xFE03FFF0u, 0xFE01FFE0u,
-		0xFC00FFE0u, 0xFC007FC0u,
-		0xF8007F80u, 0xF8003F80u,
-		0xF0001F00u, 0x40000400u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x1F800000u, 0xFFFC0000u,
-		0xFFFF0000u, 0xFFFFC000u,
-		0xFFFFE000u, 0xFFFFF801u,
-		0xFFFFFC01u, 0xFFFFFE01u,
-		0x800FFF01u, 0x0003FF01u,
-		0x0001FF81u, 0x00007FC1u,
-		0x00003FC1u, 0x00003FE1u,
-		0x00001FE1u, 0x00000FF1u,
-		0x00000FF1u, 0x000007F1u,
-		0x000007F1u, 0x000007F9u,
-		0x000007F9u, 0x000007F9u,
-		0x000003F9u, 0x000003F9u,
-		0x000007F9u, 0x000007F9u,
-		0x000007F9u, 0x000007F1u,
-		0x000007F1u, 0x00000FF1u,
-		0x00000FF1u, 0x00001FE1u,
-		0x00003FE1u, 0x00007FC1u,
-		0x0000FFC1u, 0x0001FF81u,
-		0x0003FF01u, 0xC01FFF01u,
-		0xFFFFFE01u, 0xFFFFFC01u,
-		0xFFFFF801u, 0xFFFFE001u,
-		0xFFFFC000u, 0xFFFF0000u,
-		0xFFF80000u, 0x07000000u
-	},
-	{
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x80000000u, 0x80000000u,
-		0xC0000000u, 0xC0000000u,
-		0xE0000000u, 0xE0000000u,
-		0xF0000000u, 0xF8000000u,
-		0xF8000000u, 0xFC000000u,
-		0xFC000000u, 0xFE000000u,
-		0xFE000000u, 0xFF000000u,
-		0xFF000000u, 0xFF800000u,
-		0x7F800000u, 0x7FC00000u,
-		0x3FC00000u, 0x3FE00000u,
-		0x1FE00000u, 0x0FF00000u,
-		0x0FF00000u, 0x07F80000u,
-		0x07F00000u, 0x03F00000u,
-		0x03F00000u, 0x00400000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x3FFFFFE0u,
-		0xFFFFFFF8u, 0xFFFFFFF8u,
-		0xFFFFFFFCu, 0xFFFFFFFCu,
-		0xFFFFFFF8u, 0xFFFFFFF8u,
-		0xFFFFFFF0u, 0xFE00FFE0u,
-		0xFE01FFC0u, 0xFE03FF80u,
-		0xFE07FF00u, 0xFE0FFE00u,
-		0xFE1FFC00u, 0xFE3FF800u,
-		0xFE7FF000u, 0xFEFFE000u,
-		0xFFFFC000u, 0xFFFF8000u,
-		0xFFFF0000u, 0xFFFE0000u,
-		0xFFFC0000u, 0xFFF80000u,
-		0xFFFFFFE0u, 0xFFFFFFF8u,
-		0xFFFFFFF8u, 0xFFFFFFFCu,
-		0xFFFFFFFCu, 0xFFFFFFF8u,
-		0xFFFFFFF8u, 0xFFFFFFC0u,
-		0xFE000000u, 0xFE000000u,
-		0xFE000000u, 0xFE000000u,
-		0xFE000000u, 0xFE000000u,
-		0xFE000000u, 0xFE000000u,
-		0xFE000000u, 0xFE000000u,
-		0xFE000000u, 0xFC000000u,
-		0xFC000000u, 0x30000000u
-	},
-	{
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000F00u,
-		0x00001F80u, 0x00003FC0u,
-		0x00003FE0u, 0x00003FF8u,
-		0x00003FFCu, 0x00003FFEu,
-		0x00003FFFu, 0x00003FFFu,
-		0x00003FFFu, 0x00003FFFu,
-		0x00003FFFu, 0x00003F9Fu,
-		0x00003F8Fu, 0x00003F87u,
-		0x00003F83u, 0x00003F81u,
-		0x00003F81u, 0x00003F87u,
-		0x00003F8Fu, 0x00003F9Fu,
-		0x00003FFFu, 0x00003FFFu,
-		0x00003FFFu, 0x00003FFFu,
-		0x00003FFFu, 0x00003FFEu,
-		0x00003FFCu, 0x00003FF8u,
-		0x00003FF0u, 0x00003FE0u,
-		0x00003FC0u, 0x00003F80u,
-		0x00003F80u, 0x00003F80u,
-		0x00003F80u, 0x00003F80u,
-		0x00003F80u, 0x00003F80u,
-		0x00003F80u, 0x00003F80u,
-		0x00003F80u, 0x00003F80u,
-		0x00001F00u, 0x00000600u
-	},
-	{
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00001E00u,
-		0x00007F00u, 0x0000FF00u,
-		0x0001FF00u, 0x0003FF00u,
-		0x0007FF00u, 0x000FFF00u,
-		0x003FFF00u, 0x807FFF00u,
-		0xE0FFFF00u, 0xF1FFFF00u,
-		0xFBFFFF00u, 0xFFFF7F00u,
-		0xFFFE7F00u, 0xFFFC7F00u,
-		0xFFF07F00u, 0xFFE07F00u,
-		0xFFF07F00u, 0xFFF87F00u,
-		0xFFFC7F00u, 0xFFFF7F00u,
-		0xFFFFFF00u, 0xF3FFFF00u,
-		0xE0FFFF00u, 0xC07FFF00u,
-		0x803FFF00u, 0x001FFF00u,
-		0x000FFF01u, 0x0007FF01u,
-		0x0001FF03u, 0x0000FF03u,
-		0x00007F07u, 0x00007F07u,
-		0x00007F0Fu, 0x00007F0Fu,
-		0x00007F1Fu, 0x00007F1Fu,
-		0x00007F3Fu, 0x00007F3Fu,
-		0x00007FFFu, 0x00007FFFu,
-		0x00007FFFu, 0x00003F7Fu,
-		0x00003E3Eu, 0x00000C08u
-	},
-	{
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x0003C000u,
-		0x0007E000u, 0x000FF000u,
-		0x000FF000u, 0x001FF800u,
-		0x001FF800u, 0x003FFC00u,
-		0x003FFE00u, 0x007FFE00u,
-		0x007FFF00u, 0x00FFFF00u,
-		0x00FFFF80u, 0x01FF7F80u,
-		0x01FE7FC0u, 0x03FE3FC0u,
-		0x03FC3FE0u, 0x07FC1FE0u,
-		0x07F81FF0u, 0x0FF00FF0u,
-		0x0FF00FF8u, 0x1FE007F8u,
-		0x1FE003FCu, 0x3FC003FCu,
-		0x7FC001FEu, 0x7FC001FFu,
-		0xFFC003FFu, 0xFFE007FFu,
-		0xFFF007FFu, 0xFFF00FFFu,
-		0xFFF81FFFu, 0xFFFC1FFFu,
-		0xFFFC3FFFu, 0xFBFE7FDFu,
-		0xF9FF7FCFu, 0xF1FFFF8Fu,
-		0xF0FFFF07u, 0xE07FFF07u,
-		0xC07FFE03u, 0xC03FFC01u,
-		0x801FFC01u, 0x800FF800u,
-		0x000FF000u, 0x0007F000u,
-		0x0003E000u, 0x00008000u
-	},
-	{
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x007FFC00u,
-		0x00FFFFE0u, 0x01FFFFF8u,
-		0x01FFFFFEu, 0x01FFFFFFu,
-		0x01FFFFFFu, 0x01FFFFFFu,
-		0x01FFFFFFu, 0x01FC00FFu,
-		0x01FC001Fu, 0x01FC000Fu,
-		0x01FC0007u, 0x01FC0003u,
-		0x01FC0001u, 0x01FC0000u,
-		0x01FC0000u, 0x01FC0000u,
-		0x01FC0000u, 0x01FC0000u,
-		0x01FC0000u, 0x01FC0000u,
-		0x01FC0000u, 0x01FC0000u,
-		0x01FC0000u, 0x01FC0000u,
-		0x01FC0000u, 0x81FC0000u,
-		0x81FC0000u, 0xC1FC0000u,
-		0xC1FC0000u, 0xE1FC0001u,
-		0xE1FC0001u, 0xF1FC0003u,
-		0xF1FC0007u, 0xF9FC000Fu,
-		0xF9FC003Fu, 0xFDFC01FFu,
-		0xFFFFFFFFu, 0xFFFFFFFFu,
-		0xFFFFFFFFu, 0xFFFFFFFFu,
-		0xFFFFFFFCu, 0x7FFFFFF8u,
-		0x7EFFFFC0u, 0x083FE000u
-	},
-	{
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x000E0000u,
-		0x001F0000u, 0x003F8000u,
-		0x003FC000u, 0x803FE000u,
-		0xC03FE000u, 0xE03FF000u,
-		0xF03FF800u, 0xF03FF800u,
-		0xF83FFC00u, 0xFC3FFE00u,
-		0xFC3FFF00u, 0xFE3FFF00u,
-		0xFE3FFF80u, 0xFE3FFFC0u,
-		0xFF3FFFC0u, 0xFF3FFFE0u,
-		0x7F3F9FF0u, 0x7F3F9FF0u,
-		0x7F3F8FF8u, 0x7F3F87FCu,
-		0x7F3F87FCu, 0x7FBF83FEu,
-		0x7F3F81FFu, 0x7F3F80FFu,
-		0x7F3F80FFu, 0x7F3F807Fu,
-		0x7F3F803Fu, 0xFF3F803Fu,
-		0xFF3F801Fu, 0xFE3F800Fu,
-		0xFE3F800Fu, 0xFC3F8007u,
-		0xFC3F8003u, 0xFC3F8001u,
-		0xF83F8001u, 0xF03F8000u,
-		0xE03FFFFFu, 0xC03FFFFFu,
-		0x803FFFFFu, 0x003FFFFFu,
-		0x003FFFFFu, 0x003FFFFFu,
-		0x001FFFFFu, 0x0007FFFFu
-	},
-	{
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x03807FFFu,
-		0x07C1FFFFu, 0x0FE1FFFFu,
-		0x0FE1FFFFu, 0x0FE3FFFFu,
-		0x0FE3FFFFu, 0x0FE3FFFFu,
-		0x0FE3FFFFu, 0x0FE3FC01u,
-		0x0FE3FC03u, 0x0FE3FC07u,
-		0x0FE3FC0Fu, 0x0FE3FC1Fu,
-		0x0FE3FC3Fu, 0x0FE3FC7Fu,
-		0x0FE3FCFFu, 0x0FE3FDFFu,
-		0x0FE3FFFFu, 0x0FE3FFFFu,
-		0x0FE3FFFEu, 0x0FE3FFFCu,
-		0x0FE3FFF8u, 0x0FE3FFF0u,
-		0x0FE3FFFFu, 0x8FE3FFFFu,
-		0x8FE3FFFFu, 0xCFE3FFFFu,
-		0xEFE3FFFFu, 0xFFE3FFFFu,
-		0xFFE3FFFFu, 0xFFE3FFFFu,
-		0xFFE3FC00u, 0xFFE3FC00u,
-		0xFFE3FC00u, 0xFFE3FC00u,
-		0xFFE3FC00u, 0xFFE3FC00u,
-		0xFFE3FFFFu, 0xFFE3FFFFu,
-		0xFFE3FFFFu, 0xFFE3FFFFu,
-		0xFFE1FFFFu, 0xFFE1FFFFu,
-		0xFFC0FFFFu, 0xFF003FFFu
-	},
-	{
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0xFFC00007u,
-		0xFFF0003Fu, 0xFFF000FFu,
-		0xFFF803FFu, 0xFFF807FFu,
-		0xFFF00FFFu, 0xFFF01FFFu,
-		0xFFE01FFFu, 0xFFC03FF0u,
-		0xFF803FE1u, 0xFF007FC3u,
-		0xFE007F87u, 0xFC007F0Fu,
-		0xF8007F1Fu, 0xF000FF3Fu,
-		0xE000FF7Fu, 0xC000FFFFu,
-		0x80007FFFu, 0x00007FFFu,
-		0x00007FFEu, 0x00007FFCu,
-		0x00003FF8u, 0x00001FF0u,
-		0xFFC01FF8u, 0xFFF00FFCu,
-		0xFFF007FEu, 0xFFF803FFu,
-		0xFFF801FFu, 0xFFF000FFu,
-		0xFFF0007Fu, 0xFF80003Fu,
-		0x0000001Fu, 0x0000000Fu,
-		0x00000007u, 0x00000003u,
-		0x00000001u, 0x00000000u,
-		0xFFC01FFFu, 0xFFF07FFFu,
-		0xFFF07FFFu, 0xFFF8FFFFu,
-		0xFFF8FFFFu, 0xFFF07FFFu,
-		0xFFF03FFFu, 0xFF800FFFu
-	},
-	{
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0xFFE00007u,
-		0xFFF0003Fu, 0xFFF800FFu,
-		0xFFF803FFu, 0xFFF807FFu,
-		0xFFF00FFFu, 0xFFF01FFFu,
-		0xFFE01FFFu, 0xFFC03FF0u,
-		0xFF803FE1u, 0xFF007FC3u,
-		0xFE007F87u, 0xFC007F0Fu,
-		0xF8007F1Fu, 0xF000FF3Fu,
-		0xE000FF7Fu, 0xC000FFFFu,
-		0x80007FFFu, 0x00007FFFu,
-		0x00007FFEu, 0x00007FFCu,
-		0x00003FF8u, 0x00001FF0u,
-		0x00001FF8u, 0x00000FFCu,
-		0x000007FEu, 0x000003FFu,
-		0xC00001FFu, 0xE00000FFu,
-		0xF000007Fu, 0xF800003Fu,
-		0xFC00001Fu, 0xFE00000Fu,
-		0xFF000007u, 0xFF800003u,
-		0xFFC00001u, 0xFFE00000u,
-		0xFFF01FFFu, 0xFFF87FFFu,
-		0xFFFC7FFFu, 0xFFFCFFFFu,
-		0xFFFCFFFFu, 0xFFFC7FFFu,
-		0xFFF83FFFu, 0xFFE00FFFu
-	},
-	{
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0xFFE00000u,
-		0xFFF00000u, 0xFFF80000u,
-		0xFFF80000u, 0xFFF80000u,
-		0xFFF00000u, 0xFFF00000u,
-		0xFFE00000u, 0xFFC00000u,
-		0xFF800000u, 0xFF000000u,
-		0xFE000000u, 0xFC000000u,
-		0xF8000000u, 0xF0000000u,
-		0xE0000000u, 0xC0000000u,
-		0x80000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0x00000000u, 0x00000000u,
-		0xC0000000u, 0xE0000000u,
-		0xF0000000u, 0xF8000000u,
-		0xFC000000u, 0xFE000000u,
-		0xFF000000u, 0xFF800000u,
-		0xFFC00000u, 0xFFE00000u,
-		0xFFF00000u, 0xFFF80000u,
-		0xFFFC0000u, 0xFFFC0000u,
-		0xFFFC0000u, 0xFFFC0000u,
-		0xFFF80000u, 0xFFE00000u
-	}
+	/* Column 1 */
+	0x800Bu, 0x0000u, 0x8002u, 0x0001u, 0x8002u, 0x0003u, 0x8002u, 0x0007u,
+	0x8002u, 0x000Fu, 0x8002u, 0x001Fu, 0x8002u, 0x003Fu, 0x0001u, 0x007Fu,
+	0x8002u, 0x00FFu, 0x8002u, 0x01FFu, 0x8002u, 0x03FFu, 0x8002u, 0x07FFu,
+	0x0006u, 0x0FFFu, 0x0FF7u, 0x1FF3u, 0x1FE3u, 0x3FE1u, 0x3FC0u, 0x8002u,
+	0x7F80u, 0x8002u, 0xFF00u, 0x8002u, 0xFE00u, 0x0002u, 0x7C00u, 0x1000u,
+	0x801Fu, 0x0000u, 0x0002u, 0x03FFu, 0x07FFu, 0x8006u, 0x0FFFu, 0x801Du,
+	0x0FE0u, 0x8006u, 0x0FFFu, 0x0002u, 0x07FFu, 0x01FFu,
+
+	/* Column 2 */
+	0x0003u, 0x0000u, 0x0780u, 0x0FC0u, 0x8002u, 0x1FE0u, 0x8002u, 0x3FF0u,
+	0x0003u, 0x7FF8u, 0x7FFCu, 0xFFFCu, 0x8002u, 0xFFFEu, 0x0007u, 0xFFFFu,
+	0xFEFFu, 0xFCFFu, 0xFC7Fu, 0xF87Fu, 0xF83Fu, 0xF03Fu, 0x8002u, 0xE01Fu,
+	0x0003u, 0xC00Fu, 0xC007u, 0x8007u, 0x8002u, 0x8003u, 0x000Au, 0x8007u,
+	0xC00Fu, 0xE00Fu, 0xE01Fu, 0xF03Fu, 0xF83Fu, 0xF87Fu, 0xFCFFu, 0xFEFFu,
+	0xFFFFu, 0x8002u, 0xFFFEu, 0x0008u, 0xFFFCu, 0x7FF8u, 0x3FF8u, 0x1FF0u,
+	0x1FE0u, 0x0FE0u, 0x07C0u, 0x0100u, 0x801Fu, 0x0000u, 0x0006u, 0xE000u,
+	0xFF00u, 0xFFC0u, 0xFFF0u, 0xFFFCu, 0xFFFEu, 0x8002u, 0xFFFFu, 0x0006u,
+	0x07FFu, 0x00FFu, 0x007Fu, 0x003Fu, 0x001Fu, 0x000Fu, 0x8003u, 0x0007u,
+	0x800Bu, 0x0003u, 0x8002u, 0x0007u, 0x8002u, 0x000Fu, 0x000Du, 0x001Fu,
+	0x003Fu, 0x007Fu, 0x01FFu, 0x0FFFu, 0xFFFFu, 0xFFFEu, 0xFFFCu, 0xFFF8u,
+	0xFFE0u, 0xFFC0u, 0xFE00u, 0x0000u,
+
+	/* Column 3 */
+	0x8009u, 0x0000u, 0x8002u, 0x0001u, 0x8002u, 0x0003u, 0x0003u, 0x0007u,
+	0x8007u, 0x800Fu, 0x8002u, 0xC00Fu, 0x0002u, 0xE00Fu, 0xE01Fu, 0x8002u,
+	0xF01Fu, 0x8002u, 0xF81Fu, 0x0001u, 0xFC1Fu, 0x8002u, 0xFE1Fu, 0x8002u,
+	0xFF0Fu, 0x8002u, 0xFF8Fu, 0x8002u, 0xFFC7u, 0x0006u, 0xBFE3u, 0x9FE3u,
+	0x1FF1u, 0x0FF1u, 0x0FF8u, 0x07F8u, 0x8002u, 0x03FCu, 0x0002u, 0x01FEu,
+	0x01FCu, 0x8002u, 0x00FCu, 0x0001u, 0x0010u, 0x801Fu, 0x0000u, 0x0001u,
+	0x003Fu, 0x8006u, 0x00FFu, 0x8002u, 0x80FFu, 0x0001u, 0xC0FFu, 0x8002u,
+	0xE0FFu, 0x8003u, 0xF0FFu, 0x8002u, 0xF8FFu, 0x8005u, 0xF8FEu, 0x0001u,
+	0xFCFEu, 0x8007u, 0xF8FFu, 0x0002u, 0xF0FFu, 0xF0FEu, 0x8003u, 0xE0FEu,
+	0x0002u, 0xC0FEu, 0x80FEu, 0x8006u, 0x00FEu, 0x0002u, 0x007Cu, 0x0030u,
+
+	/* Column 4 */
+	0x000Fu, 0x0003u, 0x003Fu, 0x00FFu, 0x03FFu, 0x0FFFu, 0x1FFFu, 0x3FFFu,
+	0x7FFFu, 0xFFF8u, 0xFFC0u, 0xFF80u, 0xFF00u, 0xFE00u, 0xFC00u, 0xF800u,
+	0x8003u, 0xF000u, 0x8004u, 0xE000u, 0x8002u, 0xC000u, 0x8004u, 0xE000u,
+	0x8003u, 0xF000u, 0x000Fu, 0xF800u, 0xFC00u, 0xFE00u, 0xFF00u, 0xFF80u,
+	0xFFE0u, 0xFFF8u, 0x7FFFu, 0x3FFFu, 0x1FFFu, 0x07FFu, 0x03FFu, 0x00FFu,
+	0x001Fu, 0x0001u, 0x801Fu, 0x0000u, 0x0004u, 0xFF00u, 0xFFE0u, 0xFFF8u,
+	0xFFFCu, 0x8004u, 0xFFFFu, 0x0007u, 0xE07Fu, 0xE03Fu, 0xF01Fu, 0xF80Fu,
+	0xFC0Fu, 0xFC07u, 0xFE07u, 0x8002u, 0xFF07u, 0x0004u, 0xFF87u, 0x7FCFu,
+	0x3FCFu, 0x1FFFu, 0x8002u, 0x0FFFu, 0x8007u, 0xFFFFu, 0x0003u, 0xFE7Fu,
+	0x007Fu, 0x003Fu, 0x8002u, 0x001Fu, 0x0001u, 0x000Fu, 0x8002u, 0x0007u,
+	0x0001u, 0x0003u, 0x8002u, 0x0001u, 0x8004u, 0x0000u,
+
+	/* Column 5 */
+	0x0005u, 0xF800u, 0xFF80u, 0xFFE0u, 0xFFF8u, 0xFFFEu, 0x8003u, 0xFFFFu,
+	0x0004u, 0x01FFu, 0x007Fu, 0x003Fu, 0x000Fu, 0x8016u, 0x0000u, 0x0004u,
+	0x000Fu, 0x003Fu, 0x007Fu, 0x03FFu, 0x8003u, 0xFFFFu, 0x0005u, 0xFFFEu,
+	0xFFF8u, 0xFFE0u, 0xFF80u, 0xF000u, 0x801Fu, 0x0000u, 0x0001u, 0x0007u,
+	0x8003u, 0x001Fu, 0x8002u, 0x003Fu, 0x0002u, 0x803Fu, 0xC03Fu, 0x8003u,
+	0xE03Fu, 0x8009u, 0xF03Fu, 0x8003u, 0xE03Fu, 0x0001u, 0xC03Fu, 0x8002u,
+	0x803Fu, 0x8003u, 0x003Fu, 0x0001u, 0x803Fu, 0x8002u, 0xC03Fu, 0x0001u,
+	0xE03Fu, 0x8002u, 0xF03Fu, 0x0001u, 0xF83Fu, 0x8002u, 0xFC3Fu, 0x8002u,
+	0xFE3Fu, 0x0005u, 0xFF3Fu, 0xFF1Fu, 0x7E1Fu, 0x3E0Fu, 0x1803u,
+
+	/* Column 6 */
+	0x8006u, 0x0000u, 0x8002u, 0x8000u, 0x8002u, 0xC000u, 0x0001u, 0x8000u,
+	0x8002u, 0x0001u, 0x8002u, 0x0003u, 0x8002u, 0x0007u, 0x8002u, 0x000Fu,
+	0x8002u, 0x001Fu, 0x8002u, 0x003Fu, 0x0001u, 0x007Fu, 0x8002u, 0x00FFu,
+	0x8002u, 0x01FFu, 0x8002u, 0x03FFu, 0x8002u, 0x07FFu, 0x0006u, 0x0FFFu,
+	0x0FF7u, 0x9FF3u, 0x9FE3u, 0xFFE1u, 0xFFC0u, 0x8002u, 0xFF80u, 0x8002u,
+	0xFF00u, 0x8002u, 0xFE00u, 0x0002u, 0x7C00u, 0x1000u, 0x801Fu, 0x0000u,
+	0x8008u, 0xFFFFu, 0x000Fu, 0xC01Fu, 0xC03Fu, 0xC07Fu, 0xC0FFu, 0xC1FFu,
+	0xC3FFu, 0xC7FFu, 0xCFFEu, 0xDFFCu, 0xFFF8u, 0xFFF0u, 0xFFE0u, 0xFFC0u,
+	0xFF80u, 0xFF00u, 0x8008u, 0xFFFFu, 0x8006u, 0xC000u, 0x8008u, 0xFFFFu,
+
+	/* Column 7 */
+	0x0003u, 0x0000u, 0x0780u, 0x0FC0u, 0x8002u, 0x1FE0u, 0x8002u, 0x3FF0u,
+	0x0003u, 0x7FF8u, 0x7FFCu, 0xFFFCu, 0x8002u, 0xFFFEu, 0x0007u, 0xFFFFu,
+	0xFEFFu, 0xFCFFu, 0xFC7Fu, 0xF87Fu, 0xF83Fu, 0xF03Fu, 0x8002u, 0xE01Fu,
+	0x0003u, 0xC00Fu, 0xC007u, 0x8007u, 0x8002u, 0x8003u, 0x000Au, 0x8007u,
+	0xC00Fu, 0xE00Fu, 0xE01Fu, 0xF03Fu, 0xF83Fu, 0xF87Fu, 0xFCFFu, 0xFEFFu,
+	0xFFFFu, 0x8002u, 0xFFFEu, 0x0008u, 0xFFFCu, 0x7FF8u, 0x3FF8u, 0x1FF0u,
+	0x1FE0u, 0x0FE0u, 0x07C0u, 0x0100u, 0x801Fu, 0x0000u, 0x0001u, 0xFC00u,
+	0x8002u, 0xFF00u, 0x8002u, 0xFF80u, 0x8002u, 0xFF00u, 0x0007u, 0xFE00u,
+	0xFC00u, 0xF800u, 0xF000u, 0xE000u, 0xC000u, 0x8000u, 0x8009u, 0x0000u,
+	0x0001u, 0xFC00u, 0x8002u, 0xFF00u, 0x0005u, 0xFF80u, 0xFF81u, 0xFF01u,
+	0xFF03u, 0xF803u, 0x8002u, 0x0007u, 0x8002u, 0x000Fu, 0x8002u, 0x001Fu,
+	0x0002u, 0xFC3Fu, 0xFF3Fu, 0x8003u, 0xFFFFu, 0x0003u, 0xFF7Fu, 0xFF3Eu,
+	0xF808u,
+
+	/* Column 8 */
+	0x8002u, 0x0000u, 0x0001u, 0x0001u, 0x800Bu, 0x0003u, 0x8002u, 0x8003u,
+	0x8002u, 0xC003u, 0x8002u, 0xE003u, 0x8002u, 0xF003u, 0x8002u, 0xF803u,
+	0x0001u, 0xFC03u, 0x8002u, 0xFE03u, 0x8002u, 0xFF03u, 0x8002u, 0xFF83u,
+	0x8002u, 0xFFC3u, 0x0006u, 0xBFE3u, 0x9FE3u, 0x1FF3u, 0x0FF3u, 0x0FFBu,
+	0x07FFu, 0x8002u, 0x03FFu, 0x8002u, 0x01FFu, 0x0003u, 0x00FFu, 0x00FDu,
+	0x0010u, 0x801Fu, 0x0000u, 0x0002u, 0x0003u, 0x0007u, 0x8002u, 0x000Fu,
+	0x8002u, 0x001Fu, 0x8002u, 0x003Fu, 0x8002u, 0x007Fu, 0x8002u, 0x00FFu,
+	0x0006u, 0x01FFu, 0x01FEu, 0x03FEu, 0x03FCu, 0x07FCu, 0x07F8u, 0x8002u,
+	0x0FF0u, 0x8002u, 0x1FE0u, 0x0001u, 0x3FC0u, 0x8002u, 0x7FC0u, 0x0002u,
+	0xFFC0u, 0xFFE0u, 0x8002u, 0xFFF0u, 0x0001u, 0xFFF8u, 0x8002u, 0xFFFCu,
+	0x000Du, 0xFBFEu, 0xF9FFu, 0xF1FFu, 0xF0FFu, 0xE07Fu, 0xC07Fu, 0xC03Fu,
+	0x801Fu, 0x800Fu, 0x000Fu, 0x0007u, 0x0003u, 0x0000u,
+
+	/* Column 9 */
+	0x0002u, 0x0000u, 0xFFF8u, 0x8007u, 0xFFFFu, 0x0001u, 0xF801u, 0x801Bu,
+	0xF800u, 0x0001u, 0xF803u, 0x8007u, 0xFFFFu, 0x0001u, 0x7FC0u, 0x801Fu,
+	0x0000u, 0x0002u, 0xC000u, 0xE000u, 0x8002u, 0xF000u, 0x8002u, 0xF800u,
+	0x0001u, 0xFC00u, 0x8002u, 0xFE00u, 0x8002u, 0xFF00u, 0x000Au, 0xFF80u,
+	0x7F80u, 0x7FC0u, 0x3FC0u, 0x3FE0u, 0x1FE0u, 0x1FF0u, 0x0FF0u, 0x0FF8u,
+	0x07F8u, 0x8002u, 0x03FCu, 0x0003u, 0x01FEu, 0x01FFu, 0x03FFu, 0x8002u,
+	0x07FFu, 0x0001u, 0x0FFFu, 0x8002u, 0x1FFFu, 0x0004u, 0x3FFFu, 0x7FDFu,
+	0x7FCFu, 0xFF8Fu, 0x8002u, 0xFF07u, 0x0001u, 0xFE03u, 0x8002u, 0xFC01u,
+	0x0001u, 0xF800u, 0x8002u, 0xF000u, 0x0002u, 0xE000u, 0x8000u,
+
+	/* Column 10 */
+	0x8002u, 0x0000u, 0x0006u, 0xC000u, 0xF000u, 0xFC00u, 0xFF00u, 0xFF80u,
+	0xFFC0u, 0x8002u, 0xFFE0u, 0x0006u, 0x3FF0u, 0x1FF8u, 0x0FF8u, 0x07FCu,
+	0x03FCu, 0x01FCu, 0x8002u, 0x01FEu, 0x8005u, 0x00FEu, 0x0001u, 0x00FFu,
+	0x8005u, 0x00FEu, 0x8002u, 0x01FEu, 0x8002u, 0x03FCu, 0x000Cu, 0x07F8u,
+	0x0FF8u, 0x1FF8u, 0x7FF0u, 0xFFE0u, 0xFFC0u, 0xFF80u, 0xFF00u, 0xFE00u,
+	0xF800u, 0xF000u, 0x8000u, 0x8020u, 0x0000u, 0x0003u, 0x0078u, 0x00FCu,
+	0x01FEu, 0x8009u, 0x01FFu, 0x8009u, 0x01FCu, 0x8005u, 0x01FFu, 0x8002u,
+	0x81FFu, 0x8002u, 0xC1FFu, 0x0002u, 0xE1FFu, 0xE1FEu, 0x8002u, 0xF1FCu,
+	0x8002u, 0xF9FCu, 0x0001u, 0xFDFCu, 0x8005u, 0xFFFCu, 0x0003u, 0x7FFCu,
+	0x7EF8u, 0x0830u,
+
+	/* Column 11 */
+	0x0002u, 0x0000u, 0x1FFFu, 0x8003u, 0x7FFFu, 0x8004u, 0xFFFFu, 0x8002u,
+	0xFF00u, 0x0007u, 0xFF01u, 0xFF03u, 0xFF07u, 0xFF0Fu, 0xFF1Fu, 0xFF3Fu,
+	0xFF7Fu, 0x8004u, 0xFFFFu, 0x0002u, 0xFFFEu, 0xFFFCu, 0x8008u, 0xFFFFu,
+	0x8006u, 0xFF00u, 0x8004u, 0xFFFFu, 0x8002u, 0x7FFFu, 0x0002u, 0x3FFFu,
+	0x0FFFu, 0x8023u, 0x0000u, 0x000Cu, 0xC000u, 0xE000u, 0xF000u, 0xF801u,
+	0xFC03u, 0xFF07u, 0xFF8Fu, 0xFFDFu, 0xFFFFu, 0x7FFFu, 0x3FFFu, 0x1FFFu,
+	0x8002u, 0x0FFFu, 0x0002u, 0x3FFFu, 0x7FFFu, 0x8002u, 0xFFFFu, 0x0008u,
+	0xFF9Fu, 0xFF07u, 0xFE03u, 0xFC01u, 0xF000u, 0xE000u, 0xC000u, 0x8000u,
+	0x800Fu, 0x0000u,
+
+	/* Column 12 */
+	0x0002u, 0x0000u, 0xFFF0u, 0x8002u, 0xFFFCu, 0x8002u, 0xFFFEu, 0x8002u,
+	0xFFFCu, 0x000Du, 0xFFF8u, 0x7FF0u, 0xFFE0u, 0xFFC0u, 0xFF80u, 0xFF00u,
+	0xFE00u, 0xFC00u, 0xF800u, 0xF000u, 0xE000u, 0xC000u, 0x8000u, 0x8003u,
+	0x0000u, 0x0001u, 0xFFF0u, 0x8002u, 0xFFFCu, 0x8002u, 0xFFFEu, 0x8002u,
+	0xFFFCu, 0x0001u, 0xFFE0u, 0x8006u, 0x0000u, 0x0001u, 0xFFF0u, 0x8002u,
+	0xFFFCu, 0x8002u, 0xFFFEu, 0x8002u, 0xFFFCu, 0x0001u, 0xFFE0u, 0x801Fu,
+	0x0000u, 0x0007u, 0x00F0u, 0x03F8u, 0x07F8u, 0x0FF8u, 0x1FF8u, 0x3FF8u,
+	0x7FF8u, 0x8005u, 0xFFF8u, 0x0009u, 0xFBF8u, 0xF3F8u, 0xE3F8u, 0x83F8u,
+	0x03F8u, 0x83F8u, 0xC3F8u, 0xE3F8u, 0xFBF8u, 0x8006u, 0xFFF8u, 0x0004u,
+	0x7FF8u, 0x3FF8u, 0x0FF8u, 0x07F8u, 0x800Bu, 0x03F8u, 0x0003u, 0x01F8u,
+	0x01F0u, 0x0060u,
+
+	/* Column 13 */
+	0x0007u, 0x0000u, 0x0780u, 0x0FC0u, 0x1FE0u, 0x1FF0u, 0x1FFCu, 0x1FFEu,
+	0x8006u, 0x1FFFu, 0x0004u, 0x1FCFu, 0x1FC7u, 0x1FC3u, 0x1FC1u, 0x8002u,
+	0x1FC0u, 0x0003u, 0x1FC3u, 0x1FC7u, 0x1FCFu, 0x8006u, 0x1FFFu, 0x0005u,
+	0x1FFEu, 0x1FFCu, 0x1FF8u, 0x1FF0u, 0x1FE0u, 0x800Bu, 0x1FC0u, 0x0002u,
+	0x0F80u, 0x0300u, 0x801Fu, 0x0000u, 0x0006u, 0x0003u, 0x001Fu, 0x007Fu,
+	0x01FFu, 0x03FFu, 0x07FFu, 0x8002u, 0x0FFFu, 0x0009u, 0x1FF8u, 0x1FF0u,
+	0x3FE1u, 0x3FC3u, 0x3F87u, 0x3F8Fu, 0x7F9Fu, 0x7FBFu, 0x7FFFu, 0x8003u,
+	0x3FFFu, 0x000Fu, 0x3FFEu, 0x1FFCu, 0x0FF8u, 0x0FFCu, 0x07FEu, 0x03FFu,
+	0x01FFu, 0x00FFu, 0x007Fu, 0x003Fu, 0x001Fu, 0x000Fu, 0x0007u, 0x0003u,
+	0x0001u, 0x8002u, 0x0000u, 0x0001u, 0x0FFFu, 0x8002u, 0x3FFFu, 0x8002u,
+	0x7FFFu, 0x0003u, 0x3FFFu, 0x1FFFu, 0x07FFu,
+
+	/* Column 14 */
+	0x8005u, 0x0000u, 0x0008u, 0x0001u, 0x0003u, 0x0007u, 0x801Fu, 0xC03Fu,
+	0xF07Fu, 0xF8FFu, 0xFDFFu, 0x8002u, 0xFFFFu, 0x0006u, 0xFFFEu, 0xFFF8u,
+	0xFFF0u, 0xFFF8u, 0xFFFCu, 0xFFFEu, 0x8002u, 0xFFFFu, 0x0007u, 0xF9FFu,
+	0xF07Fu, 0xE03Fu, 0xC01Fu, 0x000Fu, 0x0007u, 0x0003u, 0x802Fu, 0x0000u,
+	0x0002u, 0xFFF0u, 0xFFF8u, 0x8003u, 0xFFFCu, 0x8002u, 0xFFF8u, 0x000Cu,
+	0xFFF0u, 0x7FE0u, 0xFFC0u, 0xFF80u, 0xFF00u, 0xFE00u, 0xFC00u, 0xF800u,
+	0xF000u, 0xE000u, 0xC000u, 0x8000u, 0x8007u, 0x0000u, 0x000Du, 0x8000u,
+	0xE000u, 0xF000u, 0xF800u, 0xFC00u, 0xFE00u, 0xFF00u, 0xFF80u, 0xFFC0u,
+	0xFFE0u, 0x7FF0u, 0xFFF8u, 0xFFFCu, 0x8004u, 0xFFFEu, 0x0002u, 0xFFFCu,
+	0xFFF0u,
+
+	/* Column 15 */
+	0x0004u, 0x0000u, 0x0F01u, 0x3F87u, 0x7F87u, 0x8003u, 0xFF87u, 0x0001u,
+	0xFF83u, 0x8005u, 0xFF80u, 0x0001u, 0xBF80u, 0x8007u, 0x3F80u, 0x0001u,
+	0xBF80u, 0x8009u, 0xFF80u, 0x0001u, 0x7F80u, 0x8006u, 0x3F80u, 0x0001u,
+	0x3F81u, 0x8004u, 0x3F87u, 0x0003u, 0x1F87u, 0x1F03u, 0x0600u, 0x804Cu,
+	0x0000u,
+
+	/* Column 16 */
+	0x0002u, 0x0000u, 0xFFF8u, 0x8002u, 0xFFFEu, 0x8002u, 0xFFFFu, 0x8002u,
+	0xFFFEu, 0x0001u, 0xFFF0u, 0x801Du, 0x3FC0u, 0x0001u, 0xFFF9u, 0x8006u,
+	0xFFFFu, 0x0001u, 0xFFF0u, 0x801Fu, 0x0000u, 0x000Cu, 0x0001u, 0x0007u,
+	0x001Fu, 0x007Fu, 0x00FFu, 0x01FFu, 0x03FFu, 0x07FFu, 0x0FFEu, 0x0FFCu,
+	0x1FF0u, 0x1FE0u, 0x8002u, 0x3FC0u, 0x8002u, 0x7F80u, 0x0001u, 0x7F00u,
+	0x8002u, 0xFF00u, 0x8005u, 0xFE00u, 0x8003u, 0xFF00u, 0x0001u, 0x7F00u,
+	0x8002u, 0x7F80u, 0x000Du, 0x3FC0u, 0x3FE0u, 0x1FE0u, 0x1FF0u, 0x0FFCu,
+	0x0FFEu, 0x07FFu, 0x03FFu, 0x01FFu, 0x00FFu, 0x003Fu, 0x001Fu, 0x0007u,
+	0x8002u, 0x0000u,
+
+	/* Column 17 */
+	0x8007u, 0x0000u, 0x8002u, 0x0001u, 0x8002u, 0x0003u, 0x8002u, 0x0007u,
+	0x8002u, 0x000Fu, 0x8002u, 0x001Fu, 0x8002u, 0x003Fu, 0x8002u, 0x007Fu,
+	0x8002u, 0x00FFu, 0x0001u, 0x01FEu, 0x8002u, 0x03FEu, 0x0002u, 0x07FEu,
+	0x07FFu, 0x8002u, 0x0FFFu, 0x8002u, 0x1FFFu, 0x0008u, 0x3FFFu, 0x3FDFu,
+	0x7FCFu, 0x7F8Fu, 0xFF87u, 0xFF03u, 0xFE03u, 0xFE01u, 0x8002u, 0xFC00u,
+	0x8002u, 0xF800u, 0x0002u, 0xF000u, 0x4000u, 0x801Eu, 0x0000u, 0x0002u,
+	0x1F80u, 0xFFFCu, 0x8006u, 0xFFFFu, 0x0003u, 0x800Fu, 0x0003u, 0x0001u,
+	0x8018u, 0x0000u, 0x0003u, 0x0001u, 0x0003u, 0xC01Fu, 0x8006u, 0xFFFFu,
+	0x0002u, 0xFFF8u, 0x0700u,
+
+	/* Column 18 */
+	0x0003u, 0x0000u, 0x1E00u, 0x3F00u, 0x8002u, 0x7F80u, 0x8002u, 0xFFC0u,
+	0x0001u, 0xFFE0u, 0x8002u, 0xFFF0u, 0x8002u, 0xFFF8u, 0x0007u, 0xFFFCu,
+	0xFBFCu, 0xF3FEu, 0xF1FEu, 0xE1FFu, 0xE0FFu, 0xC0FFu, 0x8002u, 0x807Fu,
+	0x0001u, 0x003Fu, 0x8002u, 0x001Fu, 0x8002u, 0x000Fu, 0x000Au, 0x001Fu,
+	0x003Fu, 0x803Fu, 0x807Fu, 0xC0FFu, 0xE0FFu, 0xE1FFu, 0xF3FEu, 0xFBFEu,
+	0xFFFCu, 0x8002u, 0xFFF8u, 0x0001u, 0xFFF0u, 0x8002u, 0xFFE0u, 0x0005u,
+	0x7FC0u, 0x7F80u, 0x3F80u, 0x1F00u, 0x0400u, 0x8021u, 0x0000u, 0x0005u,
+	0xC000u, 0xE000u, 0xF801u, 0xFC01u, 0xFE01u, 0x8002u, 0xFF01u, 0x0005u,
+	0xFF81u, 0x7FC1u, 0x3FC1u, 0x3FE1u, 0x1FE1u, 0x8002u, 0x0FF1u, 0x8002u,
+	0x07F1u, 0x8003u, 0x07F9u, 0x8002u, 0x03F9u, 0x8003u, 0x07F9u, 0x8002u,
+	0x07F1u, 0x8002u, 0x0FF1u, 0x0005u, 0x1FE1u, 0x3FE1u, 0x7FC1u, 0xFFC1u,
+	0xFF81u, 0x8002u, 0xFF01u, 0x0005u, 0xFE01u, 0xFC01u, 0xF801u, 0xE001u,
+	0xC000u, 0x8003u, 0x0000u,
+
+	/* Column 19 */
+	0x8012u, 0x0000u, 0x8002u, 0x8000u, 0x8002u, 0xC000u, 0x8002u, 0xE000u,
+	0x0001u, 0xF000u, 0x8002u, 0xF800u, 0x8002u, 0xFC00u, 0x8002u, 0xFE00u,
+	0x8002u, 0xFF00u, 0x0006u, 0xFF80u, 0x7F80u, 0x7FC0u, 0x3FC0u, 0x3FE0u,
+	0x1FE0u, 0x8002u, 0x0FF0u, 0x0002u, 0x07F8u, 0x07F0u, 0x8002u, 0x03F0u,
+	0x0001u, 0x0040u, 0x801Fu, 0x0000u, 0x0001u, 0x3FFFu, 0x8007u, 0xFFFFu,
+	0x0009u, 0xFE00u, 0xFE01u, 0xFE03u, 0xFE07u, 0xFE0Fu, 0xFE1Fu, 0xFE3Fu,
+	0xFE7Fu, 0xFEFFu, 0x8003u, 0xFFFFu, 0x0003u, 0xFFFEu, 0xFFFCu, 0xFFF8u,
+	0x8008u, 0xFFFFu, 0x800Bu, 0xFE00u, 0x8002u, 0xFC00u, 0x0001u, 0x3000u,
+
+	/* Column 20 */
+	0x804Du, 0x0000u, 0x0001u, 0xFFE0u, 0x8002u, 0xFFF8u, 0x8002u, 0xFFFCu,
+	0x8002u, 0xFFF8u, 0x000Cu, 0xFFF0u, 0xFFE0u, 0xFFC0u, 0xFF80u, 0xFF00u,
+	0xFE00u, 0xFC00u, 0xF800u, 0xF000u, 0xE000u, 0xC000u, 0x8000u, 0x8004u,
+	0x0000u, 0x0001u, 0xFFE0u, 0x8002u, 0xFFF8u, 0x8002u, 0xFFFCu, 0x8002u,
+	0xFFF8u, 0x0001u, 0xFFC0u, 0x800Eu, 0x0000u,
+
+	/* Column 21 */
+	0x807Au, 0x0000u,
+
+	/* Column 22 */
+	0x804Du, 0x0000u, 0x0007u, 0x0F00u, 0x1F80u, 0x3FC0u, 0x3FE0u, 0x3FF8u,
+	0x3FFCu, 0x3FFEu, 0x8005u, 0x3FFFu, 0x0004u, 0x3F9Fu, 0x3F8Fu, 0x3F87u,
+	0x3F83u, 0x8002u, 0x3F81u, 0x0003u, 0x3F87u, 0x3F8Fu, 0x3F9Fu, 0x8005u,
+	0x3FFFu, 0x0006u, 0x3FFEu, 0x3FFCu, 0x3FF8u, 0x3FF0u, 0x3FE0u, 0x3FC0u,
+	0x800Bu, 0x3F80u, 0x0002u, 0x1F00u, 0x0600u,
+
+	/* Column 23 */
+	0x8050u, 0x0000u, 0x0011u, 0x0001u, 0x0003u, 0x0007u, 0x000Fu, 0x003Fu,
+	0x807Fu, 0xE0FFu, 0xF1FFu, 0xFBFFu, 0xFFFFu, 0xFFFEu, 0xFFFCu, 0xFFF0u,
+	0xFFE0u, 0xFFF0u, 0xFFF8u, 0xFFFCu, 0x8002u, 0xFFFFu, 0x0008u, 0xF3FFu,
+	0xE0FFu, 0xC07Fu, 0x803Fu, 0x001Fu, 0x000Fu, 0x0007u, 0x0001u, 0x800Fu,
+	0x0000u,
+
+	/* Column 24 */
+	0x804Du, 0x0000u, 0x0002u, 0x1E00u, 0x7F00u, 0x800Au, 0xFF00u, 0x8009u,
+	0x7F00u, 0x8006u, 0xFF00u, 0x8002u, 0xFF01u, 0x8002u, 0xFF03u, 0x8002u,
+	0x7F07u, 0x8002u, 0x7F0Fu, 0x8002u, 0x7F1Fu, 0x8002u, 0x7F3Fu, 0x8003u,
+	0x7FFFu, 0x0003u, 0x3F7Fu, 0x3E3Eu, 0x0C08u,
+
+	/* Column 25 */
+	0x804Du, 0x0000u, 0x0002u, 0x0003u, 0x0007u, 0x8002u, 0x000Fu, 0x8002u,
+	0x001Fu, 0x8002u, 0x003Fu, 0x8002u, 0x007Fu, 0x8002u, 0x00FFu, 0x0006u,
+	0x01FFu, 0x01FEu, 0x03FEu, 0x03FCu, 0x07FCu, 0x07F8u, 0x8002u, 0x0FF0u,
+	0x8002u, 0x1FE0u, 0x0001u, 0x3FC0u, 0x8002u, 0x7FC0u, 0x0002u, 0xFFC0u,
+	0xFFE0u, 0x8002u, 0xFFF0u, 0x0001u, 0xFFF8u, 0x8002u, 0xFFFCu, 0x000Du,
+	0xFBFEu, 0xF9FFu, 0xF1FFu, 0xF0FFu, 0xE07Fu, 0xC07Fu, 0xC03Fu, 0x801Fu,
+	0x800Fu, 0x000Fu, 0x0007u, 0x0003u, 0x0000u,
+
+	/* Column 26 */
+	0x804Du, 0x0000u, 0x0002u, 0xC000u, 0xE000u, 0x8002u, 0xF000u, 0x8002u,
+	0xF800u, 0x0001u, 0xFC00u, 0x8002u, 0xFE00u, 0x8002u, 0xFF00u, 0x000Au,
+	0xFF80u, 0x7F80u, 0x7FC0u, 0x3FC0u, 0x3FE0u, 0x1FE0u, 0x1FF0u, 0x0FF0u,
+	0x0FF8u, 0x07F8u, 0x8002u, 0x03FCu, 0x0003u, 0x01FEu, 0x01FFu, 0x03FFu,
+	0x8002u, 0x07FFu, 0x0001u, 0x0FFFu, 0x8002u, 0x1FFFu, 0x0004u, 0x3FFFu,
+	0x7FDFu, 0x7FCFu, 0xFF8Fu, 0x8002u, 0xFF07u, 0x0001u, 0xFE03u, 0x8002u,
+	0xFC01u, 0x0001u, 0xF800u, 0x8002u, 0xF000u, 0x0002u, 0xE000u, 0x8000u,
+
+	/* Column 27 */
+	0x804Du, 0x0000u, 0x0002u, 0x007Fu, 0x00FFu, 0x8006u, 0x01FFu, 0x8012u,
+	0x01FCu, 0x8002u, 0x81FCu, 0x8002u, 0xC1FCu, 0x8002u, 0xE1FCu, 0x8002u,
+	0xF1FCu, 0x8002u, 0xF9FCu, 0x0001u, 0xFDFCu, 0x8005u, 0xFFFFu, 0x0003u,
+	0x7FFFu, 0x7EFFu, 0x083Fu,
+
+	/* Column 28 */
+	0x804Du, 0x0000u, 0x0004u, 0xFC00u, 0xFFE0u, 0xFFF8u, 0xFFFEu, 0x8004u,
+	0xFFFFu, 0x0006u, 0x00FFu, 0x001Fu, 0x000Fu, 0x0007u, 0x0003u, 0x0001u,
+	0x8010u, 0x0000u, 0x8002u, 0x0001u, 0x0005u, 0x0003u, 0x0007u, 0x000Fu,
+	0x003Fu, 0x01FFu, 0x8004u, 0xFFFFu, 0x0004u, 0xFFFCu, 0xFFF8u, 0xFFC0u,
+	0xE000u,
+
+	/* Column 29 */
+	0x804Du, 0x0000u, 0x0002u, 0x000Eu, 0x001Fu, 0x8002u, 0x003Fu, 0x0003u,
+	0x803Fu, 0xC03Fu, 0xE03Fu, 0x8002u, 0xF03Fu, 0x0001u, 0xF83Fu, 0x8002u,
+	0xFC3Fu, 0x8003u, 0xFE3Fu, 0x8002u, 0xFF3Fu, 0x8005u, 0x7F3Fu, 0x0001u,
+	0x7FBFu, 0x8005u, 0x7F3Fu, 0x8002u, 0xFF3Fu, 0x8002u, 0xFE3Fu, 0x8003u,
+	0xFC3Fu, 0x0005u, 0xF83Fu, 0xF03Fu, 0xE03Fu, 0xC03Fu, 0x803Fu, 0x8003u,
+	0x003Fu, 0x0002u, 0x001Fu, 0x0007u,
+
+	/* Column 30 */
+	0x804Fu, 0x0000u, 0x0002u, 0x8000u, 0xC000u, 0x8002u, 0xE000u, 0x0001u,
+	0xF000u, 0x8002u, 0xF800u, 0x0002u, 0xFC00u, 0xFE00u, 0x8002u, 0xFF00u,
+	0x0001u, 0xFF80u, 0x8002u, 0xFFC0u, 0x0001u, 0xFFE0u, 0x8002u, 0x9FF0u,
+	0x0001u, 0x8FF8u, 0x8002u, 0x87FCu, 0x0002u, 0x83FEu, 0x81FFu, 0x8002u,
+	0x80FFu, 0x0001u, 0x807Fu, 0x8002u, 0x803Fu, 0x0001u, 0x801Fu, 0x8002u,
+	0x800Fu, 0x0002u, 0x8007u, 0x8003u, 0x8002u, 0x8001u, 0x0001u, 0x8000u,
+	0x8008u, 0xFFFFu,
+
+	/* Column 31 */
+	0x804Du, 0x0000u, 0x0002u, 0x0380u, 0x07C1u, 0x8002u, 0x0FE1u, 0x8014u,
+	0x0FE3u, 0x8002u, 0x8FE3u, 0x0002u, 0xCFE3u, 0xEFE3u, 0x800Du, 0xFFE3u,
+	0x8002u, 0xFFE1u, 0x0002u, 0xFFC0u, 0xFF00u,
+
+	/* Column 32 */
+	0x804Du, 0x0000u, 0x0001u, 0x7FFFu, 0x8007u, 0xFFFFu, 0x0009u, 0xFC01u,
+	0xFC03u, 0xFC07u, 0xFC0Fu, 0xFC1Fu, 0xFC3Fu, 0xFC7Fu, 0xFCFFu, 0xFDFFu,
+	0x8002u, 0xFFFFu, 0x0004u, 0xFFFEu, 0xFFFCu, 0xFFF8u, 0xFFF0u, 0x8008u,
+	0xFFFFu, 0x8006u, 0xFC00u, 0x8007u, 0xFFFFu, 0x0001u, 0x3FFFu,
+
+	/* Column 33 */
+	0x804Du, 0x0000u, 0x0001u, 0xFFC0u, 0x8002u, 0xFFF0u, 0x8002u, 0xFFF8u,
+	0x8002u, 0xFFF0u, 0x000Bu, 0xFFE0u, 0xFFC0u, 0xFF80u, 0xFF00u, 0xFE00u,
+	0xFC00u, 0xF800u, 0xF000u, 0xE000u, 0xC000u, 0x8000u, 0x8005u, 0x0000u,
+	0x0001u, 0xFFC0u, 0x8002u, 0xFFF0u, 0x8002u, 0xFFF8u, 0x8002u, 0xFFF0u,
+	0x0001u, 0xFF80u, 0x8006u, 0x0000u, 0x0001u, 0xFFC0u, 0x8002u, 0xFFF0u,
+	0x8002u, 0xFFF8u, 0x8002u, 0xFFF0u, 0x0001u, 0xFF80u,
+
+	/* Column 34 */
+	0x804Du, 0x0000u, 0x0006u, 0x0007u, 0x003Fu, 0x00FFu, 0x03FFu, 0x07FFu,
+	0x0FFFu, 0x8002u, 0x1FFFu, 0x0009u, 0x3FF0u, 0x3FE1u, 0x7FC3u, 0x7F87u,
+	0x7F0Fu, 0x7F1Fu, 0xFF3Fu, 0xFF7Fu, 0xFFFFu, 0x8002u, 0x7FFFu, 0x0013u,
+	0x7FFEu, 0x7FFCu, 0x3FF8u, 0x1FF0u, 0x1FF8u, 0x0FFCu, 0x07FEu, 0x03FFu,
+	0x01FFu, 0x00FFu, 0x007Fu, 0x003Fu, 0x001Fu, 0x000Fu, 0x0007u, 0x0003u,
+	0x0001u, 0x0000u, 0x1FFFu, 0x8002u, 0x7FFFu, 0x8002u, 0xFFFFu, 0x0003u,
+	0x7FFFu, 0x3FFFu, 0x0FFFu,
+
+	/* Column 35 */
+	0x804Du, 0x0000u, 0x0002u, 0xFFE0u, 0xFFF0u, 0x8003u, 0xFFF8u, 0x8002u,
+	0xFFF0u, 0x000Bu, 0xFFE0u, 0xFFC0u, 0xFF80u, 0xFF00u, 0xFE00u, 0xFC00u,
+	0xF800u, 0xF000u, 0xE000u, 0xC000u, 0x8000u, 0x8009u, 0x0000u, 0x000Cu,
+	0xC000u, 0xE000u, 0xF000u, 0xF800u, 0xFC00u, 0xFE00u, 0xFF00u, 0xFF80u,
+	0xFFC0u, 0xFFE0u, 0xFFF0u, 0xFFF8u, 0x8004u, 0xFFFCu, 0x0002u, 0xFFF8u,
+	0xFFE0u,
+
+	/* Column 36 */
+	0x804Du, 0x0000u, 0x0006u, 0x0007u, 0x003Fu, 0x00FFu, 0x03FFu, 0x07FFu,
+	0x0FFFu, 0x8002u, 0x1FFFu, 0x0009u, 0x3FF0u, 0x3FE1u, 0x7FC3u, 0x7F87u,
+	0x7F0Fu, 0x7F1Fu, 0xFF3Fu, 0xFF7Fu, 0xFFFFu, 0x8002u, 0x7FFFu, 0x0013u,
+	0x7FFEu, 0x7FFCu, 0x3FF8u, 0x1FF0u, 0x1FF8u, 0x0FFCu, 0x07FEu, 0x03FFu,
+	0x01FFu, 0x00FFu, 0x007Fu, 0x003Fu, 0x001Fu, 0x000Fu, 0x0007u, 0x0003u,
+	0x0001u, 0x0000u, 0x1FFFu, 0x8002u, 0x7FFFu, 0x8002u, 0xFFFFu, 0x0003u,
+	0x7FFFu, 0x3FFFu, 0x0FFFu,
+
+	/* Column 37 */
+	0x804Du, 0x0000u, 0x0002u, 0xFFE0u, 0xFFF0u, 0x8003u, 0xFFF8u, 0x8002u,
+	0xFFF0u, 0x000Bu, 0xFFE0u, 0xFFC0u, 0xFF80u, 0xFF00u, 0xFE00u, 0xFC00u,
+	0xF800u, 0xF000u, 0xE000u, 0xC000u, 0x8000u, 0x8009u, 0x0000u, 0x000Cu,
+	0xC000u, 0xE000u, 0xF000u, 0xF800u, 0xFC00u, 0xFE00u, 0xFF00u, 0xFF80u,
+	0xFFC0u, 0xFFE0u, 0xFFF0u, 0xFFF8u, 0x8004u, 0xFFFCu, 0x0002u, 0xFFF8u,
+	0xFFE0u,
+
+	/* Column 38 */
+	0x807Au, 0x0000u
 };
 
 const UINT32 trackCell[TRACK_CELL_HEIGHT] =
@@ -1755,6 +964,69 @@ const UINT32 spikeCell[SPIKE_CELL_HEIGHT] =
 	0x80000001u, 0xC8882223u, 0x80000001u, 0xFFFFFFFFu
 };
 
+/**
+ * @brief Builds the masked versions of the player, car and train bitmaps (see
+ * plot_masked32()).
+ * @details The player is masked by its alpha bitmap, while the car and train
+ * are masked by the area that used to be cleared before they were plotted.
+ */
+void buildMaskedBitmaps(void)
+{
+	int orientIndex;
+	int row;
+
+	for (orientIndex = 0; orientIndex < NUM_ORIENTATIONS; orientIndex++)
+	{
+		for (row = 0; row < PLAYER_HEIGHT; row++)
+		{
+			playerMaskedBitmap[orientIndex][row * MASKED_ROW_LONGS] =
+				~playerAlpha[orientIndex][row];
+			playerMaskedBitmap[orientIndex][row * MASKED_ROW_LONGS + 1] =
+				playerBitmap[orientIndex][row];
+		}
+	}
+
+	for (orientIndex = 0; orientIndex < NUM_HORZ_ORIENTATIONS; orientIndex++)
+	{
+		fillMasked(carMaskedBitmap[orientIndex], carBitmap[orientIndex],
+				   CAR_HEIGHT, 0xFFFFFFFFu, CAR_Y_OFFSET, CAR_SMALLEST_HEIGHT);
+	}
+
+	fillMasked(trainMaskedBitmap[0], trainBitmap[0], TRAIN_HEIGHT,
+			   0xFFFFFFFFu >> TRAIN_X_OFFSET, TRAIN_Y_OFFSET,
+			   TRAIN_SMALLEST_HEIGHT);
+	fillMasked(trainMaskedBitmap[1], trainBitmap[1], TRAIN_HEIGHT, 0xFFFFFFFFu,
+			   TRAIN_Y_OFFSET, TRAIN_SMALLEST_HEIGHT);
+	fillMasked(trainMaskedBitmap[2], trainBitmap[2], TRAIN_HEIGHT,
+			   0xFFFFFFFFu << (TRAIN_PART_LEN - TRAIN_LAST_PART_LEN),
+			   TRAIN_Y_OFFSET, TRAIN_SMALLEST_HEIGHT);
+
+	maskedBuilt = TRUE;
+}
+
+/**
+ * @brief Builds a masked bitmap whose mask covers a band of rows.
+ * 
+ * @param masked The location in memory to build the masked bitmap in.
+ * @param image The bitmap to build the masked bitmap from.
+ * @param height The height of the bitmap.
+ * @param clrMask The mask of each row in the band.
+ * @param clrY The first row of the band.
+ * @param clrHeight The number of rows in the band.
+ */
+void fillMasked(UINT32 *masked, const UINT32 *image, int height,
+				UINT32 clrMask, int clrY, int clrHeight)
+{
+	int row;
+
+	for (row = 0; row < height; row++)
+	{
+		masked[row * MASKED_ROW_LONGS] =
+			(row >= clrY && row < clrY + clrHeight) ? clrMask : 0;
+		masked[row * MASKED_ROW_LONGS + 1] = image[row];
+	}
+}
+
 const void *getBlockyBitmap(int size, void *dest)
 {
 	const void *returnAddr;
@@ -1801,6 +1073,33 @@ const UINT32 *getCarBitmap(Direction orientation, UINT32 *dest)
 
 	return returnAddr;
 }
+
+const UINT32 *getCarMasked(Direction orientation, UINT32 *dest)
+{
+	const UINT32 *returnAddr = NULL;
+	int orientIndex;
+
+	getOrientIndex(orientation, orientIndex);
+
+	if (!maskedBuilt)
+	{
+		buildMaskedBitmaps();
+	}
+
+	if (orientIndex >= 0 && orientIndex < NUM_HORZ_ORIENTATIONS)
+	{
+		returnAddr = carMaskedBitmap[orientIndex];
+
+		if (dest != NULL)
+		{
+			memcpy(dest, returnAddr,
+				   CAR_HEIGHT * MASKED_ROW_LONGS * UINT32_BYTES);
+		}
+	}
+
+	return returnAddr;
+}
+
 const UINT32 *getACollectBitmap(UINT32 *dest)
 {
 	const UINT32 *returnAddr = collectableABitmap;
@@ -1857,28 +1156,9 @@ const UINT32 *getFeathersBitmap(Direction orientation, UINT32 *dest)
 	return returnAddr;
 }
 
-const UINT32 *getGameOverBitmap(UINT32 *dest)
+const UINT16 *getGameOverRle(void)
 {
-	const UINT32 *returnAddr;
-
-	if (goverCurrPart >= NUM_GAME_OVER_PARTS)
-	{
-		goverCurrPart = 0;
-		returnAddr = NULL;
-	}
-	else
-	{
-		returnAddr = gameOverBitmap[goverCurrPart];
-
-		if (dest != NULL)
-		{
-			memcpy(dest, returnAddr, GAME_OVER_HEIGHT * UINT32_BYTES);
-		}
-
-		goverCurrPart++;
-	}
-
-	return returnAddr;
+	return gameOverRle;
 }
 
 const UINT32 *getGrassBitmap(UINT32 *dest)
@@ -1957,6 +1237,32 @@ const UINT32 *getPlayerBitmap(Direction orientation, UINT32 *dest)
 	return returnAddr;
 }
 
+const UINT32 *getPlayerMasked(Direction orientation, UINT32 *dest)
+{
+	const UINT32 *returnAddr = NULL;
+	int orientIndex;
+
+	getOrientIndex(orientation, orientIndex);
+
+	if (!maskedBuilt)
+	{
+		buildMaskedBitmaps();
+	}
+
+	if (orientIndex >= 0 && orientIndex < NUM_ORIENTATIONS)
+	{
+		returnAddr = playerMaskedBitmap[orientIndex];
+
+		if (dest != NULL)
+		{
+			memcpy(dest, returnAddr,
+				   PLAYER_HEIGHT * MASKED_ROW_LONGS * UINT32_BYTES);
+		}
+	}
+
+	return returnAddr;
+}
+
 const UINT32 *getRoadBitmap(UINT32 *dest)
 {
 	const UINT32 *returnAddr = roadCell;
@@ -1981,28 +1287,9 @@ const UINT32 *getSpikeBitmap(UINT32 *dest)
 	return returnAddr;
 }
 
-const UINT32 *getTitleBitmap(UINT32 *dest)
+const UINT16 *getTitleRle(void)
 {
-	const UINT32 *returnAddr;
-
-	if (titleCurrPart >= NUM_TITLE_PARTS)
-	{
-		titleCurrPart = 0;
-		returnAddr = NULL;
-	}
-	else
-	{
-		returnAddr = titleBitmap[titleCurrPart];
-
-		if (dest != NULL)
-		{
-			memcpy(dest, returnAddr, TITLE_HEIGHT * UINT32_BYTES);
-		}
-
-		titleCurrPart++;
-	}
-
-	return returnAddr;
+	return titleRle;
 }
 
 const UINT32 *getTrackBitmap(UINT32 *dest)
@@ -2038,5 +1325,35 @@ const UINT32 *getTrainBitmap(UINT32 *dest)
 		trainCurrPart++;
 	}
 
+	return returnAddr;
+}
+
+const UINT32 *getTrainMasked(UINT32 *dest)
+{
+	const UINT32 *returnAddr;
+
+	if (!maskedBuilt)
+	{
+		buildMaskedBitmaps();
+	}
+
+	if (trainMaskedCurrPart >= NUM_TRAIN_PARTS)
+	{
+		trainMaskedCurrPart = 0;
+		returnAddr = NULL;
+	}
+	else
+	{
+		returnAddr = trainMaskedBitmap[trainMaskedCurrPart];
+
+		if (dest != NULL)
+		{
+			memcpy(dest, returnAddr,
+				   TRAIN_HEIGHT * MASKED_ROW_LONGS * UINT32_BYTES);
+		}
+
+		trainMaskedCurrPart++;
+	}
+
 	return returnAddr;
 }
\ No newline at end of file
@@ -37,9 +37,8 @@
 #define FEATHERS_HEIGHT 32
 #define FEATHERS_LEN 32
 
-#define GAME_OVER_HEIGHT     66
-#define NUM_GAME_OVER_PARTS  15
-#define GAME_OVER_PART_LEN 32
+#define GAME_OVER_HEIGHT 66
+#define GAME_OVER_LEN    480
 
 #define GRASS_CELL_HEIGHT 32
 #define GRASS_CELL_LEN 32
@@ -50,9 +49,8 @@
 #define ROAD_CELL_HEIGHT 32
 #define ROAD_CELL_LEN 32
 
-#define TITLE_HEIGHT     122
-#define NUM_TITLE_PARTS   19
-#define TITLE_PART_LEN  32
+#define TITLE_HEIGHT 122
+#define TITLE_LEN    608
 
 #define SPIKE_CELL_HEIGHT 32
 #define SPIKE_CELL_LEN 32
@@ -120,6 +118,19 @@ const void *getBlockyBitmap(int size, void *dest);
  */
 const UINT32 *getCarBitmap(Direction orientation, UINT32 *dest);
 
+/**
+ * @brief Returns the masked version of the car bitmap (see plot_masked32()).
+ * @details The mask covers the body of the car so that whatever was behind it
+ * is cleared as it is plotted. A copy of the array will also be returned in
+ * dest unless dest is NULL.
+ * 
+ * @param orientation The orientation of the car desired (M_EAST, M_WEST).
+ * @param dest The location in memory to copy the bitmap to. Can be NULL.
+ * @return The address of UINT32 values representing the masked car. Will be
+ * NULL if the orientation is invalid.
+ */
+const UINT32 *getCarMasked(Direction orientation, UINT32 *dest);
+
 /**
  * @brief Returns an array of UINT32 resembling a letter grade A in a circle.
  * @details A copy of the array will also be returned in dest unless dest is
@@ -163,18 +174,15 @@ const UINT32 *getCCollectBitmap(UINT32 *dest);
 const UINT32 *getFeathersBitmap(Direction orientation, UINT32 *dest);
 
 /**
- * @brief Returns an array of UINT32 resembling the "Game Over" text.
- * @details A copy of the array will also be returned in dest unless dest is
- * NULL. The bitmap is split up into multiple pieces. This function will keep
- * on getting the next piece until there are no more pieces to given, in which
- * case it will return NULL. It will then repeat with the first part of the
- * bitmap.
+ * @brief Returns the "Game Over" text compressed into run-length encoded
+ * columns.
+ * @details The text is GAME_OVER_LEN pixels wide and GAME_OVER_HEIGHT pixels
+ * high. It is to be plotted with surf_plot_rle(), which decodes it straight
+ * onto the screen.
  * 
- * @param dest The location in memory to copy the bitmap to. Can be NULL.
- * @return The address of UINT32 values representing the "Game Over" text.
- * Will be NULL if all the parts of the bitmap have been exhausted.
+ * @return The address of the encoded "Game Over" text.
  */
-const UINT32 *getGameOverBitmap(UINT32 *dest);
+const UINT16 *getGameOverRle(void);
 
 /**
  * @brief Returns an array of UINT32 resembling grass.
@@ -232,6 +240,19 @@ const UINT32 *getPlayerAlpha(Direction orientation, UINT32 *dest);
  */
 const UINT32 *getPlayerBitmap(Direction orientation, UINT32 *dest);
 
+/**
+ * @brief Returns the masked version of the player bitmap (see plot_masked32()).
+ * @details The mask is the inverse of the player alpha mask. A copy of the
+ * array will also be returned in dest unless dest is NULL.
+ * 
+ * @param orientation The orientation of the player desired
+ * (M_EAST, M_WEST, M_NORTH, M_SOUTH).
+ * @param dest The location in memory to copy the bitmap to. Can be NULL.
+ * @return The address of UINT32 values representing the masked player.
+ * Will be NULL if the orientation is invalid.
+ */
+const UINT32 *getPlayerMasked(Direction orientation, UINT32 *dest);
+
 /**
  * @brief Returns an array of UINT32 resembling road.
  * @details A copy of the array will also be returned in dest unless dest is
@@ -253,18 +274,14 @@ const UINT32 *getRoadBitmap(UINT32 *dest);
 const UINT32 *getSpikeBitmap(UINT32 *dest);
 
 /**
- * @brief Returns an array of UINT32 resembling the title text.
- * @details A copy of the array will also be returned in dest unless dest is
- * NULL. The bitmap is split up into multiple pieces. This function will keep
- * on getting the next piece until there are no more pieces to given, in which
- * case it will return NULL. It will then repeat with the first part of the
- * bitmap.
+ * @brief Returns the title text compressed into run-length encoded columns.
+ * @details The text is TITLE_LEN pixels wide and TITLE_HEIGHT pixels high. It
+ * is to be plotted with surf_plot_rle(), which decodes it straight onto the
+ * screen.
  * 
- * @param dest The location in memory to copy the bitmap to. Can be NULL.
- * @return The address of UINT32 values representing the title text. Will be
- * NULL if all the parts of the bitmap have been exhausted.
+ * @return The address of the encoded title text.
  */
-const UINT32 *getTitleBitmap(UINT32 *dest);
+const UINT16 *getTitleRle(void);
 
 /**
  * @brief Returns an array of UINT32 resembling a train track.
@@ -290,4 +307,18 @@ const UINT32 *getTrackBitmap(UINT32 *dest);
  */
 const UINT32 *getTrainBitmap(UINT32 *dest);
 
+/**
+ * @brief Returns the masked version of the train bitmap (see plot_masked32()).
+ * @details The mask covers the body of the train so that whatever was behind it
+ * is cleared as it is plotted. A copy of the array will also be returned in
+ * dest unless dest is NULL. Like getTrainBitmap(), this function will keep on
+ * getting the next piece until there are no more pieces to given, in which
+ * case it will return NULL.
+ * 
+ * @param dest The location in memory to copy the bitmap to. Can be NULL.
+ * @return The address of UINT32 values representing a masked train. Will be
+ * NULL if all the parts of the bitmap have been exhausted.
+ */
+const UINT32 *getTrainMasked(UINT32 *dest);
+
 #endif
\ No newline at end of file
@@ -3,6 +3,12 @@
  * @author Academia Team
  * @brief Contains a macro designed to identify the CPU being targeted at
  * build time.
+ * @details M68K_CPU is defined unless HOST_CPU is defined at build time (e.g.
+ * with -DHOST_CPU), as it is by the host target of the MAKEFILE for headless
+ * renders. The portable C versions of the routines written in assembly are
+ * then built instead. Their fills are done 128 bits at a time with SSE2 (or 256
+ * bits at a time with AVX2) whenever the compiler targets it (e.g. with -msse2
+ * or -mavx2).
  * 
  * @copyright Copyright Academia Team 2023
  */
@@ -10,6 +16,8 @@
 #ifndef CPU_H
 #define CPU_H
 
+#ifndef HOST_CPU
 #define M68K_CPU
+#endif
 
 #endif
@@ -0,0 +1,680 @@
+/**
+ * @file cspr.c
+ * @author Academia Team
+ * @brief Contains the portable versions of the compiled sprites.
+ * @note Generated by spr_gen from the bitmaps in bitmaps.c. Do not edit.
+ * 
+ * @copyright Copyright Academia Team 2023
+ */
+
+#include "cpu.h"
+#include "cspr.h"
+#include "endian.h"
+#include "scrn.h"
+
+#ifndef M68K_CPU
+
+void cspr_grass(UINT16* const dest)
+{
+	dest[0] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[1] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[40] = (UINT16)swap16OnLE(0xC222u);
+	dest[41] = (UINT16)swap16OnLE(0x2223u);
+	dest[80] = (UINT16)swap16OnLE(0x8000u);
+	dest[81] = (UINT16)swap16OnLE(0x0001u);
+	dest[120] = (UINT16)swap16OnLE(0x8888u);
+	dest[121] = (UINT16)swap16OnLE(0x8889u);
+	dest[160] = (UINT16)swap16OnLE(0x8000u);
+	dest[161] = (UINT16)swap16OnLE(0x0001u);
+	dest[200] = (UINT16)swap16OnLE(0xC222u);
+	dest[201] = (UINT16)swap16OnLE(0x2223u);
+	dest[240] = (UINT16)swap16OnLE(0x8000u);
+	dest[241] = (UINT16)swap16OnLE(0x0001u);
+	dest[280] = (UINT16)swap16OnLE(0xC8A8u);
+	dest[281] = (UINT16)swap16OnLE(0xA8A9u);
+	dest[320] = (UINT16)swap16OnLE(0x8000u);
+	dest[321] = (UINT16)swap16OnLE(0x0001u);
+	dest[360] = (UINT16)swap16OnLE(0xC222u);
+	dest[361] = (UINT16)swap16OnLE(0x2223u);
+	dest[400] = (UINT16)swap16OnLE(0x8000u);
+	dest[401] = (UINT16)swap16OnLE(0x0001u);
+	dest[440] = (UINT16)swap16OnLE(0x8888u);
+	dest[441] = (UINT16)swap16OnLE(0x8889u);
+	dest[480] = (UINT16)swap16OnLE(0x8000u);
+	dest[481] = (UINT16)swap16OnLE(0x0001u);
+	dest[520] = (UINT16)swap16OnLE(0xC222u);
+	dest[521] = (UINT16)swap16OnLE(0x2223u);
+	dest[560] = (UINT16)swap16OnLE(0x8000u);
+	dest[561] = (UINT16)swap16OnLE(0x0001u);
+	dest[600] = (UINT16)swap16OnLE(0xC8A8u);
+	dest[601] = (UINT16)swap16OnLE(0xA8A9u);
+	dest[640] = (UINT16)swap16OnLE(0x8000u);
+	dest[641] = (UINT16)swap16OnLE(0x0001u);
+	dest[680] = (UINT16)swap16OnLE(0xC222u);
+	dest[681] = (UINT16)swap16OnLE(0x2223u);
+	dest[720] = (UINT16)swap16OnLE(0x8000u);
+	dest[721] = (UINT16)swap16OnLE(0x0001u);
+	dest[760] = (UINT16)swap16OnLE(0x8888u);
+	dest[761] = (UINT16)swap16OnLE(0x8889u);
+	dest[800] = (UINT16)swap16OnLE(0x8000u);
+	dest[801] = (UINT16)swap16OnLE(0x0001u);
+	dest[840] = (UINT16)swap16OnLE(0xC222u);
+	dest[841] = (UINT16)swap16OnLE(0x2223u);
+	dest[880] = (UINT16)swap16OnLE(0x8000u);
+	dest[881] = (UINT16)swap16OnLE(0x0001u);
+	dest[920] = (UINT16)swap16OnLE(0xC8A8u);
+	dest[921] = (UINT16)swap16OnLE(0xA8A9u);
+	dest[960] = (UINT16)swap16OnLE(0x8000u);
+	dest[961] = (UINT16)swap16OnLE(0x0001u);
+	dest[1000] = (UINT16)swap16OnLE(0xC222u);
+	dest[1001] = (UINT16)swap16OnLE(0x2223u);
+	dest[1040] = (UINT16)swap16OnLE(0x8000u);
+	dest[1041] = (UINT16)swap16OnLE(0x0001u);
+	dest[1080] = (UINT16)swap16OnLE(0x8888u);
+	dest[1081] = (UINT16)swap16OnLE(0x8889u);
+	dest[1120] = (UINT16)swap16OnLE(0x8000u);
+	dest[1121] = (UINT16)swap16OnLE(0x0001u);
+	dest[1160] = (UINT16)swap16OnLE(0xC222u);
+	dest[1161] = (UINT16)swap16OnLE(0x2223u);
+	dest[1200] = (UINT16)swap16OnLE(0x8000u);
+	dest[1201] = (UINT16)swap16OnLE(0x0001u);
+	dest[1240] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[1241] = (UINT16)swap16OnLE(0xFFFFu);
+}
+
+void cspr_hedge(UINT16* const dest)
+{
+	dest[0] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[1] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[40] = (UINT16)swap16OnLE(0xAAAAu);
+	dest[41] = (UINT16)swap16OnLE(0xAAABu);
+	dest[80] = (UINT16)swap16OnLE(0xD555u);
+	dest[81] = (UINT16)swap16OnLE(0x5555u);
+	dest[120] = (UINT16)swap16OnLE(0xAAAAu);
+	dest[121] = (UINT16)swap16OnLE(0xAAABu);
+	dest[160] = (UINT16)swap16OnLE(0xD151u);
+	dest[161] = (UINT16)swap16OnLE(0x5151u);
+	dest[200] = (UINT16)swap16OnLE(0xAAAAu);
+	dest[201] = (UINT16)swap16OnLE(0xAAABu);
+	dest[240] = (UINT16)swap16OnLE(0xD555u);
+	dest[241] = (UINT16)swap16OnLE(0x5555u);
+	dest[280] = (UINT16)swap16OnLE(0xAAAAu);
+	dest[281] = (UINT16)swap16OnLE(0xAAABu);
+	dest[320] = (UINT16)swap16OnLE(0x9515u);
+	dest[321] = (UINT16)swap16OnLE(0x1515u);
+	dest[360] = (UINT16)swap16OnLE(0xAAAAu);
+	dest[361] = (UINT16)swap16OnLE(0xAAABu);
+	dest[400] = (UINT16)swap16OnLE(0xD555u);
+	dest[401] = (UINT16)swap16OnLE(0x5555u);
+	dest[440] = (UINT16)swap16OnLE(0xAAAAu);
+	dest[441] = (UINT16)swap16OnLE(0xAAABu);
+	dest[480] = (UINT16)swap16OnLE(0xD151u);
+	dest[481] = (UINT16)swap16OnLE(0x5151u);
+	dest[520] = (UINT16)swap16OnLE(0xAAAAu);
+	dest[521] = (UINT16)swap16OnLE(0xAAABu);
+	dest[560] = (UINT16)swap16OnLE(0xD555u);
+	dest[561] = (UINT16)swap16OnLE(0x5555u);
+	dest[600] = (UINT16)swap16OnLE(0xAAAAu);
+	dest[601] = (UINT16)swap16OnLE(0xAAABu);
+	dest[640] = (UINT16)swap16OnLE(0x9515u);
+	dest[641] = (UINT16)swap16OnLE(0x1515u);
+	dest[680] = (UINT16)swap16OnLE(0xAAAAu);
+	dest[681] = (UINT16)swap16OnLE(0xAAABu);
+	dest[720] = (UINT16)swap16OnLE(0xD555u);
+	dest[721] = (UINT16)swap16OnLE(0x5555u);
+	dest[760] = (UINT16)swap16OnLE(0xAAAAu);
+	dest[761] = (UINT16)swap16OnLE(0xAAABu);
+	dest[800] = (UINT16)swap16OnLE(0xD151u);
+	dest[801] = (UINT16)swap16OnLE(0x5151u);
+	dest[840] = (UINT16)swap16OnLE(0xAAAAu);
+	dest[841] = (UINT16)swap16OnLE(0xAAABu);
+	dest[880] = (UINT16)swap16OnLE(0xD555u);
+	dest[881] = (UINT16)swap16OnLE(0x5555u);
+	dest[920] = (UINT16)swap16OnLE(0xAAAAu);
+	dest[921] = (UINT16)swap16OnLE(0xAAABu);
+	dest[960] = (UINT16)swap16OnLE(0x9515u);
+	dest[961] = (UINT16)swap16OnLE(0x1515u);
+	dest[1000] = (UINT16)swap16OnLE(0xAAAAu);
+	dest[1001] = (UINT16)swap16OnLE(0xAAABu);
+	dest[1040] = (UINT16)swap16OnLE(0xD555u);
+	dest[1041] = (UINT16)swap16OnLE(0x5555u);
+	dest[1080] = (UINT16)swap16OnLE(0xAAAAu);
+	dest[1081] = (UINT16)swap16OnLE(0xAAABu);
+	dest[1120] = (UINT16)swap16OnLE(0xD151u);
+	dest[1121] = (UINT16)swap16OnLE(0x5151u);
+	dest[1160] = (UINT16)swap16OnLE(0xAAAAu);
+	dest[1161] = (UINT16)swap16OnLE(0xAAABu);
+	dest[1200] = (UINT16)swap16OnLE(0xD555u);
+	dest[1201] = (UINT16)swap16OnLE(0x5555u);
+	dest[1240] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[1241] = (UINT16)swap16OnLE(0xFFFFu);
+}
+
+void cspr_road(UINT16* const dest)
+{
+	dest[0] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[1] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[40] = (UINT16)swap16OnLE(0x8000u);
+	dest[41] = (UINT16)swap16OnLE(0x0001u);
+	dest[80] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[81] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[120] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[121] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[160] = (UINT16)swap16OnLE(0x8000u);
+	dest[161] = (UINT16)swap16OnLE(0x0001u);
+	dest[200] = (UINT16)swap16OnLE(0x8000u);
+	dest[201] = (UINT16)swap16OnLE(0x0001u);
+	dest[240] = (UINT16)swap16OnLE(0x8000u);
+	dest[241] = (UINT16)swap16OnLE(0x0001u);
+	dest[280] = (UINT16)swap16OnLE(0x8000u);
+	dest[281] = (UINT16)swap16OnLE(0x0001u);
+	dest[320] = (UINT16)swap16OnLE(0x8000u);
+	dest[321] = (UINT16)swap16OnLE(0x0001u);
+	dest[360] = (UINT16)swap16OnLE(0x8000u);
+	dest[361] = (UINT16)swap16OnLE(0x0001u);
+	dest[400] = (UINT16)swap16OnLE(0x8000u);
+	dest[401] = (UINT16)swap16OnLE(0x0001u);
+	dest[440] = (UINT16)swap16OnLE(0x8000u);
+	dest[441] = (UINT16)swap16OnLE(0x0001u);
+	dest[480] = (UINT16)swap16OnLE(0x8000u);
+	dest[481] = (UINT16)swap16OnLE(0x0001u);
+	dest[520] = (UINT16)swap16OnLE(0x8000u);
+	dest[521] = (UINT16)swap16OnLE(0x0001u);
+	dest[560] = (UINT16)swap16OnLE(0x8000u);
+	dest[561] = (UINT16)swap16OnLE(0x0001u);
+	dest[600] = (UINT16)swap16OnLE(0x9B6Du);
+	dest[601] = (UINT16)swap16OnLE(0xB6D9u);
+	dest[640] = (UINT16)swap16OnLE(0x8000u);
+	dest[641] = (UINT16)swap16OnLE(0x0001u);
+	dest[680] = (UINT16)swap16OnLE(0x8000u);
+	dest[681] = (UINT16)swap16OnLE(0x0001u);
+	dest[720] = (UINT16)swap16OnLE(0x8000u);
+	dest[721] = (UINT16)swap16OnLE(0x0001u);
+	dest[760] = (UINT16)swap16OnLE(0x8000u);
+	dest[761] = (UINT16)swap16OnLE(0x0001u);
+	dest[800] = (UINT16)swap16OnLE(0x8000u);
+	dest[801] = (UINT16)swap16OnLE(0x0001u);
+	dest[840] = (UINT16)swap16OnLE(0x8000u);
+	dest[841] = (UINT16)swap16OnLE(0x0001u);
+	dest[880] = (UINT16)swap16OnLE(0x8000u);
+	dest[881] = (UINT16)swap16OnLE(0x0001u);
+	dest[920] = (UINT16)swap16OnLE(0x8000u);
+	dest[921] = (UINT16)swap16OnLE(0x0001u);
+	dest[960] = (UINT16)swap16OnLE(0x8000u);
+	dest[961] = (UINT16)swap16OnLE(0x0001u);
+	dest[1000] = (UINT16)swap16OnLE(0x8000u);
+	dest[1001] = (UINT16)swap16OnLE(0x0001u);
+	dest[1040] = (UINT16)swap16OnLE(0x8000u);
+	dest[1041] = (UINT16)swap16OnLE(0x0001u);
+	dest[1080] = (UINT16)swap16OnLE(0x8000u);
+	dest[1081] = (UINT16)swap16OnLE(0x0001u);
+	dest[1120] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[1121] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[1160] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[1161] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[1200] = (UINT16)swap16OnLE(0x8000u);
+	dest[1201] = (UINT16)swap16OnLE(0x0001u);
+	dest[1240] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[1241] = (UINT16)swap16OnLE(0xFFFFu);
+}
+
+void cspr_spike(UINT16* const dest)
+{
+	dest[0] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[1] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[40] = (UINT16)swap16OnLE(0xC888u);
+	dest[41] = (UINT16)swap16OnLE(0x2223u);
+	dest[80] = (UINT16)swap16OnLE(0x8000u);
+	dest[81] = (UINT16)swap16OnLE(0x0001u);
+	dest[120] = (UINT16)swap16OnLE(0x8222u);
+	dest[121] = (UINT16)swap16OnLE(0x8889u);
+	dest[160] = (UINT16)swap16OnLE(0x8000u);
+	dest[161] = (UINT16)swap16OnLE(0x0001u);
+	dest[200] = (UINT16)swap16OnLE(0xC488u);
+	dest[201] = (UINT16)swap16OnLE(0x1223u);
+	dest[240] = (UINT16)swap16OnLE(0x8E1Cu);
+	dest[241] = (UINT16)swap16OnLE(0x3871u);
+	dest[280] = (UINT16)swap16OnLE(0x9F3Eu);
+	dest[281] = (UINT16)swap16OnLE(0x7CF9u);
+	dest[320] = (UINT16)swap16OnLE(0x8E1Cu);
+	dest[321] = (UINT16)swap16OnLE(0x3871u);
+	dest[360] = (UINT16)swap16OnLE(0xC488u);
+	dest[361] = (UINT16)swap16OnLE(0x1223u);
+	dest[400] = (UINT16)swap16OnLE(0x8000u);
+	dest[401] = (UINT16)swap16OnLE(0x0001u);
+	dest[440] = (UINT16)swap16OnLE(0x9222u);
+	dest[441] = (UINT16)swap16OnLE(0x8889u);
+	dest[480] = (UINT16)swap16OnLE(0x8000u);
+	dest[481] = (UINT16)swap16OnLE(0x0001u);
+	dest[520] = (UINT16)swap16OnLE(0xC488u);
+	dest[521] = (UINT16)swap16OnLE(0x1223u);
+	dest[560] = (UINT16)swap16OnLE(0x8E1Cu);
+	dest[561] = (UINT16)swap16OnLE(0x3871u);
+	dest[600] = (UINT16)swap16OnLE(0x9F3Eu);
+	dest[601] = (UINT16)swap16OnLE(0x7CF9u);
+	dest[640] = (UINT16)swap16OnLE(0x8E1Cu);
+	dest[641] = (UINT16)swap16OnLE(0x3871u);
+	dest[680] = (UINT16)swap16OnLE(0xC488u);
+	dest[681] = (UINT16)swap16OnLE(0x1223u);
+	dest[720] = (UINT16)swap16OnLE(0x8000u);
+	dest[721] = (UINT16)swap16OnLE(0x0001u);
+	dest[760] = (UINT16)swap16OnLE(0x9222u);
+	dest[761] = (UINT16)swap16OnLE(0x8889u);
+	dest[800] = (UINT16)swap16OnLE(0x8000u);
+	dest[801] = (UINT16)swap16OnLE(0x0001u);
+	dest[840] = (UINT16)swap16OnLE(0xC488u);
+	dest[841] = (UINT16)swap16OnLE(0x1223u);
+	dest[880] = (UINT16)swap16OnLE(0x8E1Cu);
+	dest[881] = (UINT16)swap16OnLE(0x3871u);
+	dest[920] = (UINT16)swap16OnLE(0x9F3Eu);
+	dest[921] = (UINT16)swap16OnLE(0x7CF9u);
+	dest[960] = (UINT16)swap16OnLE(0x8E1Cu);
+	dest[961] = (UINT16)swap16OnLE(0x3871u);
+	dest[1000] = (UINT16)swap16OnLE(0xC488u);
+	dest[1001] = (UINT16)swap16OnLE(0x1223u);
+	dest[1040] = (UINT16)swap16OnLE(0x8000u);
+	dest[1041] = (UINT16)swap16OnLE(0x0001u);
+	dest[1080] = (UINT16)swap16OnLE(0x9222u);
+	dest[1081] = (UINT16)swap16OnLE(0x8889u);
+	dest[1120] = (UINT16)swap16OnLE(0x8000u);
+	dest[1121] = (UINT16)swap16OnLE(0x0001u);
+	dest[1160] = (UINT16)swap16OnLE(0xC888u);
+	dest[1161] = (UINT16)swap16OnLE(0x2223u);
+	dest[1200] = (UINT16)swap16OnLE(0x8000u);
+	dest[1201] = (UINT16)swap16OnLE(0x0001u);
+	dest[1240] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[1241] = (UINT16)swap16OnLE(0xFFFFu);
+}
+
+void cspr_track(UINT16* const dest)
+{
+	dest[0] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[1] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[40] = (UINT16)swap16OnLE(0x8000u);
+	dest[41] = (UINT16)swap16OnLE(0x0001u);
+	dest[80] = (UINT16)swap16OnLE(0x8000u);
+	dest[81] = (UINT16)swap16OnLE(0x0001u);
+	dest[120] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[121] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[160] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[161] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[200] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[201] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[240] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[241] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[280] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[281] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[320] = (UINT16)swap16OnLE(0x9861u);
+	dest[321] = (UINT16)swap16OnLE(0x8619u);
+	dest[360] = (UINT16)swap16OnLE(0x9861u);
+	dest[361] = (UINT16)swap16OnLE(0x8619u);
+	dest[400] = (UINT16)swap16OnLE(0x9861u);
+	dest[401] = (UINT16)swap16OnLE(0x8619u);
+	dest[440] = (UINT16)swap16OnLE(0x9861u);
+	dest[441] = (UINT16)swap16OnLE(0x8619u);
+	dest[480] = (UINT16)swap16OnLE(0x9861u);
+	dest[481] = (UINT16)swap16OnLE(0x8619u);
+	dest[520] = (UINT16)swap16OnLE(0x9861u);
+	dest[521] = (UINT16)swap16OnLE(0x8619u);
+	dest[560] = (UINT16)swap16OnLE(0x9861u);
+	dest[561] = (UINT16)swap16OnLE(0x8619u);
+	dest[600] = (UINT16)swap16OnLE(0x9861u);
+	dest[601] = (UINT16)swap16OnLE(0x8619u);
+	dest[640] = (UINT16)swap16OnLE(0x9861u);
+	dest[641] = (UINT16)swap16OnLE(0x8619u);
+	dest[680] = (UINT16)swap16OnLE(0x9861u);
+	dest[681] = (UINT16)swap16OnLE(0x8619u);
+	dest[720] = (UINT16)swap16OnLE(0x9861u);
+	dest[721] = (UINT16)swap16OnLE(0x8619u);
+	dest[760] = (UINT16)swap16OnLE(0x9861u);
+	dest[761] = (UINT16)swap16OnLE(0x8619u);
+	dest[800] = (UINT16)swap16OnLE(0x9861u);
+	dest[801] = (UINT16)swap16OnLE(0x8619u);
+	dest[840] = (UINT16)swap16OnLE(0x9861u);
+	dest[841] = (UINT16)swap16OnLE(0x8619u);
+	dest[880] = (UINT16)swap16OnLE(0x9861u);
+	dest[881] = (UINT16)swap16OnLE(0x8619u);
+	dest[920] = (UINT16)swap16OnLE(0x9861u);
+	dest[921] = (UINT16)swap16OnLE(0x8619u);
+	dest[960] = (UINT16)swap16OnLE(0x9861u);
+	dest[961] = (UINT16)swap16OnLE(0x8619u);
+	dest[1000] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[1001] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[1040] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[1041] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[1080] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[1081] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[1120] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[1121] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[1160] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[1161] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[1200] = (UINT16)swap16OnLE(0x8000u);
+	dest[1201] = (UINT16)swap16OnLE(0x0001u);
+	dest[1240] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[1241] = (UINT16)swap16OnLE(0xFFFFu);
+}
+
+void cspr_car_w(UINT16* const dest)
+{
+	dest[320] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[321] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[360] = (UINT16)swap16OnLE(0xE07Fu);
+	dest[361] = (UINT16)swap16OnLE(0xFFE1u);
+	dest[400] = (UINT16)swap16OnLE(0xC0FFu);
+	dest[401] = (UINT16)swap16OnLE(0xFFF9u);
+	dest[440] = (UINT16)swap16OnLE(0x40FFu);
+	dest[441] = (UINT16)swap16OnLE(0xFF99u);
+	dest[480] = (UINT16)swap16OnLE(0xC0F0u);
+	dest[481] = (UINT16)swap16OnLE(0x0019u);
+	dest[520] = (UINT16)swap16OnLE(0xC0F0u);
+	dest[521] = (UINT16)swap16OnLE(0x0019u);
+	dest[560] = (UINT16)swap16OnLE(0x80F0u);
+	dest[561] = (UINT16)swap16OnLE(0x0019u);
+	dest[600] = (UINT16)swap16OnLE(0x80F0u);
+	dest[601] = (UINT16)swap16OnLE(0x0019u);
+	dest[640] = (UINT16)swap16OnLE(0x80F0u);
+	dest[641] = (UINT16)swap16OnLE(0x0019u);
+	dest[680] = (UINT16)swap16OnLE(0x80F0u);
+	dest[681] = (UINT16)swap16OnLE(0x0019u);
+	dest[720] = (UINT16)swap16OnLE(0x80F0u);
+	dest[721] = (UINT16)swap16OnLE(0x0019u);
+	dest[760] = (UINT16)swap16OnLE(0xC0F0u);
+	dest[761] = (UINT16)swap16OnLE(0x0019u);
+	dest[800] = (UINT16)swap16OnLE(0xC0F0u);
+	dest[801] = (UINT16)swap16OnLE(0x0019u);
+	dest[840] = (UINT16)swap16OnLE(0x40FFu);
+	dest[841] = (UINT16)swap16OnLE(0xFFD9u);
+	dest[880] = (UINT16)swap16OnLE(0xC07Fu);
+	dest[881] = (UINT16)swap16OnLE(0xFFF1u);
+	dest[920] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[921] = (UINT16)swap16OnLE(0xFFFFu);
+}
+
+void cspr_car_e(UINT16* const dest)
+{
+	dest[320] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[321] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[360] = (UINT16)swap16OnLE(0x8FFFu);
+	dest[361] = (UINT16)swap16OnLE(0xFE03u);
+	dest[400] = (UINT16)swap16OnLE(0x9BFFu);
+	dest[401] = (UINT16)swap16OnLE(0xFF02u);
+	dest[440] = (UINT16)swap16OnLE(0x9800u);
+	dest[441] = (UINT16)swap16OnLE(0x0F03u);
+	dest[480] = (UINT16)swap16OnLE(0x9800u);
+	dest[481] = (UINT16)swap16OnLE(0x0F03u);
+	dest[520] = (UINT16)swap16OnLE(0x9800u);
+	dest[521] = (UINT16)swap16OnLE(0x0F01u);
+	dest[560] = (UINT16)swap16OnLE(0x9800u);
+	dest[561] = (UINT16)swap16OnLE(0x0F01u);
+	dest[600] = (UINT16)swap16OnLE(0x9800u);
+	dest[601] = (UINT16)swap16OnLE(0x0F01u);
+	dest[640] = (UINT16)swap16OnLE(0x9800u);
+	dest[641] = (UINT16)swap16OnLE(0x0F01u);
+	dest[680] = (UINT16)swap16OnLE(0x9800u);
+	dest[681] = (UINT16)swap16OnLE(0x0F01u);
+	dest[720] = (UINT16)swap16OnLE(0x9800u);
+	dest[721] = (UINT16)swap16OnLE(0x0F03u);
+	dest[760] = (UINT16)swap16OnLE(0x9800u);
+	dest[761] = (UINT16)swap16OnLE(0x0F03u);
+	dest[800] = (UINT16)swap16OnLE(0x99FFu);
+	dest[801] = (UINT16)swap16OnLE(0xFF02u);
+	dest[840] = (UINT16)swap16OnLE(0x9FFFu);
+	dest[841] = (UINT16)swap16OnLE(0xFF03u);
+	dest[880] = (UINT16)swap16OnLE(0x87FFu);
+	dest[881] = (UINT16)swap16OnLE(0xFE07u);
+	dest[920] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[921] = (UINT16)swap16OnLE(0xFFFFu);
+}
+
+void cspr_train1(UINT16* const dest)
+{
+	dest[40] &= (UINT16)swap16OnLE(0xFE00u);
+	dest[40] |= (UINT16)swap16OnLE(0x01FFu);
+	dest[41] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[80] &= (UINT16)swap16OnLE(0xFE00u);
+	dest[80] |= (UINT16)swap16OnLE(0x01FFu);
+	dest[81] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[120] &= (UINT16)swap16OnLE(0xFE00u);
+	dest[120] |= (UINT16)swap16OnLE(0x01FFu);
+	dest[121] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[160] &= (UINT16)swap16OnLE(0xFE00u);
+	dest[160] |= (UINT16)swap16OnLE(0x01FFu);
+	dest[161] = (UINT16)swap16OnLE(0xE018u);
+	dest[200] &= (UINT16)swap16OnLE(0xFE00u);
+	dest[200] |= (UINT16)swap16OnLE(0x01FFu);
+	dest[201] = (UINT16)swap16OnLE(0xE018u);
+	dest[240] &= (UINT16)swap16OnLE(0xFE00u);
+	dest[240] |= (UINT16)swap16OnLE(0x01FFu);
+	dest[241] = (UINT16)swap16OnLE(0x6018u);
+	dest[280] &= (UINT16)swap16OnLE(0xFE00u);
+	dest[280] |= (UINT16)swap16OnLE(0x01FFu);
+	dest[281] = (UINT16)swap16OnLE(0x6018u);
+	dest[320] &= (UINT16)swap16OnLE(0xFE00u);
+	dest[320] |= (UINT16)swap16OnLE(0x01FFu);
+	dest[321] = (UINT16)swap16OnLE(0x6018u);
+	dest[360] &= (UINT16)swap16OnLE(0xFE00u);
+	dest[360] |= (UINT16)swap16OnLE(0x01FFu);
+	dest[361] = (UINT16)swap16OnLE(0x6018u);
+	dest[400] &= (UINT16)swap16OnLE(0xFE00u);
+	dest[400] |= (UINT16)swap16OnLE(0x01FFu);
+	dest[401] = (UINT16)swap16OnLE(0x6018u);
+	dest[440] &= (UINT16)swap16OnLE(0xFE00u);
+	dest[440] |= (UINT16)swap16OnLE(0x01FFu);
+	dest[441] = (UINT16)swap16OnLE(0x6018u);
+	dest[480] &= (UINT16)swap16OnLE(0xFE00u);
+	dest[480] |= (UINT16)swap16OnLE(0x01FFu);
+	dest[481] = (UINT16)swap16OnLE(0x7FFFu);
+	dest[520] &= (UINT16)swap16OnLE(0xFE00u);
+	dest[520] |= (UINT16)swap16OnLE(0x01FFu);
+	dest[521] = (UINT16)swap16OnLE(0x7FFFu);
+	dest[560] &= (UINT16)swap16OnLE(0xFE00u);
+	dest[560] |= (UINT16)swap16OnLE(0x01FFu);
+	dest[561] = (UINT16)swap16OnLE(0x7FFFu);
+	dest[600] &= (UINT16)swap16OnLE(0xFE00u);
+	dest[600] |= (UINT16)swap16OnLE(0x01FFu);
+	dest[601] = (UINT16)swap16OnLE(0x7FFFu);
+	dest[640] &= (UINT16)swap16OnLE(0xFE00u);
+	dest[640] |= (UINT16)swap16OnLE(0x01FFu);
+	dest[641] = (UINT16)swap16OnLE(0x7FFFu);
+	dest[680] &= (UINT16)swap16OnLE(0xFE00u);
+	dest[680] |= (UINT16)swap16OnLE(0x01FFu);
+	dest[681] = (UINT16)swap16OnLE(0x7FFFu);
+	dest[720] &= (UINT16)swap16OnLE(0xFE00u);
+	dest[720] |= (UINT16)swap16OnLE(0x01FFu);
+	dest[721] = (UINT16)swap16OnLE(0x7FFFu);
+	dest[760] &= (UINT16)swap16OnLE(0xFE00u);
+	dest[760] |= (UINT16)swap16OnLE(0x01FFu);
+	dest[761] = (UINT16)swap16OnLE(0x7FFFu);
+	dest[800] &= (UINT16)swap16OnLE(0xFE00u);
+	dest[800] |= (UINT16)swap16OnLE(0x01FFu);
+	dest[801] = (UINT16)swap16OnLE(0x6018u);
+	dest[840] &= (UINT16)swap16OnLE(0xFE00u);
+	dest[840] |= (UINT16)swap16OnLE(0x01FFu);
+	dest[841] = (UINT16)swap16OnLE(0x6018u);
+	dest[880] &= (UINT16)swap16OnLE(0xFE00u);
+	dest[880] |= (UINT16)swap16OnLE(0x01FFu);
+	dest[881] = (UINT16)swap16OnLE(0x6018u);
+	dest[920] &= (UINT16)swap16OnLE(0xFE00u);
+	dest[920] |= (UINT16)swap16OnLE(0x01FFu);
+	dest[921] = (UINT16)swap16OnLE(0x6018u);
+	dest[960] &= (UINT16)swap16OnLE(0xFE00u);
+	dest[960] |= (UINT16)swap16OnLE(0x01FFu);
+	dest[961] = (UINT16)swap16OnLE(0x6018u);
+	dest[1000] &= (UINT16)swap16OnLE(0xFE00u);
+	dest[1000] |= (UINT16)swap16OnLE(0x01FFu);
+	dest[1001] = (UINT16)swap16OnLE(0xE018u);
+	dest[1040] &= (UINT16)swap16OnLE(0xFE00u);
+	dest[1040] |= (UINT16)swap16OnLE(0x01FFu);
+	dest[1041] = (UINT16)swap16OnLE(0xE018u);
+	dest[1080] &= (UINT16)swap16OnLE(0xFE00u);
+	dest[1080] |= (UINT16)swap16OnLE(0x01FFu);
+	dest[1081] = (UINT16)swap16OnLE(0xE018u);
+	dest[1120] &= (UINT16)swap16OnLE(0xFE00u);
+	dest[1120] |= (UINT16)swap16OnLE(0x01FFu);
+	dest[1121] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[1160] &= (UINT16)swap16OnLE(0xFE00u);
+	dest[1160] |= (UINT16)swap16OnLE(0x01FFu);
+	dest[1161] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[1200] &= (UINT16)swap16OnLE(0xFE00u);
+	dest[1200] |= (UINT16)swap16OnLE(0x01FFu);
+	dest[1201] = (UINT16)swap16OnLE(0xFFFFu);
+}
+
+void cspr_train2(UINT16* const dest)
+{
+	dest[40] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[41] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[80] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[81] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[120] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[121] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[160] = (UINT16)swap16OnLE(0x0601u);
+	dest[161] = (UINT16)swap16OnLE(0xF00Cu);
+	dest[200] = (UINT16)swap16OnLE(0x0601u);
+	dest[201] = (UINT16)swap16OnLE(0xF00Cu);
+	dest[240] = (UINT16)swap16OnLE(0x0601u);
+	dest[241] = (UINT16)swap16OnLE(0xF00Cu);
+	dest[280] = (UINT16)swap16OnLE(0x0601u);
+	dest[281] = (UINT16)swap16OnLE(0xB00Cu);
+	dest[320] = (UINT16)swap16OnLE(0x0601u);
+	dest[321] = (UINT16)swap16OnLE(0xB00Cu);
+	dest[360] = (UINT16)swap16OnLE(0x0601u);
+	dest[361] = (UINT16)swap16OnLE(0xB00Cu);
+	dest[400] = (UINT16)swap16OnLE(0x0601u);
+	dest[401] = (UINT16)swap16OnLE(0xB00Cu);
+	dest[440] = (UINT16)swap16OnLE(0x0601u);
+	dest[441] = (UINT16)swap16OnLE(0xB00Cu);
+	dest[480] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[481] = (UINT16)swap16OnLE(0xBFFFu);
+	dest[520] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[521] = (UINT16)swap16OnLE(0xBFFFu);
+	dest[560] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[561] = (UINT16)swap16OnLE(0xBFFFu);
+	dest[600] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[601] = (UINT16)swap16OnLE(0xBFFFu);
+	dest[640] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[641] = (UINT16)swap16OnLE(0xBFFFu);
+	dest[680] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[681] = (UINT16)swap16OnLE(0xBFFFu);
+	dest[720] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[721] = (UINT16)swap16OnLE(0xBFFFu);
+	dest[760] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[761] = (UINT16)swap16OnLE(0xBFFFu);
+	dest[800] = (UINT16)swap16OnLE(0x0601u);
+	dest[801] = (UINT16)swap16OnLE(0xB00Cu);
+	dest[840] = (UINT16)swap16OnLE(0x0601u);
+	dest[841] = (UINT16)swap16OnLE(0xB00Cu);
+	dest[880] = (UINT16)swap16OnLE(0x0601u);
+	dest[881] = (UINT16)swap16OnLE(0xB00Cu);
+	dest[920] = (UINT16)swap16OnLE(0x0601u);
+	dest[921] = (UINT16)swap16OnLE(0xB00Cu);
+	dest[960] = (UINT16)swap16OnLE(0x0601u);
+	dest[961] = (UINT16)swap16OnLE(0xB00Cu);
+	dest[1000] = (UINT16)swap16OnLE(0x0601u);
+	dest[1001] = (UINT16)swap16OnLE(0xF00Cu);
+	dest[1040] = (UINT16)swap16OnLE(0x0601u);
+	dest[1041] = (UINT16)swap16OnLE(0xF00Cu);
+	dest[1080] = (UINT16)swap16OnLE(0x0601u);
+	dest[1081] = (UINT16)swap16OnLE(0xF00Cu);
+	dest[1120] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[1121] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[1160] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[1161] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[1200] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[1201] = (UINT16)swap16OnLE(0xFFFFu);
+}
+
+void cspr_train3(UINT16* const dest)
+{
+	dest[40] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[41] &= (UINT16)swap16OnLE(0x000Fu);
+	dest[41] |= (UINT16)swap16OnLE(0xFFF0u);
+	dest[80] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[81] &= (UINT16)swap16OnLE(0x000Fu);
+	dest[81] |= (UINT16)swap16OnLE(0xFFF0u);
+	dest[120] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[121] &= (UINT16)swap16OnLE(0x000Fu);
+	dest[121] |= (UINT16)swap16OnLE(0xFFF0u);
+	dest[160] = (UINT16)swap16OnLE(0x0300u);
+	dest[161] &= (UINT16)swap16OnLE(0x000Fu);
+	dest[161] |= (UINT16)swap16OnLE(0xFFF0u);
+	dest[200] = (UINT16)swap16OnLE(0x0300u);
+	dest[201] &= (UINT16)swap16OnLE(0x000Fu);
+	dest[201] |= (UINT16)swap16OnLE(0xFFF0u);
+	dest[240] = (UINT16)swap16OnLE(0x0300u);
+	dest[241] &= (UINT16)swap16OnLE(0x000Fu);
+	dest[241] |= (UINT16)swap16OnLE(0xDFF0u);
+	dest[280] = (UINT16)swap16OnLE(0x0300u);
+	dest[281] &= (UINT16)swap16OnLE(0x000Fu);
+	dest[281] |= (UINT16)swap16OnLE(0xDFF0u);
+	dest[320] = (UINT16)swap16OnLE(0x0300u);
+	dest[321] &= (UINT16)swap16OnLE(0x000Fu);
+	dest[321] |= (UINT16)swap16OnLE(0xDFF0u);
+	dest[360] = (UINT16)swap16OnLE(0x0300u);
+	dest[361] &= (UINT16)swap16OnLE(0x000Fu);
+	dest[361] |= (UINT16)swap16OnLE(0xDFF0u);
+	dest[400] = (UINT16)swap16OnLE(0x0300u);
+	dest[401] &= (UINT16)swap16OnLE(0x000Fu);
+	dest[401] |= (UINT16)swap16OnLE(0xDFF0u);
+	dest[440] = (UINT16)swap16OnLE(0x0300u);
+	dest[441] &= (UINT16)swap16OnLE(0x000Fu);
+	dest[441] |= (UINT16)swap16OnLE(0xDFF0u);
+	dest[480] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[481] &= (UINT16)swap16OnLE(0x000Fu);
+	dest[481] |= (UINT16)swap16OnLE(0xDFF0u);
+	dest[520] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[521] &= (UINT16)swap16OnLE(0x000Fu);
+	dest[521] |= (UINT16)swap16OnLE(0xDFF0u);
+	dest[560] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[561] &= (UINT16)swap16OnLE(0x000Fu);
+	dest[561] |= (UINT16)swap16OnLE(0xDFF0u);
+	dest[600] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[601] &= (UINT16)swap16OnLE(0x000Fu);
+	dest[601] |= (UINT16)swap16OnLE(0xDFF0u);
+	dest[640] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[641] &= (UINT16)swap16OnLE(0x000Fu);
+	dest[641] |= (UINT16)swap16OnLE(0xDFF0u);
+	dest[680] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[681] &= (UINT16)swap16OnLE(0x000Fu);
+	dest[681] |= (UINT16)swap16OnLE(0xDFF0u);
+	dest[720] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[721] &= (UINT16)swap16OnLE(0x000Fu);
+	dest[721] |= (UINT16)swap16OnLE(0xDFF0u);
+	dest[760] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[761] &= (UINT16)swap16OnLE(0x000Fu);
+	dest[761] |= (UINT16)swap16OnLE(0xDFF0u);
+	dest[800] = (UINT16)swap16OnLE(0x0300u);
+	dest[801] &= (UINT16)swap16OnLE(0x000Fu);
+	dest[801] |= (UINT16)swap16OnLE(0xDFF0u);
+	dest[840] = (UINT16)swap16OnLE(0x0300u);
+	dest[841] &= (UINT16)swap16OnLE(0x000Fu);
+	dest[841] |= (UINT16)swap16OnLE(0xDFF0u);
+	dest[880] = (UINT16)swap16OnLE(0x0300u);
+	dest[881] &= (UINT16)swap16OnLE(0x000Fu);
+	dest[881] |= (UINT16)swap16OnLE(0xDFF0u);
+	dest[920] = (UINT16)swap16OnLE(0x0300u);
+	dest[921] &= (UINT16)swap16OnLE(0x000Fu);
+	dest[921] |= (UINT16)swap16OnLE(0xDFF0u);
+	dest[960] = (UINT16)swap16OnLE(0x0300u);
+	dest[961] &= (UINT16)swap16OnLE(0x000Fu);
+	dest[961] |= (UINT16)swap16OnLE(0xDFF0u);
+	dest[1000] = (UINT16)swap16OnLE(0x0300u);
+	dest[1001] &= (UINT16)swap16OnLE(0x000Fu);
+	dest[1001] |= (UINT16)swap16OnLE(0xFFF0u);
+	dest[1040] = (UINT16)swap16OnLE(0x0300u);
+	dest[1041] &= (UINT16)swap16OnLE(0x000Fu);
+	dest[1041] |= (UINT16)swap16OnLE(0xFFF0u);
+	dest[1080] = (UINT16)swap16OnLE(0x0300u);
+	dest[1081] &= (UINT16)swap16OnLE(0x000Fu);
+	dest[1081] |= (UINT16)swap16OnLE(0xFFF0u);
+	dest[1120] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[1121] &= (UINT16)swap16OnLE(0x000Fu);
+	dest[1121] |= (UINT16)swap16OnLE(0xFFF0u);
+	dest[1160] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[1161] &= (UINT16)swap16OnLE(0x000Fu);
+	dest[1161] |= (UINT16)swap16OnLE(0xFFF0u);
+	dest[1200] = (UINT16)swap16OnLE(0xFFFFu);
+	dest[1201] &= (UINT16)swap16OnLE(0x000Fu);
+	dest[1201] |= (UINT16)swap16OnLE(0xFFF0u);
+}
+#endif
\ No newline at end of file
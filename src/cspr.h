@@ -0,0 +1,123 @@
+/**
+ * @file cspr.h
+ * @author Academia Team
+ * @brief Contains compiled sprites for the bitmaps that are plotted most often.
+ * @details A compiled sprite is a routine that writes every row of its bitmap
+ * straight to the screen as an immediate value, without reading the bitmap or
+ * running a loop. The routines are generated from the bitmaps in bitmaps.c by
+ * spr_gen and must be regenerated whenever those bitmaps change.
+ *
+ * Every compiled sprite is 32 pixels wide and 32 pixels high, and may only be
+ * plotted where onCsprGrid() holds.
+ *
+ * @copyright Copyright Academia Team 2023
+ */
+
+#ifndef CSPR_H
+#define CSPR_H
+
+#include "raster.h"
+#include "scrn.h"
+#include "types.h"
+
+/**
+ * @brief Determines if a compiled sprite can be plotted at the given position.
+ * @details The sprite must start on a word boundary and lie entirely on the
+ * screen, as compiled sprites do no clipping.
+ */
+#define onCsprGrid(x, y) \
+	(onRast32Grid(x) && (y) >= 0 && (y) <= RAST32H_MAX_VIS_Y)
+
+/**
+ * @brief Gives the word on screen that a compiled sprite should be plotted at
+ * for the given position.
+ */
+#define csprDest(base, x, y) \
+	((UINT16 *)(base) + (y) * SCRN_LEN_WORDS + ((x) >> DIV_SHIFT_BY_16))
+
+/**
+ * @brief Copies the grass cell bitmap to the screen.
+ *
+ * @param dest The word on screen where the top-left corner of the bitmap should
+ * be (see csprDest()).
+ */
+void cspr_grass(UINT16* const dest);
+
+/**
+ * @brief Copies the hedge cell bitmap to the screen.
+ *
+ * @param dest The word on screen where the top-left corner of the bitmap should
+ * be (see csprDest()).
+ */
+void cspr_hedge(UINT16* const dest);
+
+/**
+ * @brief Copies the road cell bitmap to the screen.
+ *
+ * @param dest The word on screen where the top-left corner of the bitmap should
+ * be (see csprDest()).
+ */
+void cspr_road(UINT16* const dest);
+
+/**
+ * @brief Copies the spike cell bitmap to the screen.
+ *
+ * @param dest The word on screen where the top-left corner of the bitmap should
+ * be (see csprDest()).
+ */
+void cspr_spike(UINT16* const dest);
+
+/**
+ * @brief Copies the track cell bitmap to the screen.
+ *
+ * @param dest The word on screen where the top-left corner of the bitmap should
+ * be (see csprDest()).
+ */
+void cspr_track(UINT16* const dest);
+
+/**
+ * @brief Plots the west facing car bitmap onto the screen, clearing whatever
+ * was behind the car (see getCarMasked()).
+ *
+ * @param dest The word on screen where the top-left corner of the bitmap should
+ * be (see csprDest()).
+ */
+void cspr_car_w(UINT16* const dest);
+
+/**
+ * @brief Plots the east facing car bitmap onto the screen, clearing whatever
+ * was behind the car (see getCarMasked()).
+ *
+ * @param dest The word on screen where the top-left corner of the bitmap should
+ * be (see csprDest()).
+ */
+void cspr_car_e(UINT16* const dest);
+
+/**
+ * @brief Plots the first (left-most) part of the train bitmap onto the screen,
+ * clearing whatever was behind the train (see getTrainMasked()).
+ *
+ * @param dest The word on screen where the top-left corner of the bitmap should
+ * be (see csprDest()).
+ */
+void cspr_train1(UINT16* const dest);
+
+/**
+ * @brief Plots the second part of the train bitmap onto the screen, clearing
+ * whatever was behind the train (see getTrainMasked()).
+ *
+ * @param dest The word on screen where the top-left corner of the bitmap should
+ * be (see csprDest()).
+ */
+void cspr_train2(UINT16* const dest);
+
+/**
+ * @brief Plots the last (right-most) part of the train bitmap onto the screen,
+ * clearing whatever was behind the train (see getTrainMasked()).
+ *
+ * @param dest The word on screen where the top-left corner of the bitmap should
+ * be (see csprDest()).
+ */
+void cspr_train3(UINT16* const dest);
+
+#endif
\ No newline at end of file
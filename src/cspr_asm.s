@@ -0,0 +1,599 @@
+; Contains the compiled sprites declared in cspr.h.
+;
+; Generated by spr_gen from the bitmaps in bitmaps.c. Do not edit.
+; 
+; Copyright Academia Team 2023
+
+					xdef			_cspr_grass
+					xdef			_cspr_hedge
+					xdef			_cspr_road
+					xdef			_cspr_spike
+					xdef			_cspr_track
+					xdef			_cspr_car_w
+					xdef			_cspr_car_e
+					xdef			_cspr_train1
+					xdef			_cspr_train2
+					xdef			_cspr_train3
+
+
+; void cspr_grass(UINT16* const dest)
+;
+; Copies the grass bitmap to the screen at the given word.
+;
+; Register Table:
+;
+; d0	-	Holds a value found on several rows.
+; d1	-	Holds a value found on several rows.
+; d2	-	Holds a value found on several rows.
+; d3	-	Holds a value found on several rows.
+; a0	-	Holds the position on screen to plot at.
+
+_cspr_grass:		movem.l			d0-3/a0,-(sp)
+					movea.l			24(sp),a0
+					move.l			#$80000001,d0
+					move.l			#$C2222223,d1
+					move.l			#$88888889,d2
+					move.l			#$C8A8A8A9,d3
+					move.l			#$FFFFFFFF,(a0)
+					move.l			d1,80(a0)
+					move.l			d0,160(a0)
+					move.l			d2,240(a0)
+					move.l			d0,320(a0)
+					move.l			d1,400(a0)
+					move.l			d0,480(a0)
+					move.l			d3,560(a0)
+					move.l			d0,640(a0)
+					move.l			d1,720(a0)
+					move.l			d0,800(a0)
+					move.l			d2,880(a0)
+					move.l			d0,960(a0)
+					move.l			d1,1040(a0)
+					move.l			d0,1120(a0)
+					move.l			d3,1200(a0)
+					move.l			d0,1280(a0)
+					move.l			d1,1360(a0)
+					move.l			d0,1440(a0)
+					move.l			d2,1520(a0)
+					move.l			d0,1600(a0)
+					move.l			d1,1680(a0)
+					move.l			d0,1760(a0)
+					move.l			d3,1840(a0)
+					move.l			d0,1920(a0)
+					move.l			d1,2000(a0)
+					move.l			d0,2080(a0)
+					move.l			d2,2160(a0)
+					move.l			d0,2240(a0)
+					move.l			d1,2320(a0)
+					move.l			d0,2400(a0)
+					move.l			#$FFFFFFFF,2480(a0)
+					movem.l			(sp)+,d0-3/a0
+					rts
+
+; void cspr_hedge(UINT16* const dest)
+;
+; Copies the hedge bitmap to the screen at the given word.
+;
+; Register Table:
+;
+; d0	-	Holds a value found on several rows.
+; d1	-	Holds a value found on several rows.
+; d2	-	Holds a value found on several rows.
+; d3	-	Holds a value found on several rows.
+; a0	-	Holds the position on screen to plot at.
+
+_cspr_hedge:		movem.l			d0-3/a0,-(sp)
+					movea.l			24(sp),a0
+					move.l			#$AAAAAAAB,d0
+					move.l			#$D5555555,d1
+					move.l			#$D1515151,d2
+					move.l			#$95151515,d3
+					move.l			#$FFFFFFFF,(a0)
+					move.l			d0,80(a0)
+					move.l			d1,160(a0)
+					move.l			d0,240(a0)
+					move.l			d2,320(a0)
+					move.l			d0,400(a0)
+					move.l			d1,480(a0)
+					move.l			d0,560(a0)
+					move.l			d3,640(a0)
+					move.l			d0,720(a0)
+					move.l			d1,800(a0)
+					move.l			d0,880(a0)
+					move.l			d2,960(a0)
+					move.l			d0,1040(a0)
+					move.l			d1,1120(a0)
+					move.l			d0,1200(a0)
+					move.l			d3,1280(a0)
+					move.l			d0,1360(a0)
+					move.l			d1,1440(a0)
+					move.l			d0,1520(a0)
+					move.l			d2,1600(a0)
+					move.l			d0,1680(a0)
+					move.l			d1,1760(a0)
+					move.l			d0,1840(a0)
+					move.l			d3,1920(a0)
+					move.l			d0,2000(a0)
+					move.l			d1,2080(a0)
+					move.l			d0,2160(a0)
+					move.l			d2,2240(a0)
+					move.l			d0,2320(a0)
+					move.l			d1,2400(a0)
+					move.l			#$FFFFFFFF,2480(a0)
+					movem.l			(sp)+,d0-3/a0
+					rts
+
+; void cspr_road(UINT16* const dest)
+;
+; Copies the road bitmap to the screen at the given word.
+;
+; Register Table:
+;
+; d0	-	Holds a value found on several rows.
+; d1	-	Holds a value found on several rows.
+; a0	-	Holds the position on screen to plot at.
+
+_cspr_road:			movem.l			d0-1/a0,-(sp)
+					movea.l			16(sp),a0
+					move.l			#$80000001,d0
+					move.l			#$FFFFFFFF,d1
+					move.l			d1,(a0)
+					move.l			d0,80(a0)
+					move.l			d1,160(a0)
+					move.l			d1,240(a0)
+					move.l			d0,320(a0)
+					move.l			d0,400(a0)
+					move.l			d0,480(a0)
+					move.l			d0,560(a0)
+					move.l			d0,640(a0)
+					move.l			d0,720(a0)
+					move.l			d0,800(a0)
+					move.l			d0,880(a0)
+					move.l			d0,960(a0)
+					move.l			d0,1040(a0)
+					move.l			d0,1120(a0)
+					move.l			#$9B6DB6D9,1200(a0)
+					move.l			d0,1280(a0)
+					move.l			d0,1360(a0)
+					move.l			d0,1440(a0)
+					move.l			d0,1520(a0)
+					move.l			d0,1600(a0)
+					move.l			d0,1680(a0)
+					move.l			d0,1760(a0)
+					move.l			d0,1840(a0)
+					move.l			d0,1920(a0)
+					move.l			d0,2000(a0)
+					move.l			d0,2080(a0)
+					move.l			d0,2160(a0)
+					move.l			d1,2240(a0)
+					move.l			d1,2320(a0)
+					move.l			d0,2400(a0)
+					move.l			d1,2480(a0)
+					movem.l			(sp)+,d0-1/a0
+					rts
+
+; void cspr_spike(UINT16* const dest)
+;
+; Copies the spike bitmap to the screen at the given word.
+;
+; Register Table:
+;
+; d0	-	Holds a value found on several rows.
+; d1	-	Holds a value found on several rows.
+; d2	-	Holds a value found on several rows.
+; d3	-	Holds a value found on several rows.
+; a0	-	Holds the position on screen to plot at.
+
+_cspr_spike:		movem.l			d0-3/a0,-(sp)
+					movea.l			24(sp),a0
+					move.l			#$80000001,d0
+					move.l			#$C4881223,d1
+					move.l			#$8E1C3871,d2
+					move.l			#$9F3E7CF9,d3
+					move.l			#$FFFFFFFF,(a0)
+					move.l			#$C8882223,80(a0)
+					move.l			d0,160(a0)
+					move.l			#$82228889,240(a0)
+					move.l			d0,320(a0)
+					move.l			d1,400(a0)
+					move.l			d2,480(a0)
+					move.l			d3,560(a0)
+					move.l			d2,640(a0)
+					move.l			d1,720(a0)
+					move.l			d0,800(a0)
+					move.l			#$92228889,880(a0)
+					move.l			d0,960(a0)
+					move.l			d1,1040(a0)
+					move.l			d2,1120(a0)
+					move.l			d3,1200(a0)
+					move.l			d2,1280(a0)
+					move.l			d1,1360(a0)
+					move.l			d0,1440(a0)
+					move.l			#$92228889,1520(a0)
+					move.l			d0,1600(a0)
+					move.l			d1,1680(a0)
+					move.l			d2,1760(a0)
+					move.l			d3,1840(a0)
+					move.l			d2,1920(a0)
+					move.l			d1,2000(a0)
+					move.l			d0,2080(a0)
+					move.l			#$92228889,2160(a0)
+					move.l			d0,2240(a0)
+					move.l			#$C8882223,2320(a0)
+					move.l			d0,2400(a0)
+					move.l			#$FFFFFFFF,2480(a0)
+					movem.l			(sp)+,d0-3/a0
+					rts
+
+; void cspr_track(UINT16* const dest)
+;
+; Copies the track bitmap to the screen at the given word.
+;
+; Register Table:
+;
+; d0	-	Holds a value found on several rows.
+; d1	-	Holds a value found on several rows.
+; d2	-	Holds a value found on several rows.
+; a0	-	Holds the position on screen to plot at.
+
+_cspr_track:		movem.l			d0-2/a0,-(sp)
+					movea.l			20(sp),a0
+					move.l			#$98618619,d0
+					move.l			#$FFFFFFFF,d1
+					move.l			#$80000001,d2
+					move.l			d1,(a0)
+					move.l			d2,80(a0)
+					move.l			d2,160(a0)
+					move.l			d1,240(a0)
+					move.l			d1,320(a0)
+					move.l			d1,400(a0)
+					move.l			d1,480(a0)
+					move.l			d1,560(a0)
+					move.l			d0,640(a0)
+					move.l			d0,720(a0)
+					move.l			d0,800(a0)
+					move.l			d0,880(a0)
+					move.l			d0,960(a0)
+					move.l			d0,1040(a0)
+					move.l			d0,1120(a0)
+					move.l			d0,1200(a0)
+					move.l			d0,1280(a0)
+					move.l			d0,1360(a0)
+					move.l			d0,1440(a0)
+					move.l			d0,1520(a0)
+					move.l			d0,1600(a0)
+					move.l			d0,1680(a0)
+					move.l			d0,1760(a0)
+					move.l			d0,1840(a0)
+					move.l			d0,1920(a0)
+					move.l			d1,2000(a0)
+					move.l			d1,2080(a0)
+					move.l			d1,2160(a0)
+					move.l			d1,2240(a0)
+					move.l			d1,2320(a0)
+					move.l			d2,2400(a0)
+					move.l			d1,2480(a0)
+					movem.l			(sp)+,d0-2/a0
+					rts
+
+; void cspr_car_w(UINT16* const dest)
+;
+; Plots the masked car_w bitmap onto the screen at the given word.
+;
+; Register Table:
+;
+; d0	-	Holds a value found on several rows.
+; d1	-	Holds a value found on several rows.
+; a0	-	Holds the position on screen to plot at.
+
+_cspr_car_w:		movem.l			d0-1/a0,-(sp)
+					movea.l			16(sp),a0
+					move.l			#$80F00019,d0
+					move.l			#$C0F00019,d1
+					move.l			#$FFFFFFFF,640(a0)
+					move.l			#$E07FFFE1,720(a0)
+					move.l			#$C0FFFFF9,800(a0)
+					move.l			#$40FFFF99,880(a0)
+					move.l			d1,960(a0)
+					move.l			d1,1040(a0)
+					move.l			d0,1120(a0)
+					move.l			d0,1200(a0)
+					move.l			d0,1280(a0)
+					move.l			d0,1360(a0)
+					move.l			d0,1440(a0)
+					move.l			d1,1520(a0)
+					move.l			d1,1600(a0)
+					move.l			#$40FFFFD9,1680(a0)
+					move.l			#$C07FFFF1,1760(a0)
+					move.l			#$FFFFFFFF,1840(a0)
+					movem.l			(sp)+,d0-1/a0
+					rts
+
+; void cspr_car_e(UINT16* const dest)
+;
+; Plots the masked car_e bitmap onto the screen at the given word.
+;
+; Register Table:
+;
+; d0	-	Holds a value found on several rows.
+; d1	-	Holds a value found on several rows.
+; a0	-	Holds the position on screen to plot at.
+
+_cspr_car_e:		movem.l			d0-1/a0,-(sp)
+					movea.l			16(sp),a0
+					move.l			#$98000F01,d0
+					move.l			#$98000F03,d1
+					move.l			#$FFFFFFFF,640(a0)
+					move.l			#$8FFFFE03,720(a0)
+					move.l			#$9BFFFF02,800(a0)
+					move.l			d1,880(a0)
+					move.l			d1,960(a0)
+					move.l			d0,1040(a0)
+					move.l			d0,1120(a0)
+					move.l			d0,1200(a0)
+					move.l			d0,1280(a0)
+					move.l			d0,1360(a0)
+					move.l			d1,1440(a0)
+					move.l			d1,1520(a0)
+					move.l			#$99FFFF02,1600(a0)
+					move.l			#$9FFFFF03,1680(a0)
+					move.l			#$87FFFE07,1760(a0)
+					move.l			#$FFFFFFFF,1840(a0)
+					movem.l			(sp)+,d0-1/a0
+					rts
+
+; void cspr_train1(UINT16* const dest)
+;
+; Plots the masked train1 bitmap onto the screen at the given word.
+;
+; Register Table:
+;
+; a0	-	Holds the position on screen to plot at.
+
+_cspr_train1:		move.l			a0,-(sp)
+					movea.l			8(sp),a0
+					andi.w			#$FE00,80(a0)
+					ori.w			#$01FF,80(a0)
+					move.w			#$FFFF,82(a0)
+					andi.w			#$FE00,160(a0)
+					ori.w			#$01FF,160(a0)
+					move.w			#$FFFF,162(a0)
+					andi.w			#$FE00,240(a0)
+					ori.w			#$01FF,240(a0)
+					move.w			#$FFFF,242(a0)
+					andi.w			#$FE00,320(a0)
+					ori.w			#$01FF,320(a0)
+					move.w			#$E018,322(a0)
+					andi.w			#$FE00,400(a0)
+					ori.w			#$01FF,400(a0)
+					move.w			#$E018,402(a0)
+					andi.w			#$FE00,480(a0)
+					ori.w			#$01FF,480(a0)
+					move.w			#$6018,482(a0)
+					andi.w			#$FE00,560(a0)
+					ori.w			#$01FF,560(a0)
+					move.w			#$6018,562(a0)
+					andi.w			#$FE00,640(a0)
+					ori.w			#$01FF,640(a0)
+					move.w			#$6018,642(a0)
+					andi.w			#$FE00,720(a0)
+					ori.w			#$01FF,720(a0)
+					move.w			#$6018,722(a0)
+					andi.w			#$FE00,800(a0)
+					ori.w			#$01FF,800(a0)
+					move.w			#$6018,802(a0)
+					andi.w			#$FE00,880(a0)
+					ori.w			#$01FF,880(a0)
+					move.w			#$6018,882(a0)
+					andi.w			#$FE00,960(a0)
+					ori.w			#$01FF,960(a0)
+					move.w			#$7FFF,962(a0)
+					andi.w			#$FE00,1040(a0)
+					ori.w			#$01FF,1040(a0)
+					move.w			#$7FFF,1042(a0)
+					andi.w			#$FE00,1120(a0)
+					ori.w			#$01FF,1120(a0)
+					move.w			#$7FFF,1122(a0)
+					andi.w			#$FE00,1200(a0)
+					ori.w			#$01FF,1200(a0)
+					move.w			#$7FFF,1202(a0)
+					andi.w			#$FE00,1280(a0)
+					ori.w			#$01FF,1280(a0)
+					move.w			#$7FFF,1282(a0)
+					andi.w			#$FE00,1360(a0)
+					ori.w			#$01FF,1360(a0)
+					move.w			#$7FFF,1362(a0)
+					andi.w			#$FE00,1440(a0)
+					ori.w			#$01FF,1440(a0)
+					move.w			#$7FFF,1442(a0)
+					andi.w			#$FE00,1520(a0)
+					ori.w			#$01FF,1520(a0)
+					move.w			#$7FFF,1522(a0)
+					andi.w			#$FE00,1600(a0)
+					ori.w			#$01FF,1600(a0)
+					move.w			#$6018,1602(a0)
+					andi.w			#$FE00,1680(a0)
+					ori.w			#$01FF,1680(a0)
+					move.w			#$6018,1682(a0)
+					andi.w			#$FE00,1760(a0)
+					ori.w			#$01FF,1760(a0)
+					move.w			#$6018,1762(a0)
+					andi.w			#$FE00,1840(a0)
+					ori.w			#$01FF,1840(a0)
+					move.w			#$6018,1842(a0)
+					andi.w			#$FE00,1920(a0)
+					ori.w			#$01FF,1920(a0)
+					move.w			#$6018,1922(a0)
+					andi.w			#$FE00,2000(a0)
+					ori.w			#$01FF,2000(a0)
+					move.w			#$E018,2002(a0)
+					andi.w			#$FE00,2080(a0)
+					ori.w			#$01FF,2080(a0)
+					move.w			#$E018,2082(a0)
+					andi.w			#$FE00,2160(a0)
+					ori.w			#$01FF,2160(a0)
+					move.w			#$E018,2162(a0)
+					andi.w			#$FE00,2240(a0)
+					ori.w			#$01FF,2240(a0)
+					move.w			#$FFFF,2242(a0)
+					andi.w			#$FE00,2320(a0)
+					ori.w			#$01FF,2320(a0)
+					move.w			#$FFFF,2322(a0)
+					andi.w			#$FE00,2400(a0)
+					ori.w			#$01FF,2400(a0)
+					move.w			#$FFFF,2402(a0)
+					movea.l			(sp)+,a0
+					rts
+
+; void cspr_train2(UINT16* const dest)
+;
+; Plots the masked train2 bitmap onto the screen at the given word.
+;
+; Register Table:
+;
+; d0	-	Holds a value found on several rows.
+; d1	-	Holds a value found on several rows.
+; d2	-	Holds a value found on several rows.
+; d3	-	Holds a value found on several rows.
+; a0	-	Holds the position on screen to plot at.
+
+_cspr_train2:		movem.l			d0-3/a0,-(sp)
+					movea.l			24(sp),a0
+					move.l			#$0601B00C,d0
+					move.l			#$FFFFBFFF,d1
+					move.l			#$FFFFFFFF,d2
+					move.l			#$0601F00C,d3
+					move.l			d2,80(a0)
+					move.l			d2,160(a0)
+					move.l			d2,240(a0)
+					move.l			d3,320(a0)
+					move.l			d3,400(a0)
+					move.l			d3,480(a0)
+					move.l			d0,560(a0)
+					move.l			d0,640(a0)
+					move.l			d0,720(a0)
+					move.l			d0,800(a0)
+					move.l			d0,880(a0)
+					move.l			d1,960(a0)
+					move.l			d1,1040(a0)
+					move.l			d1,1120(a0)
+					move.l			d1,1200(a0)
+					move.l			d1,1280(a0)
+					move.l			d1,1360(a0)
+					move.l			d1,1440(a0)
+					move.l			d1,1520(a0)
+					move.l			d0,1600(a0)
+					move.l			d0,1680(a0)
+					move.l			d0,1760(a0)
+					move.l			d0,1840(a0)
+					move.l			d0,1920(a0)
+					move.l			d3,2000(a0)
+					move.l			d3,2080(a0)
+					move.l			d3,2160(a0)
+					move.l			d2,2240(a0)
+					move.l			d2,2320(a0)
+					move.l			d2,2400(a0)
+					movem.l			(sp)+,d0-3/a0
+					rts
+
+; void cspr_train3(UINT16* const dest)
+;
+; Plots the masked train3 bitmap onto the screen at the given word.
+;
+; Register Table:
+;
+; a0	-	Holds the position on screen to plot at.
+
+_cspr_train3:		move.l			a0,-(sp)
+					movea.l			8(sp),a0
+					move.w			#$FFFF,80(a0)
+					andi.w			#$000F,82(a0)
+					ori.w			#$FFF0,82(a0)
+					move.w			#$FFFF,160(a0)
+					andi.w			#$000F,162(a0)
+					ori.w			#$FFF0,162(a0)
+					move.w			#$FFFF,240(a0)
+					andi.w			#$000F,242(a0)
+					ori.w			#$FFF0,242(a0)
+					move.w			#$0300,320(a0)
+					andi.w			#$000F,322(a0)
+					ori.w			#$FFF0,322(a0)
+					move.w			#$0300,400(a0)
+					andi.w			#$000F,402(a0)
+					ori.w			#$FFF0,402(a0)
+					move.w			#$0300,480(a0)
+					andi.w			#$000F,482(a0)
+					ori.w			#$DFF0,482(a0)
+					move.w			#$0300,560(a0)
+					andi.w			#$000F,562(a0)
+					ori.w			#$DFF0,562(a0)
+					move.w			#$0300,640(a0)
+					andi.w			#$000F,642(a0)
+					ori.w			#$DFF0,642(a0)
+					move.w			#$0300,720(a0)
+					andi.w			#$000F,722(a0)
+					ori.w			#$DFF0,722(a0)
+					move.w			#$0300,800(a0)
+					andi.w			#$000F,802(a0)
+					ori.w			#$DFF0,802(a0)
+					move.w			#$0300,880(a0)
+					andi.w			#$000F,882(a0)
+					ori.w			#$DFF0,882(a0)
+					move.w			#$FFFF,960(a0)
+					andi.w			#$000F,962(a0)
+					ori.w			#$DFF0,962(a0)
+					move.w			#$FFFF,1040(a0)
+					andi.w			#$000F,1042(a0)
+					ori.w			#$DFF0,1042(a0)
+					move.w			#$FFFF,1120(a0)
+					andi.w			#$000F,1122(a0)
+					ori.w			#$DFF0,1122(a0)
+					move.w			#$FFFF,1200(a0)
+					andi.w			#$000F,1202(a0)
+					ori.w			#$DFF0,1202(a0)
+					move.w			#$FFFF,1280(a0)
+					andi.w			#$000F,1282(a0)
+					ori.w			#$DFF0,1282(a0)
+					move.w			#$FFFF,1360(a0)
+					andi.w			#$000F,1362(a0)
+					ori.w			#$DFF0,1362(a0)
+					move.w			#$FFFF,1440(a0)
+					andi.w			#$000F,1442(a0)
+					ori.w			#$DFF0,1442(a0)
+					move.w			#$FFFF,1520(a0)
+					andi.w			#$000F,1522(a0)
+					ori.w			#$DFF0,1522(a0)
+					move.w			#$0300,1600(a0)
+					andi.w			#$000F,1602(a0)
+					ori.w			#$DFF0,1602(a0)
+					move.w			#$0300,1680(a0)
+					andi.w			#$000F,1682(a0)
+					ori.w			#$DFF0,1682(a0)
+					move.w			#$0300,1760(a0)
+					andi.w			#$000F,1762(a0)
+					ori.w			#$DFF0,1762(a0)
+					move.w			#$0300,1840(a0)
+					andi.w			#$000F,1842(a0)
+					ori.w			#$DFF0,1842(a0)
+					move.w			#$0300,1920(a0)
+					andi.w			#$000F,1922(a0)
+					ori.w			#$DFF0,1922(a0)
+					move.w			#$0300,2000(a0)
+					andi.w			#$000F,2002(a0)
+					ori.w			#$FFF0,2002(a0)
+					move.w			#$0300,2080(a0)
+					andi.w			#$000F,2082(a0)
+					ori.w			#$FFF0,2082(a0)
+					move.w			#$0300,2160(a0)
+					andi.w			#$000F,2162(a0)
+					ori.w			#$FFF0,2162(a0)
+					move.w			#$FFFF,2240(a0)
+					andi.w			#$000F,2242(a0)
+					ori.w			#$FFF0,2242(a0)
+					move.w			#$FFFF,2320(a0)
+					andi.w			#$000F,2322(a0)
+					ori.w			#$FFF0,2322(a0)
+					move.w			#$FFFF,2400(a0)
+					andi.w			#$000F,2402(a0)
+					ori.w			#$FFF0,2402(a0)
+					movea.l			(sp)+,a0
+					rts
\ No newline at end of file
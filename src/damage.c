@@ -0,0 +1,208 @@
+/**
+ * @file damage.c
+ * @author Academia Team
+ * @brief Contains functions to record the areas of a frame buffer that have
+ * changed and to copy them to another frame buffer.
+ *
+ * @copyright Copyright Academia Team 2023
+ */
+
+#include <string.h>
+
+#include "damage.h"
+
+#define DAMAGE_CELL_SHIFT DIV_SHIFT_BY_32
+
+void copyDamagedRun(UINT32* const dest, const UINT32* const src, int row,
+					int firstCol, int lastCol);
+
+void clear_damage(Damage* const damage)
+{
+	int row;
+
+	for (row = 0; row < DAMAGE_ROWS; row++)
+	{
+		damage->rows[row] = 0;
+	}
+}
+
+void add_damage(Damage* const damage, int x, int length, int y, int height)
+{
+	const int X1 = (x < 0 ? 0 : x);
+	const int X2 = (x + length - 1 > SCRN_MAX_X ? SCRN_MAX_X : x + length - 1);
+	const int Y1 = (y < 0 ? 0 : y);
+	const int Y2 = (y + height - 1 > SCRN_MAX_Y ? SCRN_MAX_Y : y + height - 1);
+
+	UINT32 cols;
+
+	int row;
+
+	if (X1 <= X2 && Y1 <= Y2)
+	{
+		cols = (DAMAGE_FULL_ROW >> (DAMAGE_COLS - 1 -
+									(X2 >> DAMAGE_CELL_SHIFT))) &
+			   (DAMAGE_FULL_ROW << (X1 >> DAMAGE_CELL_SHIFT));
+
+		for (row = Y1 >> DAMAGE_CELL_SHIFT; row <= Y2 >> DAMAGE_CELL_SHIFT;
+			 row++)
+		{
+			damage->rows[row] |= cols;
+		}
+	}
+}
+
+void merge_damage(Damage* const dest, const Damage* const src)
+{
+	int row;
+
+	for (row = 0; row < DAMAGE_ROWS; row++)
+	{
+		dest->rows[row] |= src->rows[row];
+	}
+}
+
+int count_damaged(const Damage* const damage)
+{
+	UINT32 cols;
+	int    row;
+	int    count = 0;
+
+	for (row = 0; row < DAMAGE_ROWS; row++)
+	{
+		for (cols = damage->rows[row]; cols != 0; cols &= cols - 1)
+		{
+			count++;
+		}
+	}
+
+	return count;
+}
+
+void copy_damaged(UINT32* const dest, const UINT32* const src,
+				  const Damage* const damage)
+{
+	int row;
+	int lastRow;
+	int firstCol;
+	int col;
+	int firstY;
+	int lastY;
+
+	for (row = 0; row < DAMAGE_ROWS; row++)
+	{
+		if (damage->rows[row] == DAMAGE_FULL_ROW)
+		{
+			lastRow = row;
+			while (lastRow + 1 < DAMAGE_ROWS &&
+				   damage->rows[lastRow + 1] == DAMAGE_FULL_ROW)
+			{
+				lastRow++;
+			}
+
+			firstY = row * DAMAGE_CELL_LEN;
+			lastY = (lastRow + 1) * DAMAGE_CELL_LEN - 1;
+			if (lastY > SCRN_MAX_Y)
+			{
+				lastY = SCRN_MAX_Y;
+			}
+
+			memcpy(dest + firstY * SCRN_LEN_LONG, src + firstY * SCRN_LEN_LONG,
+				   (lastY - firstY + 1) * SCRN_LEN_BYTES);
+			row = lastRow;
+		}
+		else
+		{
+			for (col = 0; col < DAMAGE_COLS; col++)
+			{
+				if (damage->rows[row] & (1ul << col))
+				{
+					firstCol = col;
+					while (col + 1 < DAMAGE_COLS &&
+						   (damage->rows[row] & (1ul << (col + 1))))
+					{
+						col++;
+					}
+
+					copyDamagedRun(dest, src, row, firstCol, col);
+				}
+			}
+		}
+	}
+}
+
+/**
+ * @brief Copies a run of neighbouring damaged cells in a row from one frame
+ * buffer to another.
+ *
+ * @param dest The frame buffer to copy to.
+ * @param src The frame buffer to copy from.
+ * @param row The row of cells that the run is in.
+ * @param firstCol The left-most cell of the run.
+ * @param lastCol The right-most cell of the run.
+ */
+void copyDamagedRun(UINT32* const dest, const UINT32* const src, int row,
+					int firstCol, int lastCol)
+{
+	const int FIRST_Y = row * DAMAGE_CELL_LEN;
+	const int LONGS = lastCol - firstCol + 1;
+
+	int lastY = FIRST_Y + DAMAGE_CELL_LEN - 1;
+	int offset;
+	int index;
+
+	if (lastY > SCRN_MAX_Y)
+	{
+		lastY = SCRN_MAX_Y;
+	}
+
+	for (offset = FIRST_Y * SCRN_LEN_LONG + firstCol;
+		 offset <= lastY * SCRN_LEN_LONG + firstCol; offset += SCRN_LEN_LONG)
+	{
+		for (index = 0; index < LONGS; index++)
+		{
+			dest[offset + index] = src[offset + index];
+		}
+	}
+}
+
+void init_damage_history(DamageHistory* const history)
+{
+	int frame;
+
+	for (frame = 0; frame < MAX_DAMAGE_AGE; frame++)
+	{
+		clear_damage(&history->frames[frame]);
+	}
+}
+
+void push_damage(DamageHistory* const history, const Damage* const damage)
+{
+	int frame;
+
+	for (frame = MAX_DAMAGE_AGE - 1; frame > 0; frame--)
+	{
+		history->frames[frame] = history->frames[frame - 1];
+	}
+
+	history->frames[0] = *damage;
+}
+
+BOOL damage_since(const DamageHistory* const history, int age,
+				  Damage* const damage)
+{
+	int frame;
+
+	if (age < 1 || age > MAX_DAMAGE_AGE)
+	{
+		return FALSE;
+	}
+
+	clear_damage(damage);
+
+	for (frame = 0; frame < age; frame++)
+	{
+		merge_damage(damage, &history->frames[frame]);
+	}
+
+	return TRUE;
+}
\ No newline at end of file
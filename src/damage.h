@@ -0,0 +1,148 @@
+/**
+ * @file damage.h
+ * @author Academia Team
+ * @brief Contains a record of the areas of a frame buffer that have changed,
+ * so that only those areas have to be copied to bring another frame buffer up
+ * to date.
+ * @details Damage is kept at the granularity of the 32x32 pixel cells that the
+ * world is made up of. An area that touches any part of a cell damages the
+ * whole cell, which keeps the record small and lets each damaged cell be
+ * copied as whole longs.
+ *
+ * @copyright Copyright Academia Team 2023
+ */
+
+#ifndef DAMAGE_H
+#define DAMAGE_H
+
+#include "bool.h"
+#include "scrn.h"
+#include "types.h"
+
+/**
+ * @brief The length and height of every cell that damage is kept at (in
+ * pixels).
+ */
+#define DAMAGE_CELL_LEN 32
+
+/**
+ * @brief The number of columns of cells across the screen.
+ */
+#define DAMAGE_COLS (SCRN_LEN / DAMAGE_CELL_LEN)
+
+/**
+ * @brief The number of rows of cells down the screen. The bottom row is only
+ * partly on screen.
+ */
+#define DAMAGE_ROWS ((SCRN_HEIGHT + DAMAGE_CELL_LEN - 1) / DAMAGE_CELL_LEN)
+
+/**
+ * @brief The mask of a row of Damage in which every cell is damaged.
+ */
+#define DAMAGE_FULL_ROW (0xFFFFFFFFu >> (32 - DAMAGE_COLS))
+
+/**
+ * @brief Records the cells of a frame buffer that have been damaged.
+ * @details Every row of cells is held as a mask, in which bit n is set if the
+ * nth cell from the left is damaged.
+ */
+typedef struct
+{
+	UINT32 rows[DAMAGE_ROWS];
+} Damage;
+
+/**
+ * @brief The most frames that a DamageHistory remembers the Damage of.
+ */
+#define MAX_DAMAGE_AGE 4
+
+/**
+ * @brief Remembers the Damage done by each of the last few frames.
+ * @details Much like buffer age in EGL, a frame buffer that was last composed
+ * a few frames ago can be brought up to date with only the cells damaged
+ * since then, rather than being copied from the newest frame buffer in full.
+ * frames[0] holds the Damage done by the newest frame.
+ */
+typedef struct
+{
+	Damage frames[MAX_DAMAGE_AGE];
+} DamageHistory;
+
+/**
+ * @brief Marks every cell of a Damage as undamaged.
+ *
+ * @param damage The Damage to clear.
+ */
+void clear_damage(Damage* const damage);
+
+/**
+ * @brief Marks every cell that a rectangular area touches as damaged.
+ * @details The area is cropped to the screen.
+ *
+ * @param damage The Damage to add the area to.
+ * @param x The left-most column of the area (in pixels starting at zero).
+ * @param length The number of columns that make up the area.
+ * @param y The top-most row of the area (in pixels starting at zero).
+ * @param height The number of rows that make up the area.
+ */
+void add_damage(Damage* const damage, int x, int length, int y, int height);
+
+/**
+ * @brief Marks every cell damaged in one Damage as damaged in another.
+ *
+ * @param dest The Damage to add to.
+ * @param src The Damage to add.
+ */
+void merge_damage(Damage* const dest, const Damage* const src);
+
+/**
+ * @brief Counts the cells of a Damage that are damaged.
+ *
+ * @param damage The Damage to count the cells of.
+ * @return The number of damaged cells.
+ */
+int count_damaged(const Damage* const damage);
+
+/**
+ * @brief Copies every damaged cell from one frame buffer to another.
+ * @details Neighbouring damaged cells in a row are copied together. Rows of
+ * cells that are damaged across the entire screen are contiguous, so they are
+ * copied as a single block.
+ *
+ * @param dest The frame buffer to copy to.
+ * @param src The frame buffer to copy from.
+ * @param damage The cells to copy.
+ */
+void copy_damaged(UINT32* const dest, const UINT32* const src,
+				  const Damage* const damage);
+
+/**
+ * @brief Readies a DamageHistory that remembers no frames.
+ *
+ * @param history The DamageHistory to initialize.
+ */
+void init_damage_history(DamageHistory* const history);
+
+/**
+ * @brief Adds the Damage done by a new frame to a DamageHistory, forgetting
+ * the oldest frame.
+ *
+ * @param history The DamageHistory to add to.
+ * @param damage The Damage done by the new frame.
+ */
+void push_damage(DamageHistory* const history, const Damage* const damage);
+
+/**
+ * @brief Works out the cells damaged since a frame buffer was last composed.
+ *
+ * @param history The DamageHistory holding the Damage of the newest frames.
+ * @param age The number of frames (counting the newest) that have been
+ * composed since the frame buffer was, or zero if its contents are unknown.
+ * @param damage Returns the cells damaged by the newest age frames.
+ * @return TRUE if the history remembers enough frames; FALSE if the age is
+ * zero or too old, in which case the whole frame buffer has to be redrawn.
+ */
+BOOL damage_since(const DamageHistory* const history, int age,
+				  Damage* const damage);
+
+#endif
\ No newline at end of file
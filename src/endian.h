@@ -24,7 +24,22 @@
 		) \
 	)
 
+/* The Atari ST is big endian. A host build is taken to be little endian when
+the compiler says so, unless L_ENDIAN is given at build time (e.g. with
+-DL_ENDIAN). */
+#ifndef M68K_CPU
+#ifndef L_ENDIAN
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__)
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define L_ENDIAN
+#endif
+#endif
+#endif
+#endif
+
+#ifndef L_ENDIAN
 #define B_ENDIAN
+#endif
 
 #ifdef L_ENDIAN
 #define swap16OnBE(value) (value)
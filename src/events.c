@@ -237,7 +237,7 @@ void handleCollectableCollision(World* world, Player* player)
 				break;
 		}
 		world->rows[row].cells[column].collectableValue = NO_COLLECT;
-		world->renderCells = TRUE;
+		invalidateCell(world, row, column);
 		play_collect();
 	}
 }
@@ -488,7 +488,7 @@ void shiftWorld(World* world)
 	initRow(world, &(world->rows[world->top]),
 			getTopBorderHeight(world->numPlayers));
 
-	world->renderCells = TRUE;
+	world->pendingShifts++;
 }
 
 void handleInvalidKeyPress(void)
@@ -179,7 +179,9 @@ BOOL playerMoveOpposite(const Player * const player, Direction dir);
 /**
  * @brief Shifts the entire world downwards such that a new row is generated
  * at the top.
- * @details The bottommost row is destroyed as part of the operation.
+ * @details The bottommost row is destroyed as part of the operation. The
+ * shift is counted in pendingShifts, so that the cells already on screen can
+ * be scrolled down rather than rendered again.
  * 
  * @param world The game world object.
  */
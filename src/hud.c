@@ -0,0 +1,225 @@
+/**
+ * @file hud.c
+ * @author Academia Team
+ * @brief Contains functions to keep the scores and lives shown on a frame
+ * buffer up to date while plotting as little as possible.
+ *
+ * @copyright Copyright Academia Team 2023
+ */
+
+#include <string.h>
+
+#include "bool.h"
+#include "font16.h"
+#include "hud.h"
+#include "model.h"
+#include "raster.h"
+#include "renderer.h"
+#include "types.h"
+
+/**
+ * @brief The labels rendered so far, in the order they were first plotted.
+ */
+LabelStrip labelStrips[MAX_LABEL_STRIPS];
+int        numLabelStrips = 0;
+
+void renderHudPlayer(UINT32* const base, HudPlayer* const shown,
+					 const Score* const score, const Lives* const lives);
+void plotLabelStrip(UINT32* const base, const Label* const label);
+const LabelStrip* findLabelStrip(const char* const text);
+void buildLabelStrip(LabelStrip* const strip, const char* const text);
+
+void initHud(Hud* const hud)
+{
+	int player;
+
+	for (player = 0; player < HUD_MAX_PLAYERS; player++)
+	{
+		hud->players[player].drawn = FALSE;
+	}
+}
+
+void renderHud(UINT32* const base, Hud* const hud, const World* const world)
+{
+	renderHudPlayer(base, &hud->players[0], &world->mainPlayer.score,
+					&world->mainPlayer.lives);
+
+	if (world->numPlayers == 2)
+	{
+		renderHudPlayer(base, &hud->players[1], &world->otherPlayer.score,
+						&world->otherPlayer.lives);
+	}
+}
+
+/**
+ * @brief Brings the score and lives of a single player up to date on a frame
+ * buffer.
+ * @details Nothing is plotted if neither the score nor the lives have changed
+ * since they were last plotted.
+ *
+ * @param base The frame buffer to plot on.
+ * @param shown What was last plotted on the frame buffer for the player.
+ * @param score The score of the player.
+ * @param lives The lives of the player.
+ */
+void renderHudPlayer(UINT32* const base, HudPlayer* const shown,
+					 const Score* const score, const Lives* const lives)
+{
+	int first;
+	int numDigits;
+	int place;
+	int digit;
+
+	if (!shown->drawn)
+	{
+		plotLabelStrip(base, &score->label);
+		plotLabelStrip(base, &lives->label);
+
+		for (place = 0; place < HUD_SCORE_DIGITS; place++)
+		{
+			shown->digits[place] = HUD_UNKNOWN_DIGIT;
+		}
+	}
+
+	if (!shown->drawn || shown->score != score->value)
+	{
+		first     = firstScoreDigit(score);
+		numDigits = SCORE_DIGITS - first;
+
+		for (place = 0; place < HUD_SCORE_DIGITS; place++)
+		{
+			digit = (place < numDigits ? scoreDigit(score, first + place) :
+					 HUD_NO_DIGIT);
+
+			if (digit != shown->digits[place])
+			{
+				if (digit == HUD_NO_DIGIT)
+				{
+					rect_area(base, score->x + place * FONT16_WIDTH,
+							  FONT16_WIDTH, score->y, FONT16_HEIGHT);
+				}
+				else
+				{
+					plot_inv16((UINT16 *)base, score->x + place * FONT16_WIDTH,
+							   score->y, FONT16_HEIGHT,
+							   getFont16Digit(digit, NULL));
+				}
+
+				shown->digits[place] = digit;
+			}
+		}
+
+		shown->score = score->value;
+	}
+
+	if (!shown->drawn || shown->lives != lives->value)
+	{
+		plot_inv16((UINT16 *)base, lives->x, lives->y, FONT16_HEIGHT,
+				   getFont16Digit(lives->value, NULL));
+		shown->lives = lives->value;
+	}
+
+	shown->drawn = TRUE;
+}
+
+/**
+ * @brief Plots a label on a black background from the label strip cache.
+ * @details The label is rendered into the cache the first time it is plotted.
+ * If it is too long for the cache or the cache is full, it is rendered
+ * straight to the frame buffer instead.
+ *
+ * @param base The frame buffer to plot on.
+ * @param label The label to plot.
+ */
+void plotLabelStrip(UINT32* const base, const Label* const label)
+{
+	const LabelStrip* const strip = findLabelStrip(label->text);
+
+	int column;
+
+	if (strip == NULL)
+	{
+		renderLabel((UINT16 *)base, label, TRUE);
+	}
+	else
+	{
+		for (column = 0; column < strip->numChars / 2; column++)
+		{
+			plot_inv32(base, label->x + column * 2 * FONT16_WIDTH, label->y,
+					   FONT16_HEIGHT, strip->columns[column]);
+		}
+
+		if (strip->numChars % 2 != 0 && strip->lastGlyph != NULL)
+		{
+			plot_inv16((UINT16 *)base, label->x + column * 2 * FONT16_WIDTH,
+					   label->y, FONT16_HEIGHT, strip->lastGlyph);
+		}
+	}
+}
+
+/**
+ * @brief Finds the label strip holding the given text, rendering it into the
+ * cache if it is not there yet.
+ *
+ * @param text The text of the label.
+ * @return The label strip; NULL if the text is too long for the cache or the
+ * cache is full.
+ */
+const LabelStrip* findLabelStrip(const char* const text)
+{
+	const LabelStrip* strip = NULL;
+	int               index;
+
+	for (index = 0; index < numLabelStrips && strip == NULL; index++)
+	{
+		if (strcmp(labelStrips[index].text, text) == 0)
+		{
+			strip = &labelStrips[index];
+		}
+	}
+
+	if (strip == NULL && numLabelStrips < MAX_LABEL_STRIPS &&
+		strlen(text) <= HUD_LABEL_LEN)
+	{
+		buildLabelStrip(&labelStrips[numLabelStrips], text);
+		strip = &labelStrips[numLabelStrips++];
+	}
+
+	return strip;
+}
+
+/**
+ * @brief Renders the text of a label into a label strip.
+ *
+ * @param strip The LabelStrip to render into.
+ * @param text The text of the label. Must be no longer than HUD_LABEL_LEN.
+ */
+void buildLabelStrip(LabelStrip* const strip, const char* const text)
+{
+	const UINT16* glyph;
+	int           index;
+	int           row;
+
+	strcpy(strip->text, text);
+	strip->numChars  = strlen(text);
+	strip->lastGlyph = NULL;
+	memset(strip->columns, 0, sizeof(strip->columns));
+
+	for (index = 0; index < strip->numChars; index++)
+	{
+		glyph = getFont16Char(text[index], NULL);
+
+		if (index % 2 == 0 && index == strip->numChars - 1)
+		{
+			strip->lastGlyph = glyph;
+		}
+		else if (glyph != NULL)
+		{
+			for (row = 0; row < FONT16_HEIGHT; row++)
+			{
+				strip->columns[index / 2][row] |=
+					(UINT32)glyph[row] << (index % 2 == 0 ? FONT16_WIDTH : 0);
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,107 @@
+/**
+ * @file hud.h
+ * @author Academia Team
+ * @brief Keeps the scores and lives shown on a frame buffer up to date while
+ * plotting as little as possible.
+ * @details Every frame buffer has its own Hud that remembers what was last
+ * plotted on it. Only the digits that differ from those are plotted again, and
+ * a player whose score and lives have not changed is skipped altogether. The
+ * labels are rendered once into strips that are plotted a long at a time.
+ *
+ * @copyright Copyright Academia Team 2023
+ */
+
+#ifndef HUD_H
+#define HUD_H
+
+#include "bool.h"
+#include "font16.h"
+#include "model.h"
+#include "types.h"
+
+/**
+ * @brief The most players whose score and lives a Hud can show.
+ */
+#define HUD_MAX_PLAYERS 2
+
+/**
+ * @brief The most digits that a score shown by a Hud can have.
+ */
+#define HUD_SCORE_DIGITS SCORE_DIGITS
+
+/**
+ * @brief Marks a place of a score that has no digit plotted at it.
+ */
+#define HUD_NO_DIGIT (-1)
+
+/**
+ * @brief Marks a place of a score whose contents are unknown.
+ */
+#define HUD_UNKNOWN_DIGIT (-2)
+
+/**
+ * @brief The longest label that can be held in a LabelStrip.
+ */
+#define HUD_LABEL_LEN 8
+
+/**
+ * @brief The most labels that can be held in the label strip cache at once.
+ */
+#define MAX_LABEL_STRIPS 4
+
+/**
+ * @brief What was last plotted on a frame buffer for a single player.
+ */
+typedef struct
+{
+	UINT32 score;
+	int    lives;
+	int    digits[HUD_SCORE_DIGITS];
+	BOOL   drawn;
+} HudPlayer;
+
+/**
+ * @brief What was last plotted on a frame buffer for every player.
+ */
+typedef struct
+{
+	HudPlayer players[HUD_MAX_PLAYERS];
+} Hud;
+
+/**
+ * @brief The text of a label rendered ahead of time.
+ * @details Every pair of characters is joined into a single 32-bit wide
+ * column, so that the label can be plotted a column at a time. The glyph of
+ * the last character is kept on its own for labels with an odd number of
+ * characters.
+ */
+typedef struct
+{
+	char          text[HUD_LABEL_LEN + 1];
+	UINT32        columns[HUD_LABEL_LEN / 2][FONT16_HEIGHT];
+	const UINT16* lastGlyph;
+	int           numChars;
+} LabelStrip;
+
+/**
+ * @brief Forgets what was plotted on the frame buffer of a Hud, so that the
+ * labels and every digit are plotted the next time it is rendered.
+ *
+ * @param hud The Hud to initialize.
+ */
+void initHud(Hud* const hud);
+
+/**
+ * @brief Brings the scores and lives shown on a frame buffer up to date with
+ * the world.
+ * @details The labels of a player are plotted the first time the player is
+ * rendered after initHud(). Afterwards, only the digits that have changed
+ * since the Hud was last rendered are plotted.
+ *
+ * @param base The frame buffer that the Hud belongs to.
+ * @param hud The Hud of the frame buffer.
+ * @param world The world that holds the scores and lives to show.
+ */
+void renderHud(UINT32* const base, Hud* const hud, const World* const world);
+
+#endif
\ No newline at end of file
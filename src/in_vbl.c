@@ -12,19 +12,27 @@
 #include "ints.h"
 #include "raster.h"
 #include "renderer.h"
+#include "timer.h"
 #include "types.h"
 #include "vbl.h"
 
 /**
- * @brief The cursor will move every 0.5 seconds when controlled via the
+ * @brief The cursor moves on every tick while it is controlled via the
  * keyboard.
  */
-#define TICKS_BETWEEN_CURSOR_MOV 35
+#define TICKS_BETWEEN_CURSOR_MOV 1
 
 BOOL   plotMouse = FALSE;
 UINT16 oldCursX;
 UINT16 oldCursY;
-UINT32 cursorMovTime = UINT32_MAX;
+/**
+ * @brief The timers run by the VBL ISR while the cursor is shown, which are
+ * moved on to the time given by the VBL clock.
+ */
+TimerWheel cursorTimers;
+Timer      cursorMovTimer;
+
+void move_kybd_cursor(void);
 
 /**
  * @brief The function that will render the mouse cursor within the VBL ISR.
@@ -38,38 +46,20 @@ void input_vbl(void)
 {
 	UINT16 *currVideoBase;
 
-	if (kybdMouseMov != M_NONE && cursorMovTime == UINT32_MAX)
+	if (kybdMouseMov == M_NONE)
 	{
-		cursorMovTime = get_time() + TICKS_BETWEEN_CURSOR_MOV;
+		stop_timer(&cursorMovTimer);
 	}
-
-	if (cursorMovTime >= get_time())
+	else if (!timer_pending(&cursorMovTimer))
 	{
-		switch(kybdMouseMov)
-		{
-			case M_LEFT:
-				setRelMousePos(-KEYBOARD_M_MOVE_DIST, 0);
-				break;
-			case M_RIGHT:
-				setRelMousePos(+KEYBOARD_M_MOVE_DIST, 0);
-				break;
-			case M_UP:
-				setRelMousePos(0, -KEYBOARD_M_MOVE_DIST);
-				break;
-			case M_DOWN:
-				setRelMousePos(0, +KEYBOARD_M_MOVE_DIST);
-				break;
-			default:
-				cursorMovTime = UINT32_MAX;
-				break;
-		}
-
-		if (cursorMovTime != UINT32_MAX)
-		{
-			cursorMovTime += TICKS_BETWEEN_CURSOR_MOV;
-		}
+		/* The wheel was last moved on to the previous tick, so the cursor
+		   first moves on this one. */
+		start_timer(&cursorTimers, &cursorMovTimer, 1,
+					TICKS_BETWEEN_CURSOR_MOV);
 	}
 
+	advance_timers(&cursorTimers, get_time());
+
 	if (!(mouse.x == oldCursX && mouse.y == oldCursY))
 	{
 		currVideoBase = get_video_base();
@@ -79,6 +69,30 @@ void input_vbl(void)
 	}
 }
 
+/**
+ * @brief Moves the cursor in the direction held down on the keyboard.
+ */
+void move_kybd_cursor(void)
+{
+	switch(kybdMouseMov)
+	{
+		case M_LEFT:
+			setRelMousePos(-KEYBOARD_M_MOVE_DIST, 0);
+			break;
+		case M_RIGHT:
+			setRelMousePos(+KEYBOARD_M_MOVE_DIST, 0);
+			break;
+		case M_UP:
+			setRelMousePos(0, -KEYBOARD_M_MOVE_DIST);
+			break;
+		case M_DOWN:
+			setRelMousePos(0, +KEYBOARD_M_MOVE_DIST);
+			break;
+		default:
+			break;
+	}
+}
+
 void hide_cursor(void)
 {
 	int    oldIpl;
@@ -89,6 +103,7 @@ void hide_cursor(void)
 	{
 		renderCursor(get_video_base(), oldCursX, oldCursY);
 		vbl_unregister(input_vbl);
+		stop_timer(&cursorMovTimer);
 
 		plotMouse = FALSE;
 	}
@@ -105,6 +120,11 @@ void show_cursor(void)
 	if (!plotMouse)
 	{
 		renderCursor(get_video_base(), mouse.x, mouse.y);
+
+		/* The wheel starts at the current time, so that the time spent while
+		   the cursor was hidden is not run through. */
+		init_timer_wheel(&cursorTimers, get_time());
+		init_timer(&cursorMovTimer, move_kybd_cursor);
 		vbl_register(input_vbl);
 
 		oldCursX  = mouse.x;
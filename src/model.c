@@ -21,7 +21,7 @@
 /**
  * @brief Randomly chooses between LEFT and RIGHT.
  */
-#define randHorzDir() ((random(1) == 0) ? M_LEFT : M_RIGHT)
+#define randHorzDir() ((randomInt(1) == 0) ? M_LEFT : M_RIGHT)
 
 /**
  * @brief Initializes a row with grass cells and no hazards.
@@ -122,6 +122,8 @@ void initWorld (World* world, int numPlayers)
 		world->numWorldShifts = 0;
 		world->copyCells      = FALSE;
 		world->renderCells    = FALSE;
+		world->pendingShifts  = 0;
+		world->numStaleCells  = 0;
 
 		world->aCount = 0;
 		world->bCount = 0;
@@ -146,12 +148,38 @@ void initWorld (World* world, int numPlayers)
 
 void initRow(World* world, Row* row, int rowY)
 {
-	prepRow(row, rowY, random(MAX_ROW_CELL_TYPE), randHorzDir());
+	prepRow(row, rowY, randomInt(MAX_ROW_CELL_TYPE), randHorzDir());
 	initObstacle(row);
 	initCollectable(world, row);
 	initHazard(row);
 }
 
+void invalidateCell(World* world, int row, int column)
+{
+	int  index;
+	BOOL found = FALSE;
+
+	for (index = 0; index < world->numStaleCells && !found; index++)
+	{
+		found = (world->staleCells[index].row == row &&
+				 world->staleCells[index].column == column);
+	}
+
+	if (!found && !world->renderCells)
+	{
+		if (world->numStaleCells < MAX_STALE_CELLS)
+		{
+			world->staleCells[world->numStaleCells].row    = row;
+			world->staleCells[world->numStaleCells].column = column;
+			world->numStaleCells++;
+		}
+		else
+		{
+			world->renderCells = TRUE;
+		}
+	}
+}
+
 void prepRow(Row* row, int rowY, CellType rowType, Direction dir)
 {
 	int cellX;
@@ -190,13 +218,13 @@ void initObstacle(Row* row)
 		for (index = 0; index < MAX_CELLS; index++)
 		{
 			if (row->hedgeCount < MAX_HEDGES &&
-				random(HEDGE_PROB - 1) == 0)
+				randomInt(HEDGE_PROB - 1) == 0)
 			{
 				row->cells[index].cellType = HEDGE_CELL;
 				row->hedgeCount++;
 			}
 			else if (row->spikeCount < MAX_SPIKES &&
-					 random(SPIKE_PROB - 1) == 0)
+					 randomInt(SPIKE_PROB - 1) == 0)
 			{
 				row->cells[index].cellType = SPIKE_CELL;
 				row->spikeCount++;
@@ -221,7 +249,7 @@ void initCollectable(World* world, Row* row)
 		{
 			if (world->aCount < MAX_A_COLLECTABLES)
 			{
-				prob = random(A_PROB - 1);
+				prob = randomInt(A_PROB - 1);
 
 				if (prob == 0)
 				{
@@ -233,7 +261,7 @@ void initCollectable(World* world, Row* row)
 
 			if (!spawnedCollectable && world->bCount < MAX_B_COLLECTABLES)
 			{
-				prob = random(B_PROB - 1);
+				prob = randomInt(B_PROB - 1);
 
 				if (prob == 0)
 				{
@@ -245,7 +273,7 @@ void initCollectable(World* world, Row* row)
 
 			if (!spawnedCollectable && world->cCount < MAX_C_COLLECTABLES)
 			{
-				prob = random(C_PROB - 1);
+				prob = randomInt(C_PROB - 1);
 
 				if (prob == 0)
 				{
@@ -318,15 +346,15 @@ BOOL probPlaceHazard(HazType hazard)
 
 	if (hazard == CAR_HAZ)
 	{
-		probToPlaceHaz = (random(CAR_PROB - 1) == 0);
+		probToPlaceHaz = (randomInt(CAR_PROB - 1) == 0);
 	}
 	else if (hazard == TRAIN_HAZ)
 	{
-		probToPlaceHaz = (random(TRAIN_PROB - 1) == 0);
+		probToPlaceHaz = (randomInt(TRAIN_PROB - 1) == 0);
 	}
 	else if (hazard == FEATHERS_HAZ)
 	{
-		probToPlaceHaz = (random(FEATHERS_PROB - 1) == 0);
+		probToPlaceHaz = (randomInt(FEATHERS_PROB - 1) == 0);
 	}
 	else
 	{
@@ -339,6 +367,7 @@ BOOL probPlaceHazard(HazType hazard)
 void initScore (int x, int y, Score* scoreBox)
 {
 	scoreBox->value = 0;
+	memset(scoreBox->bcd, 0, SCORE_BCD_BYTES);
 	scoreBox->x = x + SCORE_X_TEXT_DIST;
 	scoreBox->y = y;
 
@@ -349,22 +378,102 @@ void initScore (int x, int y, Score* scoreBox)
 void updateScore (UINT32 value, Score* scoreBox)
 {
 	UINT32 newScore;
+	UINT8  addend[SCORE_BCD_BYTES];
 
 	newScore = scoreBox->value + value;
 
 	if (newScore < scoreBox->value || newScore < value)
 	{
 		scoreBox->value = UINT32_MAX;
+		toScoreBcd(UINT32_MAX, scoreBox->bcd);
 	}
 	else
 	{
 		scoreBox->value = newScore;
+		toScoreBcd(value, addend);
+		addScoreBcd(scoreBox->bcd, addend);
 	}
 }
 
+void toScoreBcd(UINT32 value, UINT8 bcd[])
+{
+	int bit;
+	int index;
+
+	memset(bcd, 0, SCORE_BCD_BYTES);
+
+	for (bit = 0; bit < 32; bit++)
+	{
+		/* Any digit of 5 or more would be 10 or more once shifted, so 3 is
+		   added to it beforehand to carry it into the next digit instead. */
+		for (index = 0; index < SCORE_BCD_BYTES; index++)
+		{
+			if ((bcd[index] & 0x0F) >= 0x05)
+			{
+				bcd[index] += 0x03;
+			}
+
+			if ((bcd[index] & 0xF0) >= 0x50)
+			{
+				bcd[index] += 0x30;
+			}
+		}
+
+		for (index = 0; index < SCORE_BCD_BYTES - 1; index++)
+		{
+			bcd[index] = (bcd[index] << 1) | (bcd[index + 1] >> 7);
+		}
+		bcd[index] = (bcd[index] << 1) | (UINT8)(value >> 31);
+
+		value <<= 1;
+	}
+}
+
+void addScoreBcd(UINT8 dest[], const UINT8 src[])
+{
+	int index;
+	int carry = 0;
+	int low;
+	int high;
+
+	for (index = SCORE_BCD_BYTES - 1; index >= 0; index--)
+	{
+		low  = (dest[index] & 0x0F) + (src[index] & 0x0F) + carry;
+		high = (dest[index] >> 4) + (src[index] >> 4);
+
+		if (low > 9)
+		{
+			low -= 10;
+			high++;
+		}
+
+		carry = (high > 9);
+
+		if (carry)
+		{
+			high -= 10;
+		}
+
+		dest[index] = (UINT8)((high << 4) | low);
+	}
+}
+
+int firstScoreDigit(const Score* const score)
+{
+	int place = 0;
+
+	while (place < SCORE_DIGITS - 1 && scoreDigit(score, place) == 0)
+	{
+		place++;
+	}
+
+	return place;
+}
+
 void copyScore(Score* dest, const Score* const src)
 {
 	dest->value = src->value;
+	memcpy(dest->bcd, src->bcd, SCORE_BCD_BYTES);
 }
 
 SINT32 cmpScore(const Score* const s1, const Score* const s2)
@@ -389,7 +498,8 @@ void initLabel(Label* label, int x, int y, const char* text)
 {
 	label->x = x;
 	label->y = y;
-	memcpy(label->text, text, MAX_LABEL_LEN + 1);
+	strncpy(label->text, text, MAX_LABEL_LEN);
+	label->text[MAX_LABEL_LEN] = '\0';
 }
 
 void initCorePlayer(CorePlayer* player, int numPlayers)
@@ -477,7 +587,8 @@ void coordToIndex(const World* const world, int* row, int* column, int x, int y)
 		   world->usableRows;
 }
 
-int addButton(Menu* menu, int x, int y, int height, int width, LabelStr text)
+int addButton(Menu* menu, int x, int y, int height, int width,
+			  const char* text)
 {
 	int ID = -1;
 
@@ -71,6 +71,17 @@
 
 #define MAX_POSSIBLE_SCORE 4294967200UL
 
+/**
+ * @brief The most decimal digits that a score can have.
+ */
+#define SCORE_DIGITS UINT32_MAX_DIGITS
+
+/**
+ * @brief The number of bytes that a score takes up in packed BCD, two digits
+ * to a byte.
+ */
+#define SCORE_BCD_BYTES (SCORE_DIGITS / 2)
+
 #define ROW_HEIGHT 32
 
 #define MAX_ROW_Y 352
@@ -95,6 +106,12 @@
 
 #define NUM_SAFE_ROWS 3
 
+/**
+ * @brief The most cells that can be waiting to be rendered again at once (see
+ * invalidateCell()).
+ */
+#define MAX_STALE_CELLS 8
+
 #define PLAYER_START_X 304
 #define PLAYER_START_Y 288
 
@@ -207,12 +224,19 @@ typedef struct
 	LabelStr text;
 } Label;
 
+/**
+ * @brief A score, kept both in binary and in packed BCD so that its digits can
+ * be read without dividing.
+ * @details The most significant digit is held in the upper nibble of the
+ * first byte of bcd.
+ */
 typedef struct
 {
 	int    x;
 	int    y;
 	Label  label;
 	UINT32 value;
+	UINT8  bcd[SCORE_BCD_BYTES];
 	BOOL   labelRendered;
 } Score;
 
@@ -290,6 +314,16 @@ typedef struct
 	Hazard    hazards[MAX_HAZARD_IN_ROW];
 } Row;
 
+/**
+ * @brief Identifies a single cell of the world by the index of its row in the
+ * world and its index in that row.
+ */
+typedef struct
+{
+	int row;
+	int column;
+} CellRef;
+
 typedef struct
 {
 	int x;
@@ -320,6 +354,10 @@ typedef struct
 	int  numWorldShifts;
 	BOOL copyCells;
 	BOOL renderCells;
+	int  pendingShifts;
+
+	CellRef staleCells[MAX_STALE_CELLS];
+	int     numStaleCells;
 
 	int aCount;
 	int bCount;
@@ -395,6 +433,27 @@ typedef char HazName[MAX_HAZ_NAME_LEN + 1];
 #define getTopBorderHeight(numPlayers) \
 	(numPlayers == 1 ? TOP_BORDER_HEIGHT_1P : TOP_BORDER_HEIGHT_2P)
 
+/**
+ * @brief Determines if the cells of the world need to be rendered again,
+ * either because they have changed or because the world has shifted.
+ * @param world The game world.
+ * @return TRUE if the cells need to be rendered; FALSE otherwise.
+ */
+#define cellsChanged(world) \
+	((world)->renderCells || (world)->pendingShifts > 0 || \
+	 (world)->numStaleCells > 0)
+
+/**
+ * @brief Gives the decimal digit of a score at the given place.
+ * @param score The Score to get a digit of.
+ * @param place The place of the digit, starting at zero for the most
+ * significant of all SCORE_DIGITS digits.
+ * @return The digit, between 0 and 9.
+ */
+#define scoreDigit(score, place) \
+	(((place) & 1) != 0 ? (score)->bcd[(place) >> 1] & 0x0F : \
+					(score)->bcd[(place) >> 1] >> 4)
+
 /**
  * @brief Places the coordinates of the label into the provided x and y
  * variables.
@@ -562,6 +621,20 @@ void initWorld (World* world, int numPlayers);
  */
 void initRow(World* world, Row* row, int rowY);
 
+/**
+ * @brief Marks a single cell of the world as needing to be rendered again,
+ * such as after its collectable has been picked up.
+ * @details Only the cells marked this way are rendered again, unless every
+ * cell is already to be rendered. Marking the same cell twice has no further
+ * effect. If too many cells are marked before they are rendered, every cell is
+ * rendered again instead (see renderCells).
+ * 
+ * @param world The World that the cell belongs to.
+ * @param row The index of the row of the cell in the world.
+ * @param column The index of the cell in its row.
+ */
+void invalidateCell(World* world, int row, int column);
+
 /**
  * @brief Initializes a cell with the given cellType and x coordinate.
  * @details Every cell has a random chance of containing a collectable.
@@ -631,11 +704,42 @@ void initLabel(Label* label, int x, int y, const char* text);
 
 /**
  * @brief Increments the score by a given amount.
+ * @details The packed BCD form of the score is incremented a digit at a time,
+ * carrying between digits the way ABCD does, so that no division is needed.
+ * The score stops at UINT32_MAX instead of overflowing.
  * @param value The value that is added to the score.
  * @param scoreBox The Score object which will have its value incremented.
  */
 void updateScore (UINT32 value, Score* scoreBox);
 
+/**
+ * @brief Converts a binary value to packed BCD.
+ * @details Uses the shift-and-add-3 method, which needs no division.
+ * 
+ * @param value The value to convert.
+ * @param bcd Returns the packed BCD form of the value by reference. Must hold
+ * SCORE_BCD_BYTES bytes.
+ */
+void toScoreBcd(UINT32 value, UINT8 bcd[]);
+
+/**
+ * @brief Adds one packed BCD value to another a digit at a time.
+ * @details Any carry out of the most significant digit is lost.
+ * 
+ * @param dest The value to add to. Returns the sum by reference.
+ * @param src The value to add. Both hold SCORE_BCD_BYTES bytes.
+ */
+void addScoreBcd(UINT8 dest[], const UINT8 src[]);
+
+/**
+ * @brief Finds the first digit of a score that is not a leading zero.
+ * @details A score of zero still has its last digit shown.
+ * 
+ * @param score The Score to search.
+ * @return The place of the digit, as taken by scoreDigit.
+ */
+int firstScoreDigit(const Score* const score);
+
 /**
  * @brief Copy the score values from one object to another.
  * 
@@ -722,7 +826,8 @@ void coordToIndex(const World* const world, int* row, int* column, int x, int y)
  * @return A integral ID correspond to the button or -1 if a button couldn't be
  * added.
  */
-int addButton(Menu* menu, int x, int y, int height, int width, LabelStr text);
+int addButton(Menu* menu, int x, int y, int height, int width,
+			  const char* text);
 
 /**
  * @brief Selects the button in a Menu with the specified ID.
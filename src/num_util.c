@@ -10,7 +10,7 @@
 
 #include "num_util.h"
 
-int random(int rangeMax)
+int randomInt(int rangeMax)
 {
 	int value;
 
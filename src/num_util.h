@@ -35,7 +35,7 @@
  * @param rangeMax The max limit on the random number generator.
  * @return An integral number between 0 and rangeMax, inclusive.
  */
-int random(int rangeMax);
+int randomInt(int rangeMax);
 
 /**
  * @brief Resets the rng to its original state.
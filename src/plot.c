@@ -0,0 +1,336 @@
+/**
+ * @file plot.c
+ * @author Academia Team
+ * @brief Contains the portable C versions of the functions used to plot
+ * bitmaps to an area in memory for use by the Atari ST's monochrome screen.
+ * @details Only one of this file and plot_asm.s is to be linked in (see
+ * PLOT_OBJ in the MAKEFILE).
+ * 
+ * Every row loop is generated from a single template (see defBlitters()) for
+ * each combination of raster mode and clipping class. Each plotting function
+ * only validates and clips its bitmap and then hands the rows off to the
+ * blitter picked out of a table indexed by the mode and the clipping class.
+ * 
+ * @copyright Copyright Academia Team 2023
+ */
+
+#include <stdlib.h>
+
+#include "endian.h"
+#include "raster.h"
+
+/**
+ * @brief The ways in which the rows of a bitmap can line up with the units of
+ * screen memory that they are plotted to.
+ */
+typedef enum
+{
+	CLIP_LEFT         = 0,
+	CLIP_RIGHT        = 1,
+	UNCLIPPED_ALIGNED = 2,
+	UNCLIPPED_SPLIT   = 3
+} ClipClass;
+
+#define NUM_CLIP_CLASSES 4
+
+typedef void (*Blit32)(UINT32* scrn, const UINT32* src, int rows, int shift);
+typedef void (*Blit16)(UINT16* scrn, const UINT16* src, int rows, int shift);
+typedef void (*Blit8)(UINT8* scrn, const UINT8* src, int rows, int shift);
+
+/**
+ * @brief Gives a unit of the given type with every bit set.
+ */
+#define unitMax(unit) ((unit)~(unit)0)
+
+/**
+ * @brief Leaves a value untouched, for units that don't need to be swapped.
+ */
+#define noSwap(value) (value)
+
+/*
+ * The operations used to combine part of a row with a unit on screen. The
+ * value holds the part of the row already shifted into place and the mask
+ * selects the bits of the unit that the row covers.
+ */
+
+#define orUnit(scrnPos, value, mask, swap) (*(scrnPos) |= swap(value))
+
+#define xorUnit(scrnPos, value, mask, swap) (*(scrnPos) ^= swap(value))
+
+#define copyUnit(scrnPos, value, mask, swap) \
+	(*(scrnPos) = swap((swap(*(scrnPos)) & ~(mask)) | (value)))
+
+#define invUnit(scrnPos, value, mask, swap) \
+	(*(scrnPos) = swap((swap(*(scrnPos)) & ~(mask)) | ((value) ^ (mask))))
+
+#define andUnit(scrnPos, value, mask, swap) \
+	(*(scrnPos) &= swap((value) | ~(mask)))
+
+/**
+ * @brief Defines a blitter for every ClipClass that combines rows with the
+ * screen using the given operation.
+ * @details Each blitter plots the given number of rows starting at scrn, which
+ * must point to the first unit on screen that the first row touches. The shift
+ * is the number of pixels that x is away from a unit boundary.
+ */
+#define defBlitters(prefix, unit, width, lineLen, swap, putUnit) \
+void prefix##Left(unit* scrn, const unit* src, int rows, int shift) \
+{ \
+	for (; rows > 0; rows--, src++, scrn += (lineLen)) \
+	{ \
+		putUnit(scrn, (unit)(*src << shift), \
+				(unit)(unitMax(unit) << shift), swap); \
+	} \
+} \
+\
+void prefix##Right(unit* scrn, const unit* src, int rows, int shift) \
+{ \
+	for (; rows > 0; rows--, src++, scrn += (lineLen)) \
+	{ \
+		putUnit(scrn, (unit)(*src >> shift), \
+				(unit)(unitMax(unit) >> shift), swap); \
+	} \
+} \
+\
+void prefix##Aligned(unit* scrn, const unit* src, int rows, int shift) \
+{ \
+	for (; rows > 0; rows--, src++, scrn += (lineLen)) \
+	{ \
+		putUnit(scrn, *src, unitMax(unit), swap); \
+	} \
+} \
+\
+void prefix##Split(unit* scrn, const unit* src, int rows, int shift) \
+{ \
+	const int shiftFromRight = (width) - shift; \
+\
+	for (; rows > 0; rows--, src++, scrn += (lineLen)) \
+	{ \
+		putUnit(scrn, (unit)(*src >> shift), \
+				(unit)(unitMax(unit) >> shift), swap); \
+		putUnit(scrn + 1, (unit)(*src << shiftFromRight), \
+				(unit)(unitMax(unit) << shiftFromRight), swap); \
+	} \
+}
+
+/**
+ * @brief Gives the blitters defined by defBlitters() in the order of ClipClass.
+ */
+#define blitters(prefix) \
+	{prefix##Left, prefix##Right, prefix##Aligned, prefix##Split}
+
+/**
+ * @brief Defines a function that validates and clips a bitmap of the given
+ * width before handing its visible rows off to the right blitter out of the
+ * given set (see blitters()).
+ */
+#define defPlotWith(name, unit, blit, width, minX, maxVisX, lineLen, divShift) \
+void name(unit* const base, int x, int y, int height, \
+		  const unit* const bitmap, const blit blits[]) \
+{ \
+	const unit* bmpSrcPos = bitmap; \
+	unit* scrnPlotPos = base; \
+\
+	int bitmapEndY = y + height - 1; \
+	int shift = abs(x) & ((width) - 1); \
+\
+	if (bitmapEndY > SCRN_MAX_Y) \
+	{ \
+		bitmapEndY = SCRN_MAX_Y; \
+	} \
+\
+	if (x >= (minX) && x < SCRN_LEN \
+	&& bitmapEndY >= 0 && y <= SCRN_MAX_Y \
+	&& height > 0) \
+	{ \
+		if (y < 0) \
+		{ \
+			bmpSrcPos -= y; \
+			y = 0; \
+		} \
+\
+		scrnPlotPos += y * (lineLen); \
+\
+		if (x < 0) \
+		{ \
+			blits[CLIP_LEFT](scrnPlotPos, bmpSrcPos, bitmapEndY - y + 1, \
+							 shift); \
+		} \
+		else \
+		{ \
+			scrnPlotPos += x >> (divShift); \
+\
+			if (x > (maxVisX)) \
+			{ \
+				blits[CLIP_RIGHT](scrnPlotPos, bmpSrcPos, bitmapEndY - y + 1, \
+								  shift); \
+			} \
+			else if (shift == 0) \
+			{ \
+				blits[UNCLIPPED_ALIGNED](scrnPlotPos, bmpSrcPos, \
+										 bitmapEndY - y + 1, shift); \
+			} \
+			else \
+			{ \
+				blits[UNCLIPPED_SPLIT](scrnPlotPos, bmpSrcPos, \
+									   bitmapEndY - y + 1, shift); \
+			} \
+		} \
+	} \
+}
+
+defBlitters(or32, UINT32, 32, SCRN_LEN_LONG, swap32OnLE, orUnit)
+defBlitters(xor32, UINT32, 32, SCRN_LEN_LONG, swap32OnLE, xorUnit)
+defBlitters(copy32, UINT32, 32, SCRN_LEN_LONG, swap32OnLE, copyUnit)
+defBlitters(inv32, UINT32, 32, SCRN_LEN_LONG, swap32OnLE, invUnit)
+defBlitters(alpha32, UINT32, 32, SCRN_LEN_LONG, swap32OnLE, andUnit)
+
+defBlitters(or16, UINT16, 16, SCRN_LEN_WORDS, swap16OnLE, orUnit)
+defBlitters(xor16, UINT16, 16, SCRN_LEN_WORDS, swap16OnLE, xorUnit)
+defBlitters(copy16, UINT16, 16, SCRN_LEN_WORDS, swap16OnLE, copyUnit)
+defBlitters(inv16, UINT16, 16, SCRN_LEN_WORDS, swap16OnLE, invUnit)
+
+defBlitters(or8, UINT8, 8, SCRN_LEN_BYTES, noSwap, orUnit)
+defBlitters(xor8, UINT8, 8, SCRN_LEN_BYTES, noSwap, xorUnit)
+defBlitters(copy8, UINT8, 8, SCRN_LEN_BYTES, noSwap, copyUnit)
+defBlitters(inv8, UINT8, 8, SCRN_LEN_BYTES, noSwap, invUnit)
+
+/**
+ * @brief The blitters for 32-bit wide bitmaps indexed by RastMode and then by
+ * ClipClass.
+ */
+const Blit32 blit32s[NUM_RAST_MODES][NUM_CLIP_CLASSES] =
+{
+	blitters(or32), blitters(xor32), blitters(copy32), blitters(inv32)
+};
+
+/**
+ * @brief The blitters for 32-bit wide alpha bitmaps indexed by ClipClass.
+ */
+const Blit32 alpha32s[NUM_CLIP_CLASSES] = blitters(alpha32);
+
+/**
+ * @brief The blitters for 16-bit wide bitmaps indexed by RastMode and then by
+ * ClipClass.
+ */
+const Blit16 blit16s[NUM_RAST_MODES][NUM_CLIP_CLASSES] =
+{
+	blitters(or16), blitters(xor16), blitters(copy16), blitters(inv16)
+};
+
+/**
+ * @brief The blitters for 8-bit wide bitmaps indexed by RastMode and then by
+ * ClipClass.
+ */
+const Blit8 blit8s[NUM_RAST_MODES][NUM_CLIP_CLASSES] =
+{
+	blitters(or8), blitters(xor8), blitters(copy8), blitters(inv8)
+};
+
+defPlotWith(plotWith32, UINT32, Blit32, 32, RAST32_MIN_X, RAST32_MAX_VIS_X,
+			SCRN_LEN_LONG, DIV_SHIFT_BY_32)
+defPlotWith(plotWith16, UINT16, Blit16, 16, RAST16_MIN_X, RAST16_MAX_VIS_X,
+			SCRN_LEN_WORDS, DIV_SHIFT_BY_16)
+defPlotWith(plotWith8, UINT8, Blit8, 8, RAST8_MIN_X, RAST8_MAX_VIS_X,
+			SCRN_LEN_BYTES, DIV_SHIFT_BY_8)
+
+void plot_rast32(UINT32* const base, int x, int y, int height,
+				 const UINT32* const bitmap, BOOL destructive,
+				 BOOL blackScreen)
+{
+	plotWith32(base, x, y, height, bitmap,
+			   blit32s[rastMode(destructive, blackScreen)]);
+}
+
+void plot_or32(UINT32* const base, int x, int y, int height,
+			   const UINT32* const bitmap)
+{
+	plotWith32(base, x, y, height, bitmap, blit32s[RAST_OR]);
+}
+
+void plot_xor32(UINT32* const base, int x, int y, int height,
+				const UINT32* const bitmap)
+{
+	plotWith32(base, x, y, height, bitmap, blit32s[RAST_XOR]);
+}
+
+void plot_copy32(UINT32* const base, int x, int y, int height,
+				 const UINT32* const bitmap)
+{
+	plotWith32(base, x, y, height, bitmap, blit32s[RAST_COPY]);
+}
+
+void plot_inv32(UINT32* const base, int x, int y, int height,
+				const UINT32* const bitmap)
+{
+	plotWith32(base, x, y, height, bitmap, blit32s[RAST_COPY_INV]);
+}
+
+void plot_alpha(UINT32* const base, int x, int y, int height,
+				const UINT32* const bitmap)
+{
+	plotWith32(base, x, y, height, bitmap, alpha32s);
+}
+
+void plot_rast16(UINT16* const base, int x, int y, int height,
+				 const UINT16* const bitmap, BOOL destructive,
+				 BOOL blackScreen)
+{
+	plotWith16(base, x, y, height, bitmap,
+			   blit16s[rastMode(destructive, blackScreen)]);
+}
+
+void plot_or16(UINT16* const base, int x, int y, int height,
+			   const UINT16* const bitmap)
+{
+	plotWith16(base, x, y, height, bitmap, blit16s[RAST_OR]);
+}
+
+void plot_xor16(UINT16* const base, int x, int y, int height,
+				const UINT16* const bitmap)
+{
+	plotWith16(base, x, y, height, bitmap, blit16s[RAST_XOR]);
+}
+
+void plot_copy16(UINT16* const base, int x, int y, int height,
+				 const UINT16* const bitmap)
+{
+	plotWith16(base, x, y, height, bitmap, blit16s[RAST_COPY]);
+}
+
+void plot_inv16(UINT16* const base, int x, int y, int height,
+				const UINT16* const bitmap)
+{
+	plotWith16(base, x, y, height, bitmap, blit16s[RAST_COPY_INV]);
+}
+
+void plot_rast8(UINT8* const base, int x, int y, int height,
+				const UINT8* const bitmap, BOOL destructive, BOOL blackScreen)
+{
+	plotWith8(base, x, y, height, bitmap,
+			  blit8s[rastMode(destructive, blackScreen)]);
+}
+
+void plot_or8(UINT8* const base, int x, int y, int height,
+			  const UINT8* const bitmap)
+{
+	plotWith8(base, x, y, height, bitmap, blit8s[RAST_OR]);
+}
+
+void plot_xor8(UINT8* const base, int x, int y, int height,
+			   const UINT8* const bitmap)
+{
+	plotWith8(base, x, y, height, bitmap, blit8s[RAST_XOR]);
+}
+
+void plot_copy8(UINT8* const base, int x, int y, int height,
+				const UINT8* const bitmap)
+{
+	plotWith8(base, x, y, height, bitmap, blit8s[RAST_COPY]);
+}
+
+void plot_inv8(UINT8* const base, int x, int y, int height,
+			   const UINT8* const bitmap)
+{
+	plotWith8(base, x, y, height, bitmap, blit8s[RAST_COPY_INV]);
+}
\ No newline at end of file
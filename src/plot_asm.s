@@ -0,0 +1,886 @@
+; Contains hand-tuned versions of the subroutines used to plot bitmaps to an
+; area in memory for use by the Atari ST's monochrome screen.
+;
+; Every row is rotated into place with a single ror and split between the
+; (at most two) units of screen memory it touches using precomputed masks, and
+; every row loop is unrolled to plot two rows per iteration.
+;
+; Only one of this file and plot.c is to be linked in (see PLOT_OBJ in the
+; MAKEFILE).
+; 
+; Copyright Academia Team 2023
+
+					include			rast_asm.i
+					include			scrn_asm.i
+
+					xdef			_plot_alpha
+					xdef			_plot_copy16
+					xdef			_plot_copy32
+					xdef			_plot_copy8
+					xdef			_plot_inv16
+					xdef			_plot_inv32
+					xdef			_plot_inv8
+					xdef			_plot_or16
+					xdef			_plot_or32
+					xdef			_plot_or8
+					xdef			_plot_rast16
+					xdef			_plot_rast32
+					xdef			_plot_rast8
+					xdef			_plot_xor16
+					xdef			_plot_xor32
+					xdef			_plot_xor8
+
+; The offsets of the parameters shared by every plotting subroutine from the
+; start of the stack frame.
+PLOT_BASE:			equ				8
+PLOT_X:				equ				12
+PLOT_Y:				equ				14
+PLOT_HEIGHT:		equ				16
+PLOT_BITMAP:		equ				18
+PLOT_DESTRUCT:		equ				22
+PLOT_BLACK:			equ				24
+
+
+;void plot_rast32(UINT32* const base, int x, int y, int height,
+;				 const UINT32* const bitmap, BOOL destructive,
+;				 BOOL blackScreen)
+;
+; Plots a 32-bit wide bitmap of any height. See raster.h for how clipping and
+; each combination of flags behave.
+;
+; Register Table:
+; ---------------
+; d0	-	Holds the current row of the bitmap.
+;		-	Holds the part of the current row that goes into the left long.
+; d1	-	Holds a value indicating if the bitmap only touches a single long of
+;			each line on screen.
+;		-	Holds the part of the current row that goes into the right long.
+; d2	-	Holds the number of rows (or pairs of rows) left to plot.
+; d3	-	Holds the number of pixels to rotate each row by.
+; d4	-	Holds the mask selecting the bits of a rotated row that belong to
+;			the left long (or the only visible long).
+; d5	-	Holds the complement of d4.
+; d7	-	Holds the RastMode to plot with.
+;		-	Holds the value to XOR each row with before it is destructively
+;			plotted (all ones on a black screen).
+; a0	-	Holds the position on screen to plot the current row.
+; a1	-	Holds the position of the current row of the bitmap.
+; a6	-	Holds the address of the start of the stack frame.
+
+_plot_rast32:		link			a6,#0
+					movem.l			d0-7/a0-1,-(sp)
+					bsr				plot_mode
+					bra				P32_PLOT
+
+;void plot_or32(UINT32* const base, int x, int y, int height,
+;				const UINT32* const bitmap)
+;void plot_xor32(UINT32* const base, int x, int y, int height,
+;				 const UINT32* const bitmap)
+;void plot_copy32(UINT32* const base, int x, int y, int height,
+;				  const UINT32* const bitmap)
+;void plot_inv32(UINT32* const base, int x, int y, int height,
+;				 const UINT32* const bitmap)
+;
+; Plot a 32-bit wide bitmap of any height using a fixed RastMode (see
+; raster.h). They share the body of plot_rast32(), with d7 set to the mode
+; instead of it being worked out from the flags.
+
+_plot_or32:			link			a6,#0
+					movem.l			d0-7/a0-1,-(sp)
+					moveq			#RAST_OR,d7
+					bra				P32_PLOT
+
+_plot_xor32:		link			a6,#0
+					movem.l			d0-7/a0-1,-(sp)
+					moveq			#RAST_XOR,d7
+					bra				P32_PLOT
+
+_plot_copy32:		link			a6,#0
+					movem.l			d0-7/a0-1,-(sp)
+					moveq			#RAST_COPY,d7
+					bra				P32_PLOT
+
+_plot_inv32:		link			a6,#0
+					movem.l			d0-7/a0-1,-(sp)
+					moveq			#RAST_COPY_INV,d7
+
+P32_PLOT:			moveq			#31,d4
+					moveq			#2,d5
+					bsr				plot_setup
+					tst.w			d2
+					beq				P32_RETURN
+
+					cmpi.w			#RAST_COPY,d7
+					bge				P32_MASKED
+					tst.w			d7
+					bne				P32_OVERLAY_XOR
+					tst.w			d1
+					bne				P32_OR1
+
+P32_OR2:			lsr.w			#1,d2
+					bcc				P32_OR2_EVEN
+					lea				-SCRN_LEN_BYTES(a0),a0
+					bra				P32_OR2_ODD
+P32_OR2_EVEN:		subq.w			#1,d2
+P32_OR2_LOOP:		move.l			(a1)+,d0
+					ror.l			d3,d0
+					move.l			d0,d1
+					and.l			d4,d0
+					eor.l			d0,d1
+					or.l			d0,(a0)
+					or.l			d1,4(a0)
+P32_OR2_ODD:		move.l			(a1)+,d0
+					ror.l			d3,d0
+					move.l			d0,d1
+					and.l			d4,d0
+					eor.l			d0,d1
+					or.l			d0,SCRN_LEN_BYTES(a0)
+					or.l			d1,SCRN_LEN_BYTES+4(a0)
+					lea				2*SCRN_LEN_BYTES(a0),a0
+					dbra			d2,P32_OR2_LOOP
+					bra				P32_RETURN
+
+P32_OR1:			lsr.w			#1,d2
+					bcc				P32_OR1_EVEN
+					lea				-SCRN_LEN_BYTES(a0),a0
+					bra				P32_OR1_ODD
+P32_OR1_EVEN:		subq.w			#1,d2
+P32_OR1_LOOP:		move.l			(a1)+,d0
+					ror.l			d3,d0
+					and.l			d4,d0
+					or.l			d0,(a0)
+P32_OR1_ODD:		move.l			(a1)+,d0
+					ror.l			d3,d0
+					and.l			d4,d0
+					or.l			d0,SCRN_LEN_BYTES(a0)
+					lea				2*SCRN_LEN_BYTES(a0),a0
+					dbra			d2,P32_OR1_LOOP
+					bra				P32_RETURN
+
+P32_OVERLAY_XOR:	tst.w			d1
+					bne				P32_XOR1
+
+P32_XOR2:			lsr.w			#1,d2
+					bcc				P32_XOR2_EVEN
+					lea				-SCRN_LEN_BYTES(a0),a0
+					bra				P32_XOR2_ODD
+P32_XOR2_EVEN:		subq.w			#1,d2
+P32_XOR2_LOOP:		move.l			(a1)+,d0
+					ror.l			d3,d0
+					move.l			d0,d1
+					and.l			d4,d0
+					eor.l			d0,d1
+					eor.l			d0,(a0)
+					eor.l			d1,4(a0)
+P32_XOR2_ODD:		move.l			(a1)+,d0
+					ror.l			d3,d0
+					move.l			d0,d1
+					and.l			d4,d0
+					eor.l			d0,d1
+					eor.l			d0,SCRN_LEN_BYTES(a0)
+					eor.l			d1,SCRN_LEN_BYTES+4(a0)
+					lea				2*SCRN_LEN_BYTES(a0),a0
+					dbra			d2,P32_XOR2_LOOP
+					bra				P32_RETURN
+
+P32_XOR1:			lsr.w			#1,d2
+					bcc				P32_XOR1_EVEN
+					lea				-SCRN_LEN_BYTES(a0),a0
+					bra				P32_XOR1_ODD
+P32_XOR1_EVEN:		subq.w			#1,d2
+P32_XOR1_LOOP:		move.l			(a1)+,d0
+					ror.l			d3,d0
+					and.l			d4,d0
+					eor.l			d0,(a0)
+P32_XOR1_ODD:		move.l			(a1)+,d0
+					ror.l			d3,d0
+					and.l			d4,d0
+					eor.l			d0,SCRN_LEN_BYTES(a0)
+					lea				2*SCRN_LEN_BYTES(a0),a0
+					dbra			d2,P32_XOR1_LOOP
+					bra				P32_RETURN
+
+					; Only the bits of each line covered by the bitmap are replaced.
+P32_MASKED:			move.l			d4,d5
+					not.l			d5
+					subq.l			#RAST_COPY,d7
+					neg.l			d7
+					tst.w			d1
+					bne				P32_MSK1
+
+P32_MSK2:			lsr.w			#1,d2
+					bcc				P32_MSK2_EVEN
+					lea				-SCRN_LEN_BYTES(a0),a0
+					bra				P32_MSK2_ODD
+P32_MSK2_EVEN:		subq.w			#1,d2
+P32_MSK2_LOOP:		move.l			(a1)+,d0
+					eor.l			d7,d0
+					ror.l			d3,d0
+					move.l			d0,d1
+					and.l			d4,d0
+					eor.l			d0,d1
+					and.l			d5,(a0)
+					or.l			d0,(a0)
+					and.l			d4,4(a0)
+					or.l			d1,4(a0)
+P32_MSK2_ODD:		move.l			(a1)+,d0
+					eor.l			d7,d0
+					ror.l			d3,d0
+					move.l			d0,d1
+					and.l			d4,d0
+					eor.l			d0,d1
+					and.l			d5,SCRN_LEN_BYTES(a0)
+					or.l			d0,SCRN_LEN_BYTES(a0)
+					and.l			d4,SCRN_LEN_BYTES+4(a0)
+					or.l			d1,SCRN_LEN_BYTES+4(a0)
+					lea				2*SCRN_LEN_BYTES(a0),a0
+					dbra			d2,P32_MSK2_LOOP
+					bra				P32_RETURN
+
+P32_MSK1:			lsr.w			#1,d2
+					bcc				P32_MSK1_EVEN
+					lea				-SCRN_LEN_BYTES(a0),a0
+					bra				P32_MSK1_ODD
+P32_MSK1_EVEN:		subq.w			#1,d2
+P32_MSK1_LOOP:		move.l			(a1)+,d0
+					eor.l			d7,d0
+					ror.l			d3,d0
+					and.l			d4,d0
+					and.l			d5,(a0)
+					or.l			d0,(a0)
+P32_MSK1_ODD:		move.l			(a1)+,d0
+					eor.l			d7,d0
+					ror.l			d3,d0
+					and.l			d4,d0
+					and.l			d5,SCRN_LEN_BYTES(a0)
+					or.l			d0,SCRN_LEN_BYTES(a0)
+					lea				2*SCRN_LEN_BYTES(a0),a0
+					dbra			d2,P32_MSK1_LOOP
+
+P32_RETURN:			movem.l			(sp)+,d0-7/a0-1
+					unlk			a6
+					rts
+
+
+;void plot_alpha(UINT32* const base, int x, int y, int height,
+;				const UINT32* const bitmap)
+;
+; Applies a 32-bit wide alpha bitmap of any height. See raster.h for how
+; clipping behaves.
+;
+; Register Table:
+; ---------------
+; See plot_rast32().
+
+_plot_alpha:		link			a6,#0
+					movem.l			d0-7/a0-1,-(sp)
+					moveq			#31,d4
+					moveq			#2,d5
+					bsr				plot_setup
+					tst.w			d2
+					beq				ALPHA_RETURN
+
+					; The bits outside of the bitmap have to be set so that the rest
+					; of each line is left untouched.
+					move.l			d4,d5
+					not.l			d5
+					tst.w			d1
+					bne				ALPHA_AND1
+
+ALPHA_AND2:			lsr.w			#1,d2
+					bcc				ALPHA_AND2_EVEN
+					lea				-SCRN_LEN_BYTES(a0),a0
+					bra				ALPHA_AND2_ODD
+ALPHA_AND2_EVEN:	subq.w			#1,d2
+ALPHA_AND2_LOOP:	move.l			(a1)+,d0
+					ror.l			d3,d0
+					move.l			d0,d1
+					or.l			d5,d0
+					or.l			d4,d1
+					and.l			d0,(a0)
+					and.l			d1,4(a0)
+ALPHA_AND2_ODD:		move.l			(a1)+,d0
+					ror.l			d3,d0
+					move.l			d0,d1
+					or.l			d5,d0
+					or.l			d4,d1
+					and.l			d0,SCRN_LEN_BYTES(a0)
+					and.l			d1,SCRN_LEN_BYTES+4(a0)
+					lea				2*SCRN_LEN_BYTES(a0),a0
+					dbra			d2,ALPHA_AND2_LOOP
+					bra				ALPHA_RETURN
+
+ALPHA_AND1:			lsr.w			#1,d2
+					bcc				ALPHA_AND1_EVEN
+					lea				-SCRN_LEN_BYTES(a0),a0
+					bra				ALPHA_AND1_ODD
+ALPHA_AND1_EVEN:	subq.w			#1,d2
+ALPHA_AND1_LOOP:	move.l			(a1)+,d0
+					ror.l			d3,d0
+					or.l			d5,d0
+					and.l			d0,(a0)
+ALPHA_AND1_ODD:		move.l			(a1)+,d0
+					ror.l			d3,d0
+					or.l			d5,d0
+					and.l			d0,SCRN_LEN_BYTES(a0)
+					lea				2*SCRN_LEN_BYTES(a0),a0
+					dbra			d2,ALPHA_AND1_LOOP
+
+ALPHA_RETURN:		movem.l			(sp)+,d0-7/a0-1
+					unlk			a6
+					rts
+
+
+;void plot_rast16(UINT16* const base, int x, int y, int height,
+;				 const UINT16* const bitmap, BOOL destructive,
+;				 BOOL blackScreen)
+;
+; Plots a 16-bit wide bitmap of any height. See raster.h for how clipping and
+; each combination of flags behave.
+;
+; Register Table:
+; ---------------
+; d0	-	Holds the current row of the bitmap.
+;		-	Holds the part of the current row that goes into the left word.
+; d1	-	Holds a value indicating if the bitmap only touches a single word of
+;			each line on screen.
+;		-	Holds the part of the current row that goes into the right word.
+; d2	-	Holds the number of rows (or pairs of rows) left to plot.
+; d3	-	Holds the number of pixels to rotate each row by.
+; d4	-	Holds the mask selecting the bits of a rotated row that belong to
+;			the left word (or the only visible word).
+; d5	-	Holds the complement of d4.
+; d7	-	Holds the RastMode to plot with.
+;		-	Holds the value to XOR each row with before it is destructively
+;			plotted (all ones on a black screen).
+; a0	-	Holds the position on screen to plot the current row.
+; a1	-	Holds the position of the current row of the bitmap.
+; a6	-	Holds the address of the start of the stack frame.
+
+_plot_rast16:		link			a6,#0
+					movem.l			d0-7/a0-1,-(sp)
+					bsr				plot_mode
+					bra				P16_PLOT
+
+;void plot_or16(UINT16* const base, int x, int y, int height,
+;				const UINT16* const bitmap)
+;void plot_xor16(UINT16* const base, int x, int y, int height,
+;				 const UINT16* const bitmap)
+;void plot_copy16(UINT16* const base, int x, int y, int height,
+;				  const UINT16* const bitmap)
+;void plot_inv16(UINT16* const base, int x, int y, int height,
+;				 const UINT16* const bitmap)
+;
+; Plot a 16-bit wide bitmap of any height using a fixed RastMode (see
+; raster.h). They share the body of plot_rast16(), with d7 set to the mode
+; instead of it being worked out from the flags.
+
+_plot_or16:			link			a6,#0
+					movem.l			d0-7/a0-1,-(sp)
+					moveq			#RAST_OR,d7
+					bra				P16_PLOT
+
+_plot_xor16:		link			a6,#0
+					movem.l			d0-7/a0-1,-(sp)
+					moveq			#RAST_XOR,d7
+					bra				P16_PLOT
+
+_plot_copy16:		link			a6,#0
+					movem.l			d0-7/a0-1,-(sp)
+					moveq			#RAST_COPY,d7
+					bra				P16_PLOT
+
+_plot_inv16:		link			a6,#0
+					movem.l			d0-7/a0-1,-(sp)
+					moveq			#RAST_COPY_INV,d7
+
+P16_PLOT:			moveq			#15,d4
+					moveq			#1,d5
+					bsr				plot_setup
+					tst.w			d2
+					beq				P16_RETURN
+
+					cmpi.w			#RAST_COPY,d7
+					bge				P16_MASKED
+					tst.w			d7
+					bne				P16_OVERLAY_XOR
+					tst.w			d1
+					bne				P16_OR1
+
+P16_OR2:			lsr.w			#1,d2
+					bcc				P16_OR2_EVEN
+					lea				-SCRN_LEN_BYTES(a0),a0
+					bra				P16_OR2_ODD
+P16_OR2_EVEN:		subq.w			#1,d2
+P16_OR2_LOOP:		move.w			(a1)+,d0
+					ror.w			d3,d0
+					move.w			d0,d1
+					and.w			d4,d0
+					eor.w			d0,d1
+					or.w			d0,(a0)
+					or.w			d1,2(a0)
+P16_OR2_ODD:		move.w			(a1)+,d0
+					ror.w			d3,d0
+					move.w			d0,d1
+					and.w			d4,d0
+					eor.w			d0,d1
+					or.w			d0,SCRN_LEN_BYTES(a0)
+					or.w			d1,SCRN_LEN_BYTES+2(a0)
+					lea				2*SCRN_LEN_BYTES(a0),a0
+					dbra			d2,P16_OR2_LOOP
+					bra				P16_RETURN
+
+P16_OR1:			lsr.w			#1,d2
+					bcc				P16_OR1_EVEN
+					lea				-SCRN_LEN_BYTES(a0),a0
+					bra				P16_OR1_ODD
+P16_OR1_EVEN:		subq.w			#1,d2
+P16_OR1_LOOP:		move.w			(a1)+,d0
+					ror.w			d3,d0
+					and.w			d4,d0
+					or.w			d0,(a0)
+P16_OR1_ODD:		move.w			(a1)+,d0
+					ror.w			d3,d0
+					and.w			d4,d0
+					or.w			d0,SCRN_LEN_BYTES(a0)
+					lea				2*SCRN_LEN_BYTES(a0),a0
+					dbra			d2,P16_OR1_LOOP
+					bra				P16_RETURN
+
+P16_OVERLAY_XOR:	tst.w			d1
+					bne				P16_XOR1
+
+P16_XOR2:			lsr.w			#1,d2
+					bcc				P16_XOR2_EVEN
+					lea				-SCRN_LEN_BYTES(a0),a0
+					bra				P16_XOR2_ODD
+P16_XOR2_EVEN:		subq.w			#1,d2
+P16_XOR2_LOOP:		move.w			(a1)+,d0
+					ror.w			d3,d0
+					move.w			d0,d1
+					and.w			d4,d0
+					eor.w			d0,d1
+					eor.w			d0,(a0)
+					eor.w			d1,2(a0)
+P16_XOR2_ODD:		move.w			(a1)+,d0
+					ror.w			d3,d0
+					move.w			d0,d1
+					and.w			d4,d0
+					eor.w			d0,d1
+					eor.w			d0,SCRN_LEN_BYTES(a0)
+					eor.w			d1,SCRN_LEN_BYTES+2(a0)
+					lea				2*SCRN_LEN_BYTES(a0),a0
+					dbra			d2,P16_XOR2_LOOP
+					bra				P16_RETURN
+
+P16_XOR1:			lsr.w			#1,d2
+					bcc				P16_XOR1_EVEN
+					lea				-SCRN_LEN_BYTES(a0),a0
+					bra				P16_XOR1_ODD
+P16_XOR1_EVEN:		subq.w			#1,d2
+P16_XOR1_LOOP:		move.w			(a1)+,d0
+					ror.w			d3,d0
+					and.w			d4,d0
+					eor.w			d0,(a0)
+P16_XOR1_ODD:		move.w			(a1)+,d0
+					ror.w			d3,d0
+					and.w			d4,d0
+					eor.w			d0,SCRN_LEN_BYTES(a0)
+					lea				2*SCRN_LEN_BYTES(a0),a0
+					dbra			d2,P16_XOR1_LOOP
+					bra				P16_RETURN
+
+					; Only the bits of each line covered by the bitmap are replaced.
+P16_MASKED:			move.l			d4,d5
+					not.l			d5
+					subq.l			#RAST_COPY,d7
+					neg.l			d7
+					tst.w			d1
+					bne				P16_MSK1
+
+P16_MSK2:			lsr.w			#1,d2
+					bcc				P16_MSK2_EVEN
+					lea				-SCRN_LEN_BYTES(a0),a0
+					bra				P16_MSK2_ODD
+P16_MSK2_EVEN:		subq.w			#1,d2
+P16_MSK2_LOOP:		move.w			(a1)+,d0
+					eor.w			d7,d0
+					ror.w			d3,d0
+					move.w			d0,d1
+					and.w			d4,d0
+					eor.w			d0,d1
+					and.w			d5,(a0)
+					or.w			d0,(a0)
+					and.w			d4,2(a0)
+					or.w			d1,2(a0)
+P16_MSK2_ODD:		move.w			(a1)+,d0
+					eor.w			d7,d0
+					ror.w			d3,d0
+					move.w			d0,d1
+					and.w			d4,d0
+					eor.w			d0,d1
+					and.w			d5,SCRN_LEN_BYTES(a0)
+					or.w			d0,SCRN_LEN_BYTES(a0)
+					and.w			d4,SCRN_LEN_BYTES+2(a0)
+					or.w			d1,SCRN_LEN_BYTES+2(a0)
+					lea				2*SCRN_LEN_BYTES(a0),a0
+					dbra			d2,P16_MSK2_LOOP
+					bra				P16_RETURN
+
+P16_MSK1:			lsr.w			#1,d2
+					bcc				P16_MSK1_EVEN
+					lea				-SCRN_LEN_BYTES(a0),a0
+					bra				P16_MSK1_ODD
+P16_MSK1_EVEN:		subq.w			#1,d2
+P16_MSK1_LOOP:		move.w			(a1)+,d0
+					eor.w			d7,d0
+					ror.w			d3,d0
+					and.w			d4,d0
+					and.w			d5,(a0)
+					or.w			d0,(a0)
+P16_MSK1_ODD:		move.w			(a1)+,d0
+					eor.w			d7,d0
+					ror.w			d3,d0
+					and.w			d4,d0
+					and.w			d5,SCRN_LEN_BYTES(a0)
+					or.w			d0,SCRN_LEN_BYTES(a0)
+					lea				2*SCRN_LEN_BYTES(a0),a0
+					dbra			d2,P16_MSK1_LOOP
+
+P16_RETURN:			movem.l			(sp)+,d0-7/a0-1
+					unlk			a6
+					rts
+
+
+;void plot_rast8(UINT8* const base, int x, int y, int height,
+;				const UINT8* const bitmap, BOOL destructive, BOOL blackScreen)
+;
+; Plots a 8-bit wide bitmap of any height. See raster.h for how clipping and
+; each combination of flags behave.
+;
+; Register Table:
+; ---------------
+; d0	-	Holds the current row of the bitmap.
+;		-	Holds the part of the current row that goes into the left byte.
+; d1	-	Holds a value indicating if the bitmap only touches a single byte of
+;			each line on screen.
+;		-	Holds the part of the current row that goes into the right byte.
+; d2	-	Holds the number of rows (or pairs of rows) left to plot.
+; d3	-	Holds the number of pixels to rotate each row by.
+; d4	-	Holds the mask selecting the bits of a rotated row that belong to
+;			the left byte (or the only visible byte).
+; d5	-	Holds the complement of d4.
+; d7	-	Holds the RastMode to plot with.
+;		-	Holds the value to XOR each row with before it is destructively
+;			plotted (all ones on a black screen).
+; a0	-	Holds the position on screen to plot the current row.
+; a1	-	Holds the position of the current row of the bitmap.
+; a6	-	Holds the address of the start of the stack frame.
+
+_plot_rast8:		link			a6,#0
+					movem.l			d0-7/a0-1,-(sp)
+					bsr				plot_mode
+					bra				P8_PLOT
+
+;void plot_or8(UINT8* const base, int x, int y, int height,
+;			   const UINT8* const bitmap)
+;void plot_xor8(UINT8* const base, int x, int y, int height,
+;				const UINT8* const bitmap)
+;void plot_copy8(UINT8* const base, int x, int y, int height,
+;				 const UINT8* const bitmap)
+;void plot_inv8(UINT8* const base, int x, int y, int height,
+;				const UINT8* const bitmap)
+;
+; Plot a 8-bit wide bitmap of any height using a fixed RastMode (see
+; raster.h). They share the body of plot_rast8(), with d7 set to the mode
+; instead of it being worked out from the flags.
+
+_plot_or8:			link			a6,#0
+					movem.l			d0-7/a0-1,-(sp)
+					moveq			#RAST_OR,d7
+					bra				P8_PLOT
+
+_plot_xor8:			link			a6,#0
+					movem.l			d0-7/a0-1,-(sp)
+					moveq			#RAST_XOR,d7
+					bra				P8_PLOT
+
+_plot_copy8:		link			a6,#0
+					movem.l			d0-7/a0-1,-(sp)
+					moveq			#RAST_COPY,d7
+					bra				P8_PLOT
+
+_plot_inv8:			link			a6,#0
+					movem.l			d0-7/a0-1,-(sp)
+					moveq			#RAST_COPY_INV,d7
+
+P8_PLOT:			moveq			#7,d4
+					moveq			#0,d5
+					bsr				plot_setup
+					tst.w			d2
+					beq				P8_RETURN
+
+					cmpi.w			#RAST_COPY,d7
+					bge				P8_MASKED
+					tst.w			d7
+					bne				P8_OVERLAY_XOR
+					tst.w			d1
+					bne				P8_OR1
+
+P8_OR2:				lsr.w			#1,d2
+					bcc				P8_OR2_EVEN
+					lea				-SCRN_LEN_BYTES(a0),a0
+					bra				P8_OR2_ODD
+P8_OR2_EVEN:		subq.w			#1,d2
+P8_OR2_LOOP:		move.b			(a1)+,d0
+					ror.b			d3,d0
+					move.b			d0,d1
+					and.b			d4,d0
+					eor.b			d0,d1
+					or.b			d0,(a0)
+					or.b			d1,1(a0)
+P8_OR2_ODD:			move.b			(a1)+,d0
+					ror.b			d3,d0
+					move.b			d0,d1
+					and.b			d4,d0
+					eor.b			d0,d1
+					or.b			d0,SCRN_LEN_BYTES(a0)
+					or.b			d1,SCRN_LEN_BYTES+1(a0)
+					lea				2*SCRN_LEN_BYTES(a0),a0
+					dbra			d2,P8_OR2_LOOP
+					bra				P8_RETURN
+
+P8_OR1:				lsr.w			#1,d2
+					bcc				P8_OR1_EVEN
+					lea				-SCRN_LEN_BYTES(a0),a0
+					bra				P8_OR1_ODD
+P8_OR1_EVEN:		subq.w			#1,d2
+P8_OR1_LOOP:		move.b			(a1)+,d0
+					ror.b			d3,d0
+					and.b			d4,d0
+					or.b			d0,(a0)
+P8_OR1_ODD:			move.b			(a1)+,d0
+					ror.b			d3,d0
+					and.b			d4,d0
+					or.b			d0,SCRN_LEN_BYTES(a0)
+					lea				2*SCRN_LEN_BYTES(a0),a0
+					dbra			d2,P8_OR1_LOOP
+					bra				P8_RETURN
+
+P8_OVERLAY_XOR:		tst.w			d1
+					bne				P8_XOR1
+
+P8_XOR2:			lsr.w			#1,d2
+					bcc				P8_XOR2_EVEN
+					lea				-SCRN_LEN_BYTES(a0),a0
+					bra				P8_XOR2_ODD
+P8_XOR2_EVEN:		subq.w			#1,d2
+P8_XOR2_LOOP:		move.b			(a1)+,d0
+					ror.b			d3,d0
+					move.b			d0,d1
+					and.b			d4,d0
+					eor.b			d0,d1
+					eor.b			d0,(a0)
+					eor.b			d1,1(a0)
+P8_XOR2_ODD:		move.b			(a1)+,d0
+					ror.b			d3,d0
+					move.b			d0,d1
+					and.b			d4,d0
+					eor.b			d0,d1
+					eor.b			d0,SCRN_LEN_BYTES(a0)
+					eor.b			d1,SCRN_LEN_BYTES+1(a0)
+					lea				2*SCRN_LEN_BYTES(a0),a0
+					dbra			d2,P8_XOR2_LOOP
+					bra				P8_RETURN
+
+P8_XOR1:			lsr.w			#1,d2
+					bcc				P8_XOR1_EVEN
+					lea				-SCRN_LEN_BYTES(a0),a0
+					bra				P8_XOR1_ODD
+P8_XOR1_EVEN:		subq.w			#1,d2
+P8_XOR1_LOOP:		move.b			(a1)+,d0
+					ror.b			d3,d0
+					and.b			d4,d0
+					eor.b			d0,(a0)
+P8_XOR1_ODD:		move.b			(a1)+,d0
+					ror.b			d3,d0
+					and.b			d4,d0
+					eor.b			d0,SCRN_LEN_BYTES(a0)
+					lea				2*SCRN_LEN_BYTES(a0),a0
+					dbra			d2,P8_XOR1_LOOP
+					bra				P8_RETURN
+
+					; Only the bits of each line covered by the bitmap are replaced.
+P8_MASKED:			move.l			d4,d5
+					not.l			d5
+					subq.l			#RAST_COPY,d7
+					neg.l			d7
+					tst.w			d1
+					bne				P8_MSK1
+
+P8_MSK2:			lsr.w			#1,d2
+					bcc				P8_MSK2_EVEN
+					lea				-SCRN_LEN_BYTES(a0),a0
+					bra				P8_MSK2_ODD
+P8_MSK2_EVEN:		subq.w			#1,d2
+P8_MSK2_LOOP:		move.b			(a1)+,d0
+					eor.b			d7,d0
+					ror.b			d3,d0
+					move.b			d0,d1
+					and.b			d4,d0
+					eor.b			d0,d1
+					and.b			d5,(a0)
+					or.b			d0,(a0)
+					and.b			d4,1(a0)
+					or.b			d1,1(a0)
+P8_MSK2_ODD:		move.b			(a1)+,d0
+					eor.b			d7,d0
+					ror.b			d3,d0
+					move.b			d0,d1
+					and.b			d4,d0
+					eor.b			d0,d1
+					and.b			d5,SCRN_LEN_BYTES(a0)
+					or.b			d0,SCRN_LEN_BYTES(a0)
+					and.b			d4,SCRN_LEN_BYTES+1(a0)
+					or.b			d1,SCRN_LEN_BYTES+1(a0)
+					lea				2*SCRN_LEN_BYTES(a0),a0
+					dbra			d2,P8_MSK2_LOOP
+					bra				P8_RETURN
+
+P8_MSK1:			lsr.w			#1,d2
+					bcc				P8_MSK1_EVEN
+					lea				-SCRN_LEN_BYTES(a0),a0
+					bra				P8_MSK1_ODD
+P8_MSK1_EVEN:		subq.w			#1,d2
+P8_MSK1_LOOP:		move.b			(a1)+,d0
+					eor.b			d7,d0
+					ror.b			d3,d0
+					and.b			d4,d0
+					and.b			d5,(a0)
+					or.b			d0,(a0)
+P8_MSK1_ODD:		move.b			(a1)+,d0
+					eor.b			d7,d0
+					ror.b			d3,d0
+					and.b			d4,d0
+					and.b			d5,SCRN_LEN_BYTES(a0)
+					or.b			d0,SCRN_LEN_BYTES(a0)
+					lea				2*SCRN_LEN_BYTES(a0),a0
+					dbra			d2,P8_MSK1_LOOP
+
+P8_RETURN:			movem.l			(sp)+,d0-7/a0-1
+					unlk			a6
+					rts
+
+
+; Works out the RastMode matching the destructive and blackScreen parameters of
+; plot_rast32(), plot_rast16() or plot_rast8() and returns it in d7.
+;
+; Expects a6 to hold the stack frame of the caller.
+
+plot_mode:			moveq			#RAST_OR,d7
+					tst.w			PLOT_BLACK(a6)
+					beq				PLOT_MODE_DESTR
+					moveq			#RAST_XOR,d7
+PLOT_MODE_DESTR:	tst.w			PLOT_DESTRUCT(a6)
+					beq				PLOT_MODE_RETURN
+					addq.w			#RAST_COPY,d7
+PLOT_MODE_RETURN:	rts
+
+
+; Validates the parameters shared by every plotting subroutine, clips the bitmap
+; vertically and works out where and how each row is to be plotted.
+;
+; Expects a6 to hold the stack frame of the caller, d4 to hold the width of the
+; bitmap minus one (31, 15 or 7) and d5 to hold the number of bits to shift by
+; to turn a number of rows into a number of bytes (2, 1 or 0).
+;
+; Returns the number of rows to plot in d2 (zero if nothing is to be plotted),
+; the number of pixels to rotate each row right by in d3 and the mask selecting
+; the bits of a rotated row to place in the first unit on screen in d4. If d1 is
+; non-zero, each row only touches a single unit on screen. Otherwise, the rest
+; of the rotated row goes into the unit that follows. a0 holds the position on
+; screen of the first unit and a1 holds the first visible row of the bitmap.
+;
+; Register Table:
+; ---------------
+; d0	-	Holds the x coordinate.
+;		-	Holds the offset of the first unit on screen within a line.
+; d1	-	Holds the y coordinate of the first visible row.
+;		-	Holds the offset of the first visible line from the base.
+;		-	Holds the right-most column of the bitmap.
+; d2	-	Holds the number of visible rows.
+; d3	-	Holds the number of lines between the first visible row and the
+;			bottom of the screen.
+;		-	Holds the number of pixels to rotate each row by.
+; d6	-	Holds a mask as wide as the bitmap.
+;		-	Holds the mask used to align the offset of the first unit.
+
+plot_setup:			move.w			PLOT_HEIGHT(a6),d2
+					ble				PLOT_SETUP_SKIP
+					move.w			PLOT_X(a6),d0
+					move.w			d4,d1
+					neg.w			d1
+					cmp.w			d1,d0
+					blt				PLOT_SETUP_SKIP
+					cmpi.w			#SCRN_LEN,d0
+					bge				PLOT_SETUP_SKIP
+					move.w			PLOT_Y(a6),d1
+					cmpi.w			#SCRN_MAX_Y,d1
+					bgt				PLOT_SETUP_SKIP
+					movea.l			PLOT_BITMAP(a6),a1
+					tst.w			d1
+					bpl				PLOT_SETUP_CLIP
+
+					; Skip the rows that are above the screen.
+					add.w			d1,d2
+					ble				PLOT_SETUP_SKIP
+					neg.w			d1
+					lsl.w			d5,d1
+					adda.w			d1,a1
+					clr.w			d1
+
+					; Drop the rows that are below the screen.
+PLOT_SETUP_CLIP:	move.w			#SCRN_HEIGHT,d3
+					sub.w			d1,d3
+					cmp.w			d3,d2
+					ble				PLOT_SETUP_ADDR
+					move.w			d3,d2
+
+PLOT_SETUP_ADDR:	movea.l			PLOT_BASE(a6),a0
+					mulu.w			#SCRN_LEN_BYTES,d1
+					adda.l			d1,a0
+
+					; The rotation is the same for negative x values, as the row is
+					; then rotated into the unit at the start of the line.
+					moveq			#2,d6
+					lsl.l			d4,d6
+					subq.l			#1,d6
+					move.w			d0,d3
+					and.w			d4,d3
+					move.w			d0,d1
+					add.w			d4,d1
+					move.l			d6,d4
+					lsr.l			d3,d4
+					tst.w			d0
+					bmi				PLOT_SETUP_LEFT
+
+					lsr.w			#3,d0
+					moveq			#-1,d6
+					lsl.w			d5,d6
+					and.w			d6,d0
+					adda.w			d0,a0
+					cmpi.w			#SCRN_LEN,d1
+					bge				PLOT_SETUP_ONE
+					tst.w			d3
+					beq				PLOT_SETUP_ONE
+					clr.w			d1
+					rts
+
+					; Only the part of the row rotated into the start of the line
+					; is visible.
+PLOT_SETUP_LEFT:	eor.l			d6,d4
+PLOT_SETUP_ONE:		moveq			#1,d1
+					rts
+
+PLOT_SETUP_SKIP:	clr.w			d2
+					rts
\ No newline at end of file
@@ -0,0 +1,447 @@
+/**
+ * @file preshift.c
+ * @author Academia Team
+ * @brief Contains a cache of pre-shifted sprites so that bitmaps which are not
+ * aligned to a long (or word) boundary can be plotted without shifting every
+ * row on the fly.
+ *
+ * @copyright Copyright Academia Team 2023
+ */
+
+#include <stddef.h>
+
+#include "endian.h"
+#include "preshift.h"
+#include "raster.h"
+#include "scrn.h"
+
+/**
+ * @brief Computes the pair of values that a row of a 32-bit wide bitmap turns
+ * into when it is shifted to the right by the given amount.
+ * @details For alpha bitmaps, the bits that are shifted in are set so that the
+ * pixels surrounding the sprite are left untouched when the pair is ANDed onto
+ * the screen.
+ *
+ * @param row The row of the bitmap to shift.
+ * @param shift The number of pixels to shift by (1 to 31).
+ * @param op The operation the pair will be used for.
+ * @param left The value to place into the left long. Returned by reference.
+ * @param right The value to place into the right long. Returned by reference.
+ */
+#define shiftRow32(row, shift, op, left, right) \
+	left  = (row) >> (shift); \
+	right = (row) << (32 - (shift)); \
+	\
+	if ((op) == SHIFT_AND) \
+	{ \
+		left  |= 0xFFFFFFFFu << (32 - (shift)); \
+		right |= 0xFFFFFFFFu >> (shift); \
+	}
+
+/**
+ * @brief Computes the pair of values that a row of a 16-bit wide bitmap turns
+ * into when it is shifted to the right by the given amount.
+ * @details See shiftRow32().
+ *
+ * @param row The row of the bitmap to shift.
+ * @param shift The number of pixels to shift by (1 to 15).
+ * @param op The operation the pair will be used for.
+ * @param left The value to place into the left word. Returned by reference.
+ * @param right The value to place into the right word. Returned by reference.
+ */
+#define shiftRow16(row, shift, op, left, right) \
+	left  = (UINT16)((row) >> (shift)); \
+	right = (UINT16)((row) << (16 - (shift))); \
+	\
+	if ((op) == SHIFT_AND) \
+	{ \
+		left  |= (UINT16)(0xFFFFu << (16 - (shift))); \
+		right |= (UINT16)(0xFFFFu >> (shift)); \
+	}
+
+/**
+ * @brief Combines every row of a bitmap with a single column of the screen.
+ *
+ * @param scrn The position on screen of the first row.
+ * @param src The first row of the bitmap.
+ * @param row The y position of the first row. Used as the loop counter.
+ * @param endRow The y position of the last row.
+ * @param lineLen The number of elements making up a line of the screen.
+ * @param assignOp The compound assignment operator used to combine the two.
+ * @param swap The macro used to put a row into the byte order of the screen.
+ */
+#define plotColumn(scrn, src, row, endRow, lineLen, assignOp, swap) \
+	for (; row <= endRow; row++, src++, scrn += lineLen) \
+	{ \
+		*scrn assignOp swap(*src); \
+	}
+
+/**
+ * @brief Combines every pair of a shift phase with the screen.
+ * @details See plotColumn().
+ *
+ * @param scrn The position on screen of the left element of the first pair.
+ * @param pairs The first pair of the shift phase.
+ */
+#define plotPairs(scrn, pairs, row, endRow, lineLen, assignOp) \
+	for (; row <= endRow; row++, pairs += 2, scrn += lineLen) \
+	{ \
+		*scrn       assignOp *pairs; \
+		*(scrn + 1) assignOp *(pairs + 1); \
+	}
+
+/**
+ * @brief Combines one half of every pair of a shift phase with the screen.
+ * @details Used when the other half of the sprite is off screen. See
+ * plotColumn().
+ *
+ * @param scrn The position on screen of the visible half of the first pair.
+ * @param pairs The visible half of the first pair of the shift phase.
+ */
+#define plotHalfPairs(scrn, pairs, row, endRow, lineLen, assignOp) \
+	for (; row <= endRow; row++, pairs += 2, scrn += lineLen) \
+	{ \
+		*scrn assignOp *pairs; \
+	}
+
+/**
+ * @brief Word version of plotColumn().
+ */
+#define plotColumn16(scrn, src, row, endRow, lineLen, assignOp) \
+	plotColumn(scrn, src, row, endRow, lineLen, assignOp, swap16OnLE)
+
+/**
+ * @brief Applies one of the above plotting macros using the compound
+ * assignment operator that matches the given ShiftOp.
+ */
+#define plotWithOp(op, plotMacro, scrn, src, row, endRow, lineLen) \
+	switch(op) \
+	{ \
+		case SHIFT_AND: \
+			plotMacro(scrn, src, row, endRow, lineLen, &=) \
+			break; \
+		case SHIFT_XOR: \
+			plotMacro(scrn, src, row, endRow, lineLen, ^=) \
+			break; \
+		default: \
+			plotMacro(scrn, src, row, endRow, lineLen, |=) \
+	}
+
+UINT32 shiftPool[SHIFT_POOL_LONGS];
+int    shiftPoolFillLevel = 0;
+
+UINT32* getShift32(ShiftSpr32* const sprite, int shift);
+UINT16* getShift16(ShiftSpr16* const sprite, int shift);
+UINT32* allocShiftPool(int numLongs);
+
+void init_shift32(ShiftSpr32* sprite, const UINT32* bitmap, int height,
+				  ShiftOp op)
+{
+	int shift;
+
+	sprite->bitmap = bitmap;
+	sprite->height = height;
+	sprite->op     = op;
+
+	for (shift = 0; shift < NUM_SHIFTS32; shift++)
+	{
+		sprite->phases[shift] = NULL;
+	}
+}
+
+void init_shift16(ShiftSpr16* sprite, const UINT16* bitmap, int height,
+				  ShiftOp op)
+{
+	int shift;
+
+	sprite->bitmap = bitmap;
+	sprite->height = height;
+	sprite->op     = op;
+
+	for (shift = 0; shift < NUM_SHIFTS16; shift++)
+	{
+		sprite->phases[shift] = NULL;
+	}
+}
+
+void plot_shift32(UINT32* const base, int x, int y, ShiftSpr32* const sprite)
+{
+	const UINT32* bmpSrcPos;
+	const UINT32* pairSrcPos;
+
+	int bitmapEndY = y + sprite->height - 1;
+	int currentRow;
+	int shift;
+	UINT32* scrnPlotPos;
+
+	if (bitmapEndY > SCRN_MAX_Y)
+	{
+		bitmapEndY = SCRN_MAX_Y;
+	}
+
+	if (x >= RAST32_MIN_X && x < SCRN_LEN
+	&& bitmapEndY >= 0 && y <= SCRN_MAX_Y
+	&& sprite->height > 0)
+	{
+		shift = x & 31;
+		bmpSrcPos = sprite->bitmap;
+
+		if (y < 0)
+		{
+			bmpSrcPos -= y;
+			y = 0;
+		}
+
+		currentRow = y;
+
+		/* The pair of longs straddled by the sprite starts one long to the
+		left of the screen when x is negative. */
+		scrnPlotPos = base + y * SCRN_LEN_LONG +
+					  (x < 0 ? -1 : (x >> DIV_SHIFT_BY_32));
+
+		if (onRast32Grid(x))
+		{
+			/* Sprites on a word boundary need no shifting at all. */
+			if (sprite->op == SHIFT_AND)
+			{
+				plot_grid_alpha(base, x, y, bitmapEndY - y + 1, bmpSrcPos);
+			}
+			else
+			{
+				plot_grid32(base, x, y, bitmapEndY - y + 1, bmpSrcPos, FALSE,
+							sprite->op == SHIFT_XOR);
+			}
+		}
+		else if ((pairSrcPos = getShift32(sprite, shift)) != NULL)
+		{
+			pairSrcPos += (bmpSrcPos - sprite->bitmap) << 1;
+
+			if (x >= 0 && x <= RAST32_MAX_VIS_X)
+			{
+				plotWithOp(sprite->op, plotPairs, scrnPlotPos, pairSrcPos,
+						   currentRow, bitmapEndY, SCRN_LEN_LONG)
+			}
+			else
+			{
+				if (x < 0)
+				{
+					scrnPlotPos++;
+					pairSrcPos++;
+				}
+
+				plotWithOp(sprite->op, plotHalfPairs, scrnPlotPos,
+						   pairSrcPos, currentRow, bitmapEndY, SCRN_LEN_LONG)
+			}
+		}
+		else if (sprite->op == SHIFT_AND)
+		{
+			plot_alpha(base, x, y, bitmapEndY - y + 1, bmpSrcPos);
+		}
+		else
+		{
+			plot_rast32(base, x, y, bitmapEndY - y + 1, bmpSrcPos, FALSE,
+						sprite->op == SHIFT_XOR);
+		}
+	}
+}
+
+void plot_shift16(UINT16* const base, int x, int y, ShiftSpr16* const sprite)
+{
+	const UINT16* bmpSrcPos;
+	const UINT16* pairSrcPos;
+
+	int bitmapEndY = y + sprite->height - 1;
+	int currentRow;
+	int shift;
+	UINT16* scrnPlotPos;
+
+	UINT16 leftVal;
+	UINT16 rightVal;
+
+	if (bitmapEndY > SCRN_MAX_Y)
+	{
+		bitmapEndY = SCRN_MAX_Y;
+	}
+
+	if (x >= RAST16_MIN_X && x < SCRN_LEN
+	&& bitmapEndY >= 0 && y <= SCRN_MAX_Y
+	&& sprite->height > 0)
+	{
+		shift = x & 15;
+		bmpSrcPos = sprite->bitmap;
+
+		if (y < 0)
+		{
+			bmpSrcPos -= y;
+			y = 0;
+		}
+
+		currentRow = y;
+		scrnPlotPos = base + y * SCRN_LEN_WORDS +
+					  (x < 0 ? -1 : (x >> DIV_SHIFT_BY_16));
+
+		if (shift == 0)
+		{
+			plotWithOp(sprite->op, plotColumn16, scrnPlotPos, bmpSrcPos,
+					   currentRow, bitmapEndY, SCRN_LEN_WORDS)
+		}
+		else if ((pairSrcPos = getShift16(sprite, shift)) != NULL)
+		{
+			pairSrcPos += (bmpSrcPos - sprite->bitmap) << 1;
+
+			if (x >= 0 && x <= RAST16_MAX_VIS_X)
+			{
+				plotWithOp(sprite->op, plotPairs, scrnPlotPos, pairSrcPos,
+						   currentRow, bitmapEndY, SCRN_LEN_WORDS)
+			}
+			else
+			{
+				if (x < 0)
+				{
+					scrnPlotPos++;
+					pairSrcPos++;
+				}
+
+				plotWithOp(sprite->op, plotHalfPairs, scrnPlotPos,
+						   pairSrcPos, currentRow, bitmapEndY, SCRN_LEN_WORDS)
+			}
+		}
+		else
+		{
+			/* The cache is full, so the shifting has to be done on the fly. */
+			for (; currentRow <= bitmapEndY;
+				 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_WORDS)
+			{
+				shiftRow16(*bmpSrcPos, shift, sprite->op, leftVal, rightVal);
+
+				leftVal  = swap16OnLE(leftVal);
+				rightVal = swap16OnLE(rightVal);
+
+				switch(sprite->op)
+				{
+					case SHIFT_AND:
+						if (x >= 0)
+						{
+							*scrnPlotPos &= leftVal;
+						}
+						if (x <= RAST16_MAX_VIS_X)
+						{
+							*(scrnPlotPos + 1) &= rightVal;
+						}
+						break;
+					case SHIFT_XOR:
+						if (x >= 0)
+						{
+							*scrnPlotPos ^= leftVal;
+						}
+						if (x <= RAST16_MAX_VIS_X)
+						{
+							*(scrnPlotPos + 1) ^= rightVal;
+						}
+						break;
+					default:
+						if (x >= 0)
+						{
+							*scrnPlotPos |= leftVal;
+						}
+						if (x <= RAST16_MAX_VIS_X)
+						{
+							*(scrnPlotPos + 1) |= rightVal;
+						}
+				}
+			}
+		}
+	}
+}
+
+/**
+ * @brief Returns the given shift phase of a 32-bit wide sprite, building it if
+ * it has not been needed before.
+ *
+ * @param sprite The sprite to get the shift phase of.
+ * @param shift The number of pixels the sprite is shifted to the right by
+ * (1 to 31).
+ * @return The pairs of longs making up the phase or NULL if there is no more
+ * room in the cache to build it.
+ */
+UINT32* getShift32(ShiftSpr32* const sprite, int shift)
+{
+	UINT32* phase = sprite->phases[shift];
+	UINT32  leftVal;
+	UINT32  rightVal;
+	int     row;
+
+	if (phase == NULL &&
+		(phase = allocShiftPool(sprite->height << 1)) != NULL)
+	{
+		for (row = 0; row < sprite->height; row++)
+		{
+			shiftRow32(sprite->bitmap[row], shift, sprite->op, leftVal,
+					   rightVal);
+
+			phase[row << 1]       = swap32OnLE(leftVal);
+			phase[(row << 1) + 1] = swap32OnLE(rightVal);
+		}
+
+		sprite->phases[shift] = phase;
+	}
+
+	return phase;
+}
+
+/**
+ * @brief Returns the given shift phase of a 16-bit wide sprite, building it if
+ * it has not been needed before.
+ *
+ * @param sprite The sprite to get the shift phase of.
+ * @param shift The number of pixels the sprite is shifted to the right by
+ * (1 to 15).
+ * @return The pairs of words making up the phase or NULL if there is no more
+ * room in the cache to build it.
+ */
+UINT16* getShift16(ShiftSpr16* const sprite, int shift)
+{
+	UINT16* phase = sprite->phases[shift];
+	UINT16  leftVal;
+	UINT16  rightVal;
+	int     row;
+
+	if (phase == NULL &&
+		(phase = (UINT16 *)allocShiftPool(sprite->height)) != NULL)
+	{
+		for (row = 0; row < sprite->height; row++)
+		{
+			shiftRow16(sprite->bitmap[row], shift, sprite->op, leftVal,
+					   rightVal);
+
+			phase[row << 1]       = swap16OnLE(leftVal);
+			phase[(row << 1) + 1] = swap16OnLE(rightVal);
+		}
+
+		sprite->phases[shift] = phase;
+	}
+
+	return phase;
+}
+
+/**
+ * @brief Reserves the given number of longs from the cache.
+ * @details Space is never given back to the cache, as every sprite is expected
+ * to remain registered for the life of the program.
+ *
+ * @param numLongs The number of longs to reserve.
+ * @return The start of the reserved space or NULL if there isn't enough room
+ * left.
+ */
+UINT32* allocShiftPool(int numLongs)
+{
+	UINT32* space = NULL;
+
+	if (numLongs > 0 && numLongs <= SHIFT_POOL_LONGS - shiftPoolFillLevel)
+	{
+		space = &shiftPool[shiftPoolFillLevel];
+		shiftPoolFillLevel += numLongs;
+	}
+
+	return space;
+}
\ No newline at end of file
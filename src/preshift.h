@@ -0,0 +1,139 @@
+/**
+ * @file preshift.h
+ * @author Academia Team
+ * @brief Contains a cache of pre-shifted sprites so that bitmaps which are not
+ * aligned to a long (or word) boundary can be plotted without shifting every
+ * row on the fly.
+ *
+ * @copyright Copyright Academia Team 2023
+ */
+
+#ifndef PRESHIFT_H
+#define PRESHIFT_H
+
+#include "bool.h"
+#include "types.h"
+
+/**
+ * @brief The number of horizontal shift phases a 32-bit wide sprite can have.
+ */
+#define NUM_SHIFTS32 32
+
+/**
+ * @brief The number of horizontal shift phases a 16-bit wide sprite can have.
+ */
+#define NUM_SHIFTS16 16
+
+/**
+ * @brief The number of longs reserved for holding all the shift phases built by
+ * the cache.
+ * @details Every phase of a 32-bit wide sprite takes up two longs per row of
+ * the sprite, while every phase of a 16-bit wide sprite takes up one long per
+ * row of the sprite. Mr. Feathers always lands on the grid, so only the 16 row
+ * tall mouse cursor ever builds phases; the pool holds every one of them.
+ */
+#define SHIFT_POOL_LONGS (NUM_SHIFTS16 * 16)
+
+/**
+ * @brief The operation used to combine a pre-shifted sprite with the screen.
+ */
+typedef enum
+{
+	SHIFT_OR  = 0,
+	SHIFT_AND = 1,
+	SHIFT_XOR = 2
+} ShiftOp;
+
+/**
+ * @brief Holds every shift phase of a 32-bit wide bitmap.
+ * @details Each phase is stored as a pair of longs per row (the left and right
+ * long that the shifted row straddles) in the byte order of the screen. A
+ * phase is built the first time it is needed.
+ */
+typedef struct
+{
+	const UINT32* bitmap;
+	int           height;
+	ShiftOp       op;
+	UINT32*       phases[NUM_SHIFTS32];
+} ShiftSpr32;
+
+/**
+ * @brief Holds every shift phase of a 16-bit wide bitmap.
+ * @details Each phase is stored as a pair of words per row (the left and right
+ * word that the shifted row straddles) in the byte order of the screen. A
+ * phase is built the first time it is needed.
+ */
+typedef struct
+{
+	const UINT16* bitmap;
+	int           height;
+	ShiftOp       op;
+	UINT16*       phases[NUM_SHIFTS16];
+} ShiftSpr16;
+
+/**
+ * @brief Registers a 32-bit wide bitmap with the cache.
+ * @details No phases are built until the sprite is first plotted at a given
+ * shift.
+ *
+ * @param sprite The ShiftSpr32 object to initialize.
+ * @param bitmap The bitmap that the sprite should be built from. It must
+ * remain valid for as long as the sprite is in use.
+ * @param height The height of the bitmap. Must be one or greater.
+ * @param op SHIFT_OR if the sprite is to be overlayed onto the screen,
+ * SHIFT_XOR if it is to be shown in white on a black background or
+ * SHIFT_AND if it is an alpha bitmap (see plot_alpha()).
+ */
+void init_shift32(ShiftSpr32* sprite, const UINT32* bitmap, int height,
+				  ShiftOp op);
+
+/**
+ * @brief Registers a 16-bit wide bitmap with the cache.
+ * @details No phases are built until the sprite is first plotted at a given
+ * shift.
+ *
+ * @param sprite The ShiftSpr16 object to initialize.
+ * @param bitmap The bitmap that the sprite should be built from. It must
+ * remain valid for as long as the sprite is in use.
+ * @param height The height of the bitmap. Must be one or greater.
+ * @param op SHIFT_OR if the sprite is to be overlayed onto the screen,
+ * SHIFT_XOR if it is to be shown in white on a black background or
+ * SHIFT_AND if it is an alpha bitmap.
+ */
+void init_shift16(ShiftSpr16* sprite, const UINT16* bitmap, int height,
+				  ShiftOp op);
+
+/**
+ * @brief Plots a registered 32-bit wide sprite.
+ * @details Clipping follows the same rules as plot_rast32(). Sprites that
+ * satisfy onRast32Grid() are handed off to plot_grid32() (or plot_grid_alpha())
+ * as they need no shifting. If no room is left in the cache to build the
+ * desired phase, the sprite is handed off to plot_rast32() (or plot_alpha())
+ * instead.
+ *
+ * @param base The location in memory to plot at.
+ * @param x The left-most column to begin to plot the sprite (in pixels starting
+ * at zero).
+ * @param y The top-most row to begin to plot the sprite (in pixels starting at
+ * zero).
+ * @param sprite The sprite to plot.
+ */
+void plot_shift32(UINT32* const base, int x, int y, ShiftSpr32* const sprite);
+
+/**
+ * @brief Plots a registered 16-bit wide sprite.
+ * @details Clipping follows the same rules as plot_rast16(). If no room is left
+ * in the cache to build the desired phase, the sprite is shifted on the fly
+ * instead.
+ *
+ * @param base The location in memory to plot at.
+ * @param x The left-most column to begin to plot the sprite (in pixels starting
+ * at zero).
+ * @param y The top-most row to begin to plot the sprite (in pixels starting at
+ * zero).
+ * @param sprite The sprite to plot.
+ */
+void plot_shift16(UINT16* const base, int x, int y, ShiftSpr16* const sprite);
+
+#endif
\ No newline at end of file
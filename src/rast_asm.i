@@ -3,6 +3,13 @@
 ; Copyright Academia Team 2023
 
 
+; The ways in which a bitmap can be combined with the screen. Must match
+; RastMode in raster.h.
+RAST_OR:			equ		0
+RAST_XOR:			equ		1
+RAST_COPY:			equ		2
+RAST_COPY_INV:		equ		3
+
 ; The maximum value for the x coordinate (in pixels) for a 32-bit wide raster
 ; image such that the entire image is still visible on the Atari ST's monochrome
 ; screen.
@@ -3,10 +3,17 @@
 ; 
 ; Copyright Academia Team 2023
 
+					include			rast_asm.i
+					include			scrn_asm.i
+
 					xdef			_clr_scrn
 					xdef			_fill_scrn
 					xdef			_get_video_base
+					xdef			_plot_grid32
+					xdef			_plot_grid_alpha
+					xdef			_scroll_down
 					xdef			_set_video_base
+					xdef			_span_fill
 
 					xref			_isSu
 					xref			_Su
@@ -60,6 +67,395 @@ fill_scrn_loop:		movem.l			d1-7/a1-6,-(a0)
 fill_scrn_ones:		dcb.l			13,-1
 
 
+;void span_fill(UINT32* const base, int x1, int x2, int y, int height,
+;				BOOL set)
+;
+; Sets or clears every pixel from column x1 to column x2 (inclusive) in each of
+; height rows starting at row y. The partial longs at either end of a row are
+; masked, while the longs in between are written with movem bursts of 13
+; registers (as in clr_scrn()). When the span takes up the entire length of the
+; screen, its rows are contiguous in memory and are filled as a single block.
+;
+; Nothing is clipped, so the span must lie entirely on screen with x1 <= x2 and
+; a height of at least one.
+;
+; Register Table:
+; ---------------
+; d0	-	Holds the number of longs in the block (full length spans only).
+;		-	Holds the number of rows left to fill (minus one).
+; d1	-	Holds the pattern that the span is filled with.
+;		-	With d2-7/a1-6, holds the pattern during a movem burst.
+; d2	-	Holds the x1 coordinate.
+;		-	Holds the mask of the left-most long of a row.
+; d3	-	Holds the x2 coordinate.
+;		-	Holds the mask of the right-most long of a row.
+; d4	-	Holds the number of longs left over after the bursts in a block.
+;		-	Holds the byte offset of the right-most long of a row from the
+;			left-most long.
+; d5	-	Holds the number of middle longs of a row not written by a burst.
+; d6	-	Holds the number of middle longs left to write in the current row.
+; d7	-	Holds the number of bytes taken up by the burst in a row (zero if
+;			there is no burst).
+; a0	-	Holds the position on screen of the left-most long of the current
+;			row.
+; a1	-	Holds the position on screen of the next middle long to write.
+; a2	-	Holds the position of the table that the burst registers are
+;			loaded from.
+
+SF_BASE:			equ				64					; offset from SP, not A6
+SF_X1:				equ				68
+SF_X2:				equ				70
+SF_Y:				equ				72
+SF_HEIGHT:			equ				74
+SF_SET:				equ				76
+
+SF_BURST_LONGS:		equ				13
+
+_span_fill:			movem.l			d0-7/a0-6,-(sp)
+
+					moveq			#0,d1
+					lea				clr_scrn_zeros,a2
+					tst.w			SF_SET(sp)
+					beq				SF_ADDR
+					moveq			#-1,d1
+					lea				fill_scrn_ones,a2
+
+SF_ADDR:			movea.l			SF_BASE(sp),a0
+					move.w			SF_Y(sp),d0
+					mulu.w			#SCRN_LEN_BYTES,d0
+					adda.l			d0,a0
+					move.w			SF_HEIGHT(sp),d0
+					move.w			SF_X2(sp),d3
+					move.w			SF_X1(sp),d2
+					bne				SF_PART
+					cmpi.w			#SCRN_MAX_X,d3
+					bne				SF_PART
+
+					; The rows of a full length span form one block, which is
+					; filled backwards from its end.
+					mulu.w			#SCRN_LEN_BYTES,d0
+					adda.l			d0,a0
+					lsr.l			#2,d0
+					divu.w			#SF_BURST_LONGS,d0
+					move.l			d0,d4
+					swap			d4
+					bra				SF_BLK_REM_NEXT
+SF_BLK_REM_LOOP:	move.l			d1,-(a0)
+SF_BLK_REM_NEXT:	dbra			d4,SF_BLK_REM_LOOP
+
+					movem.l			(a2),d1-7/a1-6
+					bra				SF_BLK_NEXT
+SF_BLK_LOOP:		movem.l			d1-7/a1-6,-(a0)
+SF_BLK_NEXT:		dbra			d0,SF_BLK_LOOP
+					bra				SF_RETURN
+
+					; Work out the masks of the longs at either end of a row.
+SF_PART:			subq.w			#1,d0
+					move.w			d2,d4
+					lsr.w			#3,d4
+					andi.w			#$FFFC,d4
+					adda.w			d4,a0
+					move.w			d3,d5
+					lsr.w			#3,d5
+					andi.w			#$FFFC,d5
+					sub.w			d4,d5
+					move.w			d5,d4
+
+					andi.w			#31,d2
+					moveq			#-1,d6
+					lsr.l			d2,d6
+					move.l			d6,d2
+					not.w			d3
+					andi.w			#31,d3
+					moveq			#-1,d6
+					lsl.l			d3,d6
+					move.l			d6,d3
+
+					tst.w			d4
+					bne				SF_SPLIT
+					and.l			d3,d2
+					tst.w			d1
+					beq				SF_CLR_ONE
+
+SF_SET_ONE_LOOP:	or.l			d2,(a0)
+					lea				SCRN_LEN_BYTES(a0),a0
+					dbra			d0,SF_SET_ONE_LOOP
+					bra				SF_RETURN
+
+SF_CLR_ONE:			not.l			d2
+SF_CLR_ONE_LOOP:	and.l			d2,(a0)
+					lea				SCRN_LEN_BYTES(a0),a0
+					dbra			d0,SF_CLR_ONE_LOOP
+					bra				SF_RETURN
+
+					; The first 13 middle longs of every row are left for the
+					; burst, which is done once the edges have been filled.
+SF_SPLIT:			lsr.w			#2,d5
+					subq.w			#1,d5
+					moveq			#0,d7
+					cmpi.w			#SF_BURST_LONGS,d5
+					blt				SF_EDGES
+					moveq			#SF_BURST_LONGS*4,d7
+					subi.w			#SF_BURST_LONGS,d5
+
+SF_EDGES:			tst.w			d1
+					beq				SF_CLR_EDGES
+
+SF_SET_LOOP:		or.l			d2,(a0)
+					or.l			d3,0(a0,d4.w)
+					lea				4(a0,d7.w),a1
+					move.w			d5,d6
+					bra				SF_SET_MID_NEXT
+SF_SET_MID_LOOP:	move.l			d1,(a1)+
+SF_SET_MID_NEXT:	dbra			d6,SF_SET_MID_LOOP
+					lea				SCRN_LEN_BYTES(a0),a0
+					dbra			d0,SF_SET_LOOP
+					bra				SF_BURST
+
+SF_CLR_EDGES:		not.l			d2
+					not.l			d3
+SF_CLR_LOOP:		and.l			d2,(a0)
+					and.l			d3,0(a0,d4.w)
+					lea				4(a0,d7.w),a1
+					move.w			d5,d6
+					bra				SF_CLR_MID_NEXT
+SF_CLR_MID_LOOP:	move.l			d1,(a1)+
+SF_CLR_MID_NEXT:	dbra			d6,SF_CLR_MID_LOOP
+					lea				SCRN_LEN_BYTES(a0),a0
+					dbra			d0,SF_CLR_LOOP
+
+SF_BURST:			tst.w			d7
+					beq				SF_RETURN
+					move.w			SF_HEIGHT(sp),d0
+					move.w			d0,d6
+					mulu.w			#SCRN_LEN_BYTES,d6
+					suba.l			d6,a0
+					addq.l			#4,a0
+					subq.w			#1,d0
+					movem.l			(a2),d1-7/a1-6
+SF_BURST_LOOP:		movem.l			d1-7/a1-6,(a0)
+					lea				SCRN_LEN_BYTES(a0),a0
+					dbra			d0,SF_BURST_LOOP
+
+SF_RETURN:			movem.l			(sp)+,d0-7/a0-6
+					rts
+
+
+;void scroll_down(UINT32* const base, int top, int bottom, int distance)
+;
+; Moves the rows from top to bottom (inclusive) down by distance rows. The rows
+; moved past the bottom are lost, while the top distance rows are left as they
+; were, ready to be redrawn. Since whole rows are contiguous in memory, the
+; block is moved as a single run of bytes, from its end towards its start so
+; that it is not overwritten before it is read. Every row is moved with two
+; movem bursts of 10 registers.
+;
+; Nothing is clipped, so top and bottom must lie on screen with top <= bottom
+; and distance must be one or greater. Nothing is moved if distance exceeds
+; the number of rows.
+;
+; Register Table:
+; ---------------
+; d0	-	Holds the number of rows left to move (minus one).
+; d1	-	Holds a byte offset used to find the end of the block.
+;		-	With d2-7/a2-4, holds the longs moved by a burst.
+; a0	-	Holds the position just past the next part of the block to read.
+; a1	-	Holds the position just past the next part of the block to write.
+
+SD_BASE:			equ				64					; offset from SP, not A6
+SD_TOP:				equ				68
+SD_BOTTOM:			equ				70
+SD_DISTANCE:		equ				72
+
+SD_BURST_BYTES:		equ				40
+
+_scroll_down:		movem.l			d0-7/a0-6,-(sp)
+					move.w			SD_BOTTOM(sp),d0
+					sub.w			SD_TOP(sp),d0
+					sub.w			SD_DISTANCE(sp),d0
+					blt				SD_RETURN
+
+					movea.l			SD_BASE(sp),a1
+					move.w			SD_BOTTOM(sp),d1
+					addq.w			#1,d1
+					mulu.w			#SCRN_LEN_BYTES,d1
+					adda.l			d1,a1
+					move.w			SD_DISTANCE(sp),d1
+					mulu.w			#SCRN_LEN_BYTES,d1
+					movea.l			a1,a0
+					suba.l			d1,a0
+
+SD_ROW_LOOP:		lea				-SD_BURST_BYTES(a0),a0
+					movem.l			(a0),d1-7/a2-4
+					movem.l			d1-7/a2-4,-(a1)
+					lea				-SD_BURST_BYTES(a0),a0
+					movem.l			(a0),d1-7/a2-4
+					movem.l			d1-7/a2-4,-(a1)
+					dbra			d0,SD_ROW_LOOP
+
+SD_RETURN:			movem.l			(sp)+,d0-7/a0-6
+					rts
+
+
+;void plot_grid32(UINT32* const base, int x, int y, int height,
+;				 const UINT32* const bitmap, BOOL destructive,
+;				 BOOL blackScreen)
+;
+; Plots a 32-bit wide bitmap whose x coordinate is a multiple of 16 that is
+; entirely visible on screen. Since the 68000 allows long accesses on any word
+; boundary, every row is written with a single long operation and no shifting.
+; Nothing is plotted if the x coordinate is not on the grid.
+;
+; Register Table:
+; ---------------
+; d0	-	Holds the x coordinate.
+;		-	Holds the byte offset of the x coordinate within a line.
+;		-	Holds the current row of the bitmap.
+; d1	-	Holds the y coordinate of the first visible row.
+;		-	Holds the byte offset of the first visible row.
+; d2	-	Holds the number of visible rows.
+;		-	Holds the number of rows left to plot (minus one).
+; d3	-	Holds the number of rows between the first visible row and the
+;			bottom of the screen.
+; a0	-	Holds the position on screen to plot the current row.
+; a1	-	Holds the position of the current row of the bitmap.
+; a6	-	Holds the address of the start of the stack frame.
+
+P_GRID_BASE:		equ				8
+P_GRID_X:			equ				12
+P_GRID_Y:			equ				14
+P_GRID_HEIGHT:		equ				16
+P_GRID_BITMAP:		equ				18
+P_GRID_DESTRUCT:	equ				22
+P_GRID_BLACK:		equ				24
+
+_plot_grid32:		link			a6,#0
+					movem.l			d0-3/a0-1,-(sp)
+
+					movea.l			P_GRID_BITMAP(a6),a1
+					bsr				grid_setup
+					tst.w			d2
+					bmi				P_GRID_RETURN
+
+					tst.w			P_GRID_DESTRUCT(a6)
+					beq				P_GRID_OVERLAY
+					tst.w			P_GRID_BLACK(a6)
+					beq				P_GRID_COPY_LOOP
+
+P_GRID_INV_LOOP:	move.l			(a1)+,d0
+					not.l			d0
+					move.l			d0,(a0)
+					lea				SCRN_LEN_BYTES(a0),a0
+					dbra			d2,P_GRID_INV_LOOP
+					bra				P_GRID_RETURN
+
+P_GRID_COPY_LOOP:	move.l			(a1)+,(a0)
+					lea				SCRN_LEN_BYTES(a0),a0
+					dbra			d2,P_GRID_COPY_LOOP
+					bra				P_GRID_RETURN
+
+P_GRID_OVERLAY:		tst.w			P_GRID_BLACK(a6)
+					beq				P_GRID_OR_LOOP
+
+P_GRID_XOR_LOOP:	move.l			(a1)+,d0
+					eor.l			d0,(a0)
+					lea				SCRN_LEN_BYTES(a0),a0
+					dbra			d2,P_GRID_XOR_LOOP
+					bra				P_GRID_RETURN
+
+P_GRID_OR_LOOP:		move.l			(a1)+,d0
+					or.l			d0,(a0)
+					lea				SCRN_LEN_BYTES(a0),a0
+					dbra			d2,P_GRID_OR_LOOP
+
+P_GRID_RETURN:		movem.l			(sp)+,d0-3/a0-1
+					unlk			a6
+					rts
+
+
+;void plot_grid_alpha(UINT32* const base, int x, int y, int height,
+;					  const UINT32* const bitmap)
+;
+; Applies a 32-bit wide alpha bitmap whose x coordinate is a multiple of 16 that
+; is entirely visible on screen. Nothing is plotted if the x coordinate is not
+; on the grid.
+;
+; Register Table:
+; ---------------
+; See plot_grid32().
+
+_plot_grid_alpha:	link			a6,#0
+					movem.l			d0-3/a0-1,-(sp)
+
+					movea.l			P_GRID_BITMAP(a6),a1
+					bsr				grid_setup
+					tst.w			d2
+					bmi				P_GRID_A_RETURN
+
+P_GRID_AND_LOOP:	move.l			(a1)+,d0
+					and.l			d0,(a0)
+					lea				SCRN_LEN_BYTES(a0),a0
+					dbra			d2,P_GRID_AND_LOOP
+
+P_GRID_A_RETURN:	movem.l			(sp)+,d0-3/a0-1
+					unlk			a6
+					rts
+
+
+; Validates the parameters shared by plot_grid32() and plot_grid_alpha() and
+; clips the bitmap vertically.
+;
+; Expects a6 to hold the stack frame of the caller and a1 to hold the start of
+; the bitmap. On return, d2 is negative if nothing is to be plotted.
+; Otherwise, a0 holds the position on screen of the first visible row, a1 holds
+; the first visible row of the bitmap and d2 holds the number of visible rows
+; minus one (ready for dbra).
+;
+; Uses d0-3/a0-1 (see plot_grid32()).
+
+grid_setup:			move.w			P_GRID_X(a6),d0
+					bmi				grid_setup_skip
+					cmpi.w			#RAST32_MAX_VIS_X,d0
+					bgt				grid_setup_skip
+					move.w			d0,d1
+					andi.w			#15,d1
+					bne				grid_setup_skip
+
+					move.w			P_GRID_HEIGHT(a6),d2
+					ble				grid_setup_skip
+					move.w			P_GRID_Y(a6),d1
+					cmpi.w			#SCRN_MAX_Y,d1
+					bgt				grid_setup_skip
+					tst.w			d1
+					bpl				grid_setup_clip
+
+					; Skip the rows that are above the screen.
+					add.w			d1,d2
+					ble				grid_setup_skip
+					neg.w			d1
+					lsl.w			#2,d1
+					adda.w			d1,a1
+					clr.w			d1
+
+					; Drop the rows that are below the screen.
+grid_setup_clip:	move.w			#SCRN_HEIGHT,d3
+					sub.w			d1,d3
+					cmp.w			d3,d2
+					ble				grid_setup_addr
+					move.w			d3,d2
+
+grid_setup_addr:	movea.l			P_GRID_BASE(a6),a0
+					mulu.w			#SCRN_LEN_BYTES,d1
+					adda.l			d1,a0
+					lsr.w			#3,d0
+					adda.w			d0,a0
+					subq.w			#1,d2
+					rts
+
+grid_setup_skip:	moveq			#-1,d2
+					rts
+
+
 ; The start of the register holding the high and middle order bytes of the
 ; video base address.
 ; (Used by both get_video_base() and set_video_base().)
@@ -14,6 +14,173 @@
 #include "endian.h"
 #include "raster.h"
 
+#ifndef M68K_CPU
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#endif
+
+/**
+ * @brief A blitter used by draw_list() to plot the rows of a bitmap that needs
+ * no clipping.
+ * @details The rows are plotted starting at scrn, which must point to the
+ * first word on screen that the first row touches. The shift is the number of
+ * pixels that the bitmap is away from a word boundary.
+ */
+typedef void (*DrawBlit)(UINT16* scrn, const void* bitmap, int rows,
+						 int shift);
+
+/*
+ * The operations used by the draw list blitters to combine part of a row with
+ * a word on screen. The value holds the part of the row already shifted into
+ * place and the mask selects the bits of the word that the row covers.
+ */
+
+#define orWord(scrnPos, value, mask) (*(scrnPos) |= swap16OnLE(value))
+
+#define xorWord(scrnPos, value, mask) (*(scrnPos) ^= swap16OnLE(value))
+
+#define copyWord(scrnPos, value, mask) \
+	(*(scrnPos) = swap16OnLE((UINT16)((swap16OnLE(*(scrnPos)) & ~(mask)) | \
+									  (value))))
+
+#define invWord(scrnPos, value, mask) \
+	(*(scrnPos) = swap16OnLE((UINT16)((swap16OnLE(*(scrnPos)) & ~(mask)) | \
+									  ((value) ^ (mask)))))
+
+/**
+ * @brief Defines a draw list blitter for 32-bit wide bitmaps that combines rows
+ * with the screen using the given operation.
+ */
+#define defDrawBlit32(name, putWord) \
+void name(UINT16* scrn, const void* bitmap, int rows, int shift) \
+{ \
+	const UINT32* src = bitmap; \
+\
+	if (shift == 0) \
+	{ \
+		for (; rows > 0; rows--, src++, scrn += SCRN_LEN_WORDS) \
+		{ \
+			putWord(scrn, (UINT16)(*src >> 16), 0xFFFFu); \
+			putWord(scrn + 1, (UINT16)*src, 0xFFFFu); \
+		} \
+	} \
+	else \
+	{ \
+		for (; rows > 0; rows--, src++, scrn += SCRN_LEN_WORDS) \
+		{ \
+			putWord(scrn, (UINT16)(*src >> (16 + shift)), \
+					(UINT16)(0xFFFFu >> shift)); \
+			putWord(scrn + 1, (UINT16)(*src >> shift), 0xFFFFu); \
+			putWord(scrn + 2, (UINT16)(*src << (16 - shift)), \
+					(UINT16)(0xFFFFu << (16 - shift))); \
+		} \
+	} \
+}
+
+/**
+ * @brief Defines a draw list blitter for 16-bit wide bitmaps that combines rows
+ * with the screen using the given operation.
+ */
+#define defDrawBlit16(name, putWord) \
+void name(UINT16* scrn, const void* bitmap, int rows, int shift) \
+{ \
+	const UINT16* src = bitmap; \
+\
+	if (shift == 0) \
+	{ \
+		for (; rows > 0; rows--, src++, scrn += SCRN_LEN_WORDS) \
+		{ \
+			putWord(scrn, *src, 0xFFFFu); \
+		} \
+	} \
+	else \
+	{ \
+		for (; rows > 0; rows--, src++, scrn += SCRN_LEN_WORDS) \
+		{ \
+			putWord(scrn, (UINT16)(*src >> shift), \
+					(UINT16)(0xFFFFu >> shift)); \
+			putWord(scrn + 1, (UINT16)(*src << (16 - shift)), \
+					(UINT16)(0xFFFFu << (16 - shift))); \
+		} \
+	} \
+}
+
+void drawMasked32(UINT16* scrn, const void* bitmap, int rows, int shift);
+void drawClipped(UINT32* const base, const DrawCmd* const cmd);
+
+#ifndef M68K_CPU
+void fillLongs(UINT32* dest, UINT32 pattern, int count);
+#endif
+
+/**
+ * @brief The plotting function for 32-bit wide bitmaps indexed by RastMode.
+ */
+const Rast32Fn rast32Fns[NUM_RAST_MODES] =
+{
+	plot_or32, plot_xor32, plot_copy32, plot_inv32
+};
+
+/**
+ * @brief The plotting function for 16-bit wide bitmaps indexed by RastMode.
+ */
+const Rast16Fn rast16Fns[NUM_RAST_MODES] =
+{
+	plot_or16, plot_xor16, plot_copy16, plot_inv16
+};
+
+/**
+ * @brief The plotting function for 8-bit wide bitmaps indexed by RastMode.
+ */
+const Rast8Fn rast8Fns[NUM_RAST_MODES] =
+{
+	plot_or8, plot_xor8, plot_copy8, plot_inv8
+};
+
+defDrawBlit32(drawOr32, orWord)
+defDrawBlit32(drawXor32, xorWord)
+defDrawBlit32(drawCopy32, copyWord)
+defDrawBlit32(drawInv32, invWord)
+
+defDrawBlit16(drawOr16, orWord)
+defDrawBlit16(drawXor16, xorWord)
+defDrawBlit16(drawCopy16, copyWord)
+defDrawBlit16(drawInv16, invWord)
+
+/**
+ * @brief The draw list blitter for every DrawMode, indexed by its value.
+ */
+const DrawBlit drawBlits[NUM_DRAW_MODES] =
+{
+	drawOr32, drawXor32, drawCopy32, drawInv32,
+	drawOr16, drawXor16, drawCopy16, drawInv16,
+	drawMasked32
+};
+
+/**
+ * @brief The offset in bytes of the start of every row on screen, shared by
+ * every DrawList.
+ */
+UINT16 rowOffsets[SCRN_HEIGHT];
+BOOL   rowOffsetsBuilt = FALSE;
+
+Rast32Fn bind_rast32(RastMode mode)
+{
+	return rast32Fns[mode];
+}
+
+Rast16Fn bind_rast16(RastMode mode)
+{
+	return rast16Fns[mode];
+}
+
+Rast8Fn bind_rast8(RastMode mode)
+{
+	return rast8Fns[mode];
+}
+
 void plot_px(UINT8* const base, int x, int y)
 {
 	if (x >= 0 && x < SCRN_LEN && y >= 0 && y < SCRN_HEIGHT)
@@ -25,18 +192,9 @@ void plot_px(UINT8* const base, int x, int y)
 
 void hline(UINT32* const base, int x1, int x2, int y)
 {
-	int minXLong;
-	int maxXLong;
-	int minPX;
-	int maxPX;
-	int index;
-
-	UINT32* line;
-
 	if ((y >= 0 && y < SCRN_HEIGHT) && (x1 >= 0 || x2 >= 0) 
 	     && (x1 < SCRN_LEN || x2 < SCRN_LEN))
 	{
-		line = base + (y * SCRN_LEN_LONG);
 		fitXToScrn(x1);
 		fitXToScrn(x2);
 
@@ -45,392 +203,385 @@ void hline(UINT32* const base, int x1, int x2, int y)
 			swap(x1, x2);
 		}
 
-		minPX = x1;
-		maxPX = x2;
-		minXLong = (x1 >> DIV_SHIFT_BY_32);
-		maxXLong = (x2 >> DIV_SHIFT_BY_32);
-		line += minXLong;
+		span_fill(base, x1, x2, y, 1, TRUE);
+	}
+}
 
-		if (minXLong == maxXLong)
-		{	
-			*line |= swap32OnLE(((0xFFFFFFFFu >> (minPX & 31)) & 
-					 (0xFFFFFFFFu << (31 - (maxPX & 31)))));
-		}
-		else
-		{
-			*line |= swap32OnLE(0xFFFFFFFFu >> (minPX & 31));
+void rect_area(UINT32* const base, int x, int length, int y, int height)
+{
+	const int FINAL_X = x + length - 1;
+	const int FINAL_Y = y + height - 1;
 
-			for(index = 1; index < maxXLong - minXLong; index++)
-			{
-				*(line + index) = swap32OnLE(0xFFFFFFFFu);
-			}
+	int xMaxVal;
+	int yMaxVal;
 
-			*(line + index) |= swap32OnLE(0xFFFFFFFFu << (31 - (maxPX & 31)));
-		}
+	if (x >= 0 && x < SCRN_LEN && length > 0 &&
+		y >= 0 && y < SCRN_HEIGHT && height > 0)
+	{
+		xMaxVal = (FINAL_X < SCRN_LEN ? FINAL_X : SCRN_MAX_X);
+		yMaxVal = (FINAL_Y < SCRN_HEIGHT ? FINAL_Y : SCRN_MAX_Y);
+
+		span_fill(base, x, xMaxVal, y, yMaxVal - y + 1, TRUE);
 	}
 }
 
-void plot_rast32(UINT32* const base, int x, int y, int height,
-				 const UINT32* const bitmap, BOOL destructive,
-				 BOOL blackScreen)
+void clr_area(UINT32* const base, int x, int length, int y, int height)
 {
-	const UINT32* bmpSrcPos;
+	const int FINAL_X = x + length - 1;
+	const int FINAL_Y = y + height - 1;
+
+	int xMaxVal;
+	int yMaxVal;
+
+	if (x >= 0 && x < SCRN_LEN && length > 0 &&
+		y >= 0 && y < SCRN_HEIGHT && height > 0)
+	{
+		xMaxVal = (FINAL_X < SCRN_LEN ? FINAL_X : SCRN_MAX_X);
+		yMaxVal = (FINAL_Y < SCRN_HEIGHT ? FINAL_Y : SCRN_MAX_Y);
+
+		span_fill(base, x, xMaxVal, y, yMaxVal - y + 1, FALSE);
+	}
+}
+
+void plot_masked32(UINT32* const base, int x, int y, int height,
+				   const UINT32* const masked)
+{
+	const int SHIFT = x & 15;
+	const int FIRST_WORD = (x - SHIFT) / 16;
+
+	const UINT32* srcPos;
 
 	int bitmapEndY = y + height - 1;
 	int currentRow;
-	int modX;
-	int numPxFromRight;
-	UINT32* scrnPlotPos;
-	
-	UINT32 clrMaskVal;
-	UINT32 leftClrMaskVal;
-	UINT32 rightClrMaskVal;
-	UINT32 scrnPlotVal;
-	UINT32 xorMaskVal;
+	int firstVisWord;
+	int lastVisWord;
+	int word;
+
+	UINT16 maskWords[3];
+	UINT16 imageWords[3];
+	UINT16* scrnPlotPos;
 
 	if (bitmapEndY > SCRN_MAX_Y)
 	{
 		bitmapEndY = SCRN_MAX_Y;
 	}
 
-	if (x >= RAST32_MIN_X && x < (SCRN_LEN)
-	&& bitmapEndY >= 0 && y <= SCRN_MAX_Y 
-	&& height > 0)
+	if (x >= RAST32_MIN_X && x < SCRN_LEN && bitmapEndY >= 0 &&
+		y <= SCRN_MAX_Y && height > 0)
 	{
-		modX = (abs(x) & 31);
-		scrnPlotPos = (x < 0) ? base : (base + (x >> DIV_SHIFT_BY_32));
-		bmpSrcPos = bitmap;
+		firstVisWord = (FIRST_WORD < 0 ? -FIRST_WORD : 0);
+		lastVisWord = (SHIFT != 0 ? 2 : 1);
 
-		if (y > 0)
+		if (FIRST_WORD + lastVisWord >= SCRN_LEN_WORDS)
 		{
-			scrnPlotPos += y * SCRN_LEN_LONG;
+			lastVisWord = SCRN_LEN_WORDS - 1 - FIRST_WORD;
 		}
-		else if (y < 0)
+
+		srcPos = masked;
+
+		if (y < 0)
 		{
-			bmpSrcPos += y * -1;
+			srcPos += y * -MASKED_ROW_LONGS;
 			y = 0;
 		}
 
-		if (x < 0)
-		{
-			if (blackScreen && destructive)
-			{
-				clrMaskVal = 0xFFFFFFFFu >> (32 + x);
-				xorMaskVal = 0xFFFFFFFFu << modX;
-
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_LONG)
-				{
-					scrnPlotVal = swap32OnLE(*scrnPlotPos);
+		scrnPlotPos = (UINT16 *)base + y * SCRN_LEN_WORDS;
 
-					*scrnPlotPos = swap32OnLE((scrnPlotVal & clrMaskVal) |
-								   ((*bmpSrcPos << modX) ^ xorMaskVal));
-				}
-			}
-			else if (destructive)
-			{
-				clrMaskVal = 0xFFFFFFFFu >> modX;
+		for (currentRow = y; currentRow <= bitmapEndY;
+			 currentRow++, srcPos += MASKED_ROW_LONGS,
+			 scrnPlotPos += SCRN_LEN_WORDS)
+		{
+			maskWords[0] = (UINT16)(srcPos[0] >> (16 + SHIFT));
+			maskWords[1] = (UINT16)(srcPos[0] >> SHIFT);
+			maskWords[2] = (UINT16)(srcPos[0] << (16 - SHIFT));
 
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_LONG)
-				{
-					scrnPlotVal = swap32OnLE(*scrnPlotPos);
+			imageWords[0] = (UINT16)(srcPos[1] >> (16 + SHIFT));
+			imageWords[1] = (UINT16)(srcPos[1] >> SHIFT);
+			imageWords[2] = (UINT16)(srcPos[1] << (16 - SHIFT));
 
-					*scrnPlotPos = swap32OnLE((scrnPlotVal & clrMaskVal) |
-								   (*bmpSrcPos << modX));
-				}
-			}
-			else if (blackScreen)
-			{
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_LONG)
-				{
-					*scrnPlotPos ^= swap32OnLE(*bmpSrcPos << modX);
-				}
-			}
-			else
+			for (word = firstVisWord; word <= lastVisWord; word++)
 			{
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_LONG)
-				{
-					*scrnPlotPos |= swap32OnLE(*bmpSrcPos << modX);
-				}
+				scrnPlotPos[FIRST_WORD + word] =
+					(scrnPlotPos[FIRST_WORD + word] &
+					 (UINT16)~swap16OnLE(maskWords[word])) |
+					(UINT16)swap16OnLE(imageWords[word]);
 			}
 		}
-		else if (x > RAST32_MAX_VIS_X)
+	}
+}
+
+void init_draw_list(DrawList* const list, UINT32* const base)
+{
+	int row;
+
+	if (!rowOffsetsBuilt)
+	{
+		for (row = 0; row < SCRN_HEIGHT; row++)
 		{
-			if (blackScreen && destructive)
-			{
-				clrMaskVal = 0xFFFFFFFFu << (32 - modX);
-				xorMaskVal = 0xFFFFFFFFu >> modX;
+			rowOffsets[row] = row * SCRN_LEN_BYTES;
+		}
 
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_LONG)
-				{
-					scrnPlotVal = swap32OnLE(*scrnPlotPos);
+		rowOffsetsBuilt = TRUE;
+	}
 
-					*scrnPlotPos = swap32OnLE((scrnPlotVal & clrMaskVal) |
-								   ((*bmpSrcPos >> modX) ^ xorMaskVal));
-				}
-			}
-			else if (destructive)
-			{
-				clrMaskVal = 0xFFFFFFFFu << (32 - modX);
+	list->base = base;
+	list->numCmds = 0;
+}
 
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_LONG)
-				{
-					scrnPlotVal = swap32OnLE(*scrnPlotPos);
+void add_draw(DrawList* const list, const void* const bitmap, int x, int y,
+			  int height, DrawMode mode)
+{
+	add_fixed_draw(list, NULL, bitmap, x, y, height, mode);
+}
 
-					*scrnPlotPos = swap32OnLE((scrnPlotVal & clrMaskVal) |
-								   (*bmpSrcPos >> modX));
-				}
-			}
-			else if (blackScreen)
-			{
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_LONG)
-				{
-					*scrnPlotPos ^= swap32OnLE(*bmpSrcPos >> modX);
-				}
-			}
-			else
-			{
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_LONG)
-				{
-					*scrnPlotPos |= swap32OnLE(*bmpSrcPos >> modX);
-				}
-			}
-		}
-		else if (modX == 0)
+void add_fixed_draw(DrawList* const list, DrawFixedFn fixed,
+					const void* const bitmap, int x, int y, int height,
+					DrawMode mode)
+{
+	const int WIDTH = (mode >= DRAW_OR16 && mode <= DRAW_INV16 ? 16 : 32);
+
+	DrawCmd* cmd;
+
+	if (x > -WIDTH && x < SCRN_LEN && y > -height && y < SCRN_HEIGHT &&
+		height > 0)
+	{
+		if (list->numCmds == MAX_DRAW_CMDS)
 		{
-			if (blackScreen && destructive)
-			{
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_LONG)
-				{
-					*scrnPlotPos = swap32OnLE(*bmpSrcPos ^ 0xFFFFFFFFu);
-				}
-			}
-			else if (destructive)
-			{
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_LONG)
-				{
-					*scrnPlotPos = swap32OnLE(*bmpSrcPos);
-				}
-			}
-			else if (blackScreen)
-			{
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_LONG)
-				{
-					*scrnPlotPos ^= swap32OnLE(*bmpSrcPos);
-				}
-			}
-			else
-			{
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_LONG)
-				{
-					*scrnPlotPos |= swap32OnLE(*bmpSrcPos);
-				}
-			}
+			draw_list(list);
 		}
-		else
-		{
-			numPxFromRight = 32 - modX;
 
-			if (blackScreen && destructive)
-			{
-				leftClrMaskVal  = 0xFFFFFFFFu << numPxFromRight;
-				rightClrMaskVal = 0xFFFFFFFFu >> modX;
+		cmd = &list->cmds[list->numCmds];
+		cmd->bitmap = bitmap;
+		cmd->fixed = fixed;
+		cmd->x = x;
+		cmd->y = y;
+		cmd->height = height;
+		cmd->mode = mode;
+		cmd->clipped = (x < 0 || x > SCRN_LEN - WIDTH ||
+						y < 0 || y > SCRN_HEIGHT - height);
+		cmd->offset = rowOffsets[y < 0 ? 0 : y] +
+					  ((x < 0 ? 0 : x) >> DIV_SHIFT_BY_16) * UINT16_BYTES;
+
+		list->order[list->numCmds] = list->numCmds;
+		list->numCmds++;
+	}
+}
 
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_LONG)
-				{
-					scrnPlotVal = swap32OnLE(*scrnPlotPos);
+void draw_list(DrawList* const list)
+{
+	const DrawCmd* cmd;
 
-					*scrnPlotPos = swap32OnLE((scrnPlotVal & leftClrMaskVal) |
-								   ((*bmpSrcPos >> modX) ^ rightClrMaskVal));
-					
-					scrnPlotVal = swap32OnLE(*(scrnPlotPos + 1));
+	int index;
+	int sorted;
+	int next;
 
-					*(scrnPlotPos + 1) = swap32OnLE((scrnPlotVal &
-										 rightClrMaskVal) | ((*bmpSrcPos <<
-										 numPxFromRight) ^ leftClrMaskVal));
-				}
-			}
-			else if (destructive)
-			{
-				leftClrMaskVal  = 0xFFFFFFFFu << numPxFromRight;
-				rightClrMaskVal = 0xFFFFFFFFu >> modX;
+	/* An insertion sort keeps bitmaps that start at the same address in the
+	   order they were queued. */
+	for (sorted = 1; sorted < list->numCmds; sorted++)
+	{
+		next = list->order[sorted];
 
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_LONG)
-				{
-					scrnPlotVal = swap32OnLE(*scrnPlotPos);
+		for (index = sorted;
+			 index > 0 &&
+			 list->cmds[list->order[index - 1]].offset >
+			 list->cmds[next].offset;
+			 index--)
+		{
+			list->order[index] = list->order[index - 1];
+		}
 
-					*scrnPlotPos = swap32OnLE((scrnPlotVal & leftClrMaskVal) |
-								   (*bmpSrcPos >> modX));
-					
-					scrnPlotVal = swap32OnLE(*(scrnPlotPos + 1));
+		list->order[index] = next;
+	}
 
-					*(scrnPlotPos + 1) = swap32OnLE((scrnPlotVal &
-										 rightClrMaskVal) | (*bmpSrcPos <<
-										 numPxFromRight));
-				}
-			}
-			else if (blackScreen)
-			{
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_LONG)
-				{
-					*scrnPlotPos ^= swap32OnLE(*bmpSrcPos >> modX);
-					*(scrnPlotPos + 1) ^= swap32OnLE(*bmpSrcPos <<
-													 numPxFromRight);
-				}
-			}
-			else
-			{
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_LONG)
-				{
-					*scrnPlotPos |= swap32OnLE(*bmpSrcPos >> modX);
-					*(scrnPlotPos + 1) |= swap32OnLE(*bmpSrcPos <<
-													 numPxFromRight);
-				}
-			}
+	for (index = 0; index < list->numCmds; index++)
+	{
+		cmd = &list->cmds[list->order[index]];
+
+		if (cmd->clipped)
+		{
+			drawClipped(list->base, cmd);
+		}
+		else if (cmd->fixed != NULL && (cmd->x & 15) == 0)
+		{
+			cmd->fixed((UINT16 *)((UINT8 *)list->base + cmd->offset));
+		}
+		else
+		{
+			drawBlits[cmd->mode]((UINT16 *)((UINT8 *)list->base +
+											cmd->offset),
+								 cmd->bitmap, cmd->height, cmd->x & 15);
 		}
 	}
+
+	list->numCmds = 0;
 }
 
-void plot_alpha(UINT32* const base, int x, int y, int height,
-				const UINT32* const bitmap)
+void init_save_list(SaveList* const list, UINT32* const base)
 {
-	const UINT32* bmpSrcPos;
-
-	int bitmapEndY = y + height - 1;
-	int currentRow;
-	int modX;
-	int numPxFromRight;
-	UINT32* scrnPlotPos;
+	list->base = base;
+	list->numAreas = 0;
+	list->poolUsed = 0;
+	list->complete = TRUE;
+}
 
-	UINT32 clrMaskVal;
-	UINT32 leftClrMaskVal;
-	UINT32 rightClrMaskVal;
-	UINT32 scrnPlotVal;
+BOOL save_area(SaveList* const list, int x, int length, int y, int height)
+{
+	const int X1 = (x < 0 ? 0 : x);
+	const int X2 = (x + length - 1 > SCRN_MAX_X ? SCRN_MAX_X : x + length - 1);
+	const int Y1 = (y < 0 ? 0 : y);
+	const int Y2 = (y + height - 1 > SCRN_MAX_Y ? SCRN_MAX_Y : y + height - 1);
+
+	SavedArea* area;
+	UINT32*    pool;
+	UINT32*    scrn;
+
+	int longs;
+	int rows;
+	int row;
+	int index;
 
-	if (bitmapEndY > SCRN_MAX_Y)
+	if (X1 > X2 || Y1 > Y2)
 	{
-		bitmapEndY = SCRN_MAX_Y;
+		return TRUE;
 	}
 
-	if (x >= RAST32_MIN_X && x < (SCRN_LEN)
-	&& bitmapEndY >= 0 && y <= SCRN_MAX_Y 
-	&& height > 0)
+	longs = (X2 >> DIV_SHIFT_BY_32) - (X1 >> DIV_SHIFT_BY_32) + 1;
+	rows  = Y2 - Y1 + 1;
+
+	if (list->numAreas == MAX_SAVED_AREAS ||
+		longs * rows > SAVE_POOL_LONGS - list->poolUsed)
 	{
-		modX = (abs(x) & 31);
-		scrnPlotPos = (x < 0) ? base : (base + (x >> DIV_SHIFT_BY_32));
-		bmpSrcPos = bitmap;
+		list->complete = FALSE;
+		return FALSE;
+	}
 
-		if (y > 0)
-		{
-			scrnPlotPos += y * SCRN_LEN_LONG;
-		}
-		else if (y < 0)
+	area = &list->areas[list->numAreas++];
+	area->offset = Y1 * SCRN_LEN_LONG + (X1 >> DIV_SHIFT_BY_32);
+	area->longs = longs;
+	area->rows = rows;
+	area->poolPos = list->poolUsed;
+	list->poolUsed += longs * rows;
+
+	pool = &list->pool[area->poolPos];
+	scrn = list->base + area->offset;
+
+	for (row = 0; row < rows; row++, scrn += SCRN_LEN_LONG)
+	{
+		for (index = 0; index < longs; index++)
 		{
-			bmpSrcPos += y * -1;
-			y = 0;
+			*(pool++) = scrn[index];
 		}
+	}
 
-		if (x < 0)
-		{
-			clrMaskVal = 0xFFFFFFFFu >> modX;
+	return TRUE;
+}
 
-			for (currentRow = y; currentRow <= bitmapEndY;
-				 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_LONG)
-			{
-				scrnPlotVal = swap32OnLE(*scrnPlotPos);
+BOOL restore_saves(SaveList* const list)
+{
+	const BOOL COMPLETE = list->complete;
 
-				*scrnPlotPos &= swap32OnLE((scrnPlotVal & clrMaskVal) |
-								(*bmpSrcPos << modX));
-			}
-		}
-		else if (x > RAST32_MAX_VIS_X)
-		{
-			clrMaskVal = 0xFFFFFFFFu << (32 - modX);
+	const SavedArea* area;
+	const UINT32*    pool;
+	UINT32*          scrn;
 
-			for (currentRow = y; currentRow <= bitmapEndY;
-				 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_LONG)
-			{
-				scrnPlotVal = swap32OnLE(*scrnPlotPos);
+	int row;
+	int index;
 
-				*scrnPlotPos &= swap32OnLE((scrnPlotVal & clrMaskVal) |
-								(*bmpSrcPos >> modX));
-			}
-		}
-		else if (modX == 0)
+	while (list->numAreas > 0)
+	{
+		area = &list->areas[--list->numAreas];
+		pool = &list->pool[area->poolPos];
+		scrn = list->base + area->offset;
+
+		for (row = 0; row < area->rows; row++, scrn += SCRN_LEN_LONG)
 		{
-			for (currentRow = y; currentRow <= bitmapEndY;
-				 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_LONG)
+			for (index = 0; index < area->longs; index++)
 			{
-				*scrnPlotPos &= swap32OnLE(*(bmpSrcPos));
+				scrn[index] = *(pool++);
 			}
 		}
-		else
-		{
-			numPxFromRight  = 32 - modX;
-			leftClrMaskVal  = 0xFFFFFFFFu << numPxFromRight;
-			rightClrMaskVal = 0xFFFFFFFFu >> modX;
+	}
 
-			for (currentRow = y; currentRow <= bitmapEndY;
-				 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_LONG)
-			{
-				scrnPlotVal = swap32OnLE(*scrnPlotPos);
+	list->poolUsed = 0;
+	list->complete = TRUE;
 
-				*scrnPlotPos &= swap32OnLE((scrnPlotVal & leftClrMaskVal) |
-								(*bmpSrcPos >> modX));
-				
-				scrnPlotVal = swap32OnLE(*(scrnPlotPos + 1));
+	return COMPLETE;
+}
 
-				*(scrnPlotPos + 1) &= swap32OnLE((scrnPlotVal & rightClrMaskVal) |
-									  (*bmpSrcPos << numPxFromRight));
-			}
+/**
+ * @brief Plots the rows of a masked bitmap that needs no clipping for
+ * draw_list().
+ * 
+ * @param scrn The first word on screen that the first row touches.
+ * @param bitmap The masked bitmap to plot (see plot_masked32()).
+ * @param rows The number of rows to plot.
+ * @param shift The number of pixels that the bitmap is away from a word
+ * boundary.
+ */
+void drawMasked32(UINT16* scrn, const void* bitmap, int rows, int shift)
+{
+	const UINT32* src = bitmap;
+
+	for (; rows > 0; rows--, src += MASKED_ROW_LONGS, scrn += SCRN_LEN_WORDS)
+	{
+		copyWord(scrn, (UINT16)(src[1] >> (16 + shift)),
+				 (UINT16)(src[0] >> (16 + shift)));
+		copyWord(scrn + 1, (UINT16)(src[1] >> shift),
+				 (UINT16)(src[0] >> shift));
+
+		if (shift != 0)
+		{
+			copyWord(scrn + 2, (UINT16)(src[1] << (16 - shift)),
+					 (UINT16)(src[0] << (16 - shift)));
 		}
 	}
 }
 
-void plot_rast16(UINT16* const base, int x, int y, int height,
-				 const UINT16* const bitmap, BOOL destructive,
+/**
+ * @brief Plots a queued bitmap that needs to be clipped for draw_list().
+ * 
+ * @param base The location in memory to plot at.
+ * @param cmd The queued bitmap to plot.
+ */
+void drawClipped(UINT32* const base, const DrawCmd* const cmd)
+{
+	if (cmd->mode == DRAW_MASKED32)
+	{
+		plot_masked32(base, cmd->x, cmd->y, cmd->height, cmd->bitmap);
+	}
+	else if (cmd->mode >= DRAW_OR16)
+	{
+		bind_rast16((RastMode)(cmd->mode - DRAW_OR16))((UINT16 *)base,
+													  cmd->x, cmd->y,
+													  cmd->height,
+													  cmd->bitmap);
+	}
+	else
+	{
+		bind_rast32((RastMode)cmd->mode)(base, cmd->x, cmd->y, cmd->height,
+										 cmd->bitmap);
+	}
+}
+
+#ifndef M68K_CPU
+void plot_grid32(UINT32* const base, int x, int y, int height,
+				 const UINT32* const bitmap, BOOL destructive,
 				 BOOL blackScreen)
 {
-	const UINT16* bmpSrcPos;
-	
+	const UINT32* bmpSrcPos;
+
 	int bitmapEndY = y + height - 1;
 	int currentRow;
-	int modX;
-	int numPxFromRight;
 	UINT16* scrnPlotPos;
 
-	UINT16 clrMaskVal;
-	UINT16 leftClrMaskVal;
-	UINT16 rightClrMaskVal;
-	UINT16 scrnPlotVal;
-	UINT16 xorMaskVal;
-
 	if (bitmapEndY > SCRN_MAX_Y)
 	{
 		bitmapEndY = SCRN_MAX_Y;
 	}
 
-	if (x >= RAST16_MIN_X && x < (SCRN_LEN)
-	&& bitmapEndY >= 0 && y <= SCRN_MAX_Y 
-	&& height > 0)
+	if (onRast32Grid(x) && bitmapEndY >= 0 && y <= SCRN_MAX_Y && height > 0)
 	{
-		modX = (abs(x) & 15);
-		scrnPlotPos = (x < 0) ? base : (base + (x >> DIV_SHIFT_BY_16));
+		scrnPlotPos = (UINT16 *)base + (x >> DIV_SHIFT_BY_16);
 		bmpSrcPos = bitmap;
 
 		if (y > 0)
@@ -443,555 +594,201 @@ void plot_rast16(UINT16* const base, int x, int y, int height,
 			y = 0;
 		}
 
-		if (x < 0)
+		/* Each row is split into its two words, since a long can't be
+		accessed on a word boundary on every CPU. */
+		if (blackScreen && destructive)
 		{
-			if (blackScreen && destructive)
-			{
-				clrMaskVal = 0xFFFFu >> (16 + x);
-				xorMaskVal = 0xFFFFu << modX;
-
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_WORDS)
-				{
-					scrnPlotVal = swap16OnLE(*scrnPlotPos);
-
-					*scrnPlotPos = swap16OnLE((scrnPlotVal & clrMaskVal) | (
-								   (*bmpSrcPos << modX) ^ xorMaskVal));
-				}
-			}
-			else if (destructive)
-			{
-				clrMaskVal = 0xFFFFu >> modX;
-
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_WORDS)
-				{
-					scrnPlotVal = swap16OnLE(*scrnPlotPos);
-
-					*scrnPlotPos = swap16OnLE((scrnPlotVal & clrMaskVal) |
-								   (*bmpSrcPos << modX));
-				}
-			}
-			else if (blackScreen)
-			{
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_WORDS)
-				{
-					*scrnPlotPos ^= swap16OnLE(*bmpSrcPos << modX);
-				}
-			}
-			else
+			for (currentRow = y; currentRow <= bitmapEndY;
+				 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_WORDS)
 			{
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_WORDS)
-				{
-					*scrnPlotPos |= swap16OnLE(*bmpSrcPos << modX);
-				}
+				*scrnPlotPos       = ~swap16OnLE((UINT16)(*bmpSrcPos >> 16));
+				*(scrnPlotPos + 1) = ~swap16OnLE((UINT16)*bmpSrcPos);
 			}
 		}
-		else if (x > RAST16_MAX_VIS_X)
+		else if (destructive)
 		{
-			if (blackScreen && destructive)
-			{
-				clrMaskVal = 0xFFFFu << (16 - modX);
-				xorMaskVal = 0xFFFFu >> modX;
-
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_WORDS)
-				{
-					scrnPlotVal = swap16OnLE(*scrnPlotPos);
-
-					*scrnPlotPos = swap16OnLE((scrnPlotVal & clrMaskVal) | (
-								   (*bmpSrcPos >> modX) ^ xorMaskVal));
-				}
-			}
-			else if (destructive)
-			{
-				clrMaskVal = 0xFFFFu << (16 - modX);
-
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_WORDS)
-				{
-					scrnPlotVal = swap16OnLE(*scrnPlotPos);
-
-					*scrnPlotPos = swap16OnLE((scrnPlotVal & clrMaskVal) |
-								   (*bmpSrcPos >> modX));
-				}
-			}
-			else if (blackScreen)
-			{
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_WORDS)
-				{
-					*scrnPlotPos ^= swap16OnLE(*bmpSrcPos >> modX);
-				}
-			} 
-			else
+			for (currentRow = y; currentRow <= bitmapEndY;
+				 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_WORDS)
 			{
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_WORDS)
-				{
-					*scrnPlotPos |= swap16OnLE(*bmpSrcPos >> modX);
-				}
+				*scrnPlotPos       = swap16OnLE((UINT16)(*bmpSrcPos >> 16));
+				*(scrnPlotPos + 1) = swap16OnLE((UINT16)*bmpSrcPos);
 			}
 		}
-		else if (modX == 0)
+		else if (blackScreen)
 		{
-			if (blackScreen && destructive)
-			{
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_WORDS)
-				{
-					*scrnPlotPos = swap16OnLE(*bmpSrcPos ^ 0xFFFFu);
-				}
-			}
-			else if (destructive)
-			{
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_WORDS)
-				{
-					*scrnPlotPos = swap16OnLE(*bmpSrcPos);
-				}
-			}
-			else if (blackScreen)
-			{
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_WORDS)
-				{
-					*scrnPlotPos ^= swap16OnLE(*bmpSrcPos);
-				}
-			} 
-			else
+			for (currentRow = y; currentRow <= bitmapEndY;
+				 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_WORDS)
 			{
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_WORDS)
-				{
-					*scrnPlotPos |= swap16OnLE(*bmpSrcPos);
-				}
+				*scrnPlotPos       ^= swap16OnLE((UINT16)(*bmpSrcPos >> 16));
+				*(scrnPlotPos + 1) ^= swap16OnLE((UINT16)*bmpSrcPos);
 			}
 		}
 		else
 		{
-			numPxFromRight = 16 - modX;
-
-			if (blackScreen && destructive)
-			{
-				leftClrMaskVal  = 0xFFFFu << numPxFromRight;
-				rightClrMaskVal = 0xFFFFu >> modX;
-
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_WORDS)
-				{
-					scrnPlotVal = swap16OnLE(*scrnPlotPos);
-
-					*scrnPlotPos = swap16OnLE((scrnPlotVal & leftClrMaskVal) |
-								   ((*bmpSrcPos >> modX) ^ rightClrMaskVal));
-
-					scrnPlotVal = swap16OnLE(*(scrnPlotPos + 1));
-
-					*(scrnPlotPos + 1) = swap16OnLE((scrnPlotVal &
-										 rightClrMaskVal) | ((*bmpSrcPos <<
-										 numPxFromRight) ^ leftClrMaskVal));
-				}
-			}
-			else if (destructive)
-			{
-				leftClrMaskVal  = 0xFFFFu << numPxFromRight;
-				rightClrMaskVal = 0xFFFFu >> modX;
-
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_WORDS)
-				{
-					scrnPlotVal = swap16OnLE(*scrnPlotPos);
-
-					*scrnPlotPos = swap16OnLE((scrnPlotVal & leftClrMaskVal) |
-								   (*bmpSrcPos >> modX));
-
-					scrnPlotVal = swap16OnLE(*(scrnPlotPos + 1));
-
-					*(scrnPlotPos + 1) = swap16OnLE((scrnPlotVal &
-										 rightClrMaskVal) | (*bmpSrcPos <<
-										 numPxFromRight));
-				}
-			}
-			else if (blackScreen)
-			{
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_WORDS)
-				{
-					*scrnPlotPos ^= swap16OnLE(*bmpSrcPos >> modX);
-					*(scrnPlotPos + 1) ^= swap16OnLE(*bmpSrcPos <<
-													 numPxFromRight);
-				}
-			}
-			else
+			for (currentRow = y; currentRow <= bitmapEndY;
+				 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_WORDS)
 			{
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_WORDS)
-				{
-					*scrnPlotPos |= swap16OnLE(*bmpSrcPos >> modX);
-					*(scrnPlotPos + 1) |= swap16OnLE(*bmpSrcPos <<
-													 numPxFromRight);
-				}
+				*scrnPlotPos       |= swap16OnLE((UINT16)(*bmpSrcPos >> 16));
+				*(scrnPlotPos + 1) |= swap16OnLE((UINT16)*bmpSrcPos);
 			}
 		}
 	}
 }
 
-void plot_rast8(UINT8* const base, int x, int y, int height,
-				const UINT8* const bitmap, BOOL destructive, BOOL blackScreen)
+void plot_grid_alpha(UINT32* const base, int x, int y, int height,
+					 const UINT32* const bitmap)
 {
-	const UINT8* bmpSrcPos;
+	const UINT32* bmpSrcPos;
 
 	int bitmapEndY = y + height - 1;
 	int currentRow;
-	int modX;
-	int numPxFromRight;
-	UINT8* scrnPlotPos;
-
-	UINT8 clrMaskVal;
-	UINT8 leftClrMaskVal;
-	UINT8 rightClrMaskVal;
-	UINT8 xorMaskVal;
+	UINT16* scrnPlotPos;
 
 	if (bitmapEndY > SCRN_MAX_Y)
 	{
 		bitmapEndY = SCRN_MAX_Y;
 	}
 
-	if (x >= RAST8_MIN_X && x < (SCRN_LEN)
-	&& bitmapEndY >= 0 && y <= SCRN_MAX_Y
-	&& height > 0)
+	if (onRast32Grid(x) && bitmapEndY >= 0 && y <= SCRN_MAX_Y && height > 0)
 	{
-		modX = (abs(x) & 7);
-		scrnPlotPos = (x < 0) ? base : (base + (x >> DIV_SHIFT_BY_8));
+		scrnPlotPos = (UINT16 *)base + (x >> DIV_SHIFT_BY_16);
 		bmpSrcPos = bitmap;
 
 		if (y > 0)
 		{
-			scrnPlotPos += y * SCRN_LEN_BYTES;
+			scrnPlotPos += y * SCRN_LEN_WORDS;
 		}
 		else if (y < 0)
 		{
-			bmpSrcPos += y * -1; 
+			bmpSrcPos += y * -1;
 			y = 0;
 		}
 
-		if (x < 0)
+		for (currentRow = y; currentRow <= bitmapEndY;
+			 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_WORDS)
 		{
-			if (blackScreen && destructive)
-			{
-				clrMaskVal = 0xFFu >> (8 + x);
-				xorMaskVal = 0xFFu << modX;
+			*scrnPlotPos       &= swap16OnLE((UINT16)(*bmpSrcPos >> 16));
+			*(scrnPlotPos + 1) &= swap16OnLE((UINT16)*bmpSrcPos);
+		}
+	}
+}
 
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_BYTES)
-				{
-					*scrnPlotPos = (*scrnPlotPos & clrMaskVal) | ((*bmpSrcPos <<
-								   modX) ^ xorMaskVal);
-				}
-			}
-			else if (destructive)
-			{
-				clrMaskVal = 0xFFu >> modX;
+void span_fill(UINT32* const base, int x1, int x2, int y, int height,
+			   BOOL set)
+{
+	const int    FIRST_LONG = x1 >> DIV_SHIFT_BY_32;
+	const int    LAST_LONG = x2 >> DIV_SHIFT_BY_32;
+	const UINT32 PATTERN = (set ? 0xFFFFFFFFu : 0);
 
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_BYTES)
-				{ 
-					*scrnPlotPos = (*scrnPlotPos & clrMaskVal) |
-								   (*bmpSrcPos << modX);
-				}
-			}
-			else if (blackScreen)
-			{
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_BYTES)
-				{
-					*scrnPlotPos ^= *bmpSrcPos << modX;
-				}
-			}
-			else
-			{
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_BYTES)
-				{
-					*scrnPlotPos |= *bmpSrcPos << modX;
-				}
-			}
-		}
-		else if (x > RAST8_MAX_VIS_X)
-		{
-			if (blackScreen && destructive)
-			{
-				clrMaskVal = 0xFFu << (8 - modX);
-				xorMaskVal = 0xFFu >> modX;
+	UINT32 leftMask = 0xFFFFFFFFu >> (x1 & 31);
+	UINT32 rightMask = 0xFFFFFFFFu << (31 - (x2 & 31));
 
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_BYTES)
-				{
-					*scrnPlotPos = (*scrnPlotPos & clrMaskVal) | ((*bmpSrcPos >>
-								   modX) ^ xorMaskVal);
-				}
-			}
-			else if (destructive)
-			{
-				clrMaskVal = 0xFFu << (8 - modX);
+	UINT32* scrnPlotPos = base + y * SCRN_LEN_LONG;
 
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_BYTES)
-				{
-					*scrnPlotPos = (*scrnPlotPos & clrMaskVal) | (*bmpSrcPos >>
-								   modX);
-				}
-			}
-			else if (blackScreen)
-			{
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_BYTES)
-				{
-					*scrnPlotPos ^= *bmpSrcPos >> modX;
-				}
-			}
-			else
-			{
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_BYTES)
-				{
-					*scrnPlotPos |= *bmpSrcPos >> modX;
-				}
-			}
+	/* The rows of a span taking up the entire length of the screen are
+	contiguous, so they can be filled as a single block. */
+	if (x1 == 0 && x2 == SCRN_MAX_X)
+	{
+		fillLongs(scrnPlotPos, PATTERN, height * SCRN_LEN_LONG);
+	}
+	else
+	{
+		if (FIRST_LONG == LAST_LONG)
+		{
+			leftMask &= rightMask;
 		}
-		else if (modX == 0)
+
+		/* The masks are put into the byte order of the screen once, so that
+		nothing needs to be swapped in the row loop. */
+		leftMask = swap32OnLE(leftMask);
+		rightMask = swap32OnLE(rightMask);
+
+		for (; height > 0; height--, scrnPlotPos += SCRN_LEN_LONG)
 		{
-			if (blackScreen && destructive)
-			{
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_BYTES)
-				{
-					*scrnPlotPos = (*bmpSrcPos ^ 0xFFu);
-				}
-			}
-			else if (destructive)
-			{
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_BYTES)
-				{
-					*scrnPlotPos = *bmpSrcPos;
-				}
-			}
-			else if (blackScreen)
+			if (set)
 			{
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_BYTES)
-				{
-					*scrnPlotPos ^= *bmpSrcPos;
-				}
+				scrnPlotPos[FIRST_LONG] |= leftMask;
 			}
 			else
 			{
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_BYTES)
-				{
-					*scrnPlotPos |= *bmpSrcPos;
-				}
+				scrnPlotPos[FIRST_LONG] &= ~leftMask;
 			}
-		}
-		else
-		{
-			numPxFromRight = 8 - modX;
-
-			if (blackScreen && destructive)
-			{
-				leftClrMaskVal  = 0xFFu << numPxFromRight;
-				rightClrMaskVal = 0xFFu >> modX;
 
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_BYTES)
-				{
-					*scrnPlotPos = (*scrnPlotPos & leftClrMaskVal) | (
-									(*bmpSrcPos >> modX) ^ rightClrMaskVal);
-
-					*(scrnPlotPos + 1) = (*(scrnPlotPos + 1) &
-										  rightClrMaskVal) | ((*bmpSrcPos <<
-										  numPxFromRight) ^ leftClrMaskVal);
-				}
-			}
-			else if (destructive)
+			if (FIRST_LONG != LAST_LONG)
 			{
-				leftClrMaskVal  = 0xFFu << numPxFromRight;
-				rightClrMaskVal = 0xFFu >> modX;
+				fillLongs(scrnPlotPos + FIRST_LONG + 1, PATTERN,
+						  LAST_LONG - FIRST_LONG - 1);
 
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_BYTES)
-				{
-					*scrnPlotPos = (*scrnPlotPos & leftClrMaskVal) |
-								   (*bmpSrcPos >> modX);
-
-					*(scrnPlotPos + 1) = (*(scrnPlotPos + 1) &
-										  rightClrMaskVal) | (*bmpSrcPos <<
-										  numPxFromRight);
-				}
-			}
-			else if (blackScreen)
-			{
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_BYTES)
+				if (set)
 				{
-					*scrnPlotPos ^= *bmpSrcPos >> modX;
-					*(scrnPlotPos + 1) ^= *bmpSrcPos << numPxFromRight;
+					scrnPlotPos[LAST_LONG] |= rightMask;
 				}
-			}
-			else
-			{
-				for (currentRow = y; currentRow <= bitmapEndY;
-					 currentRow++, bmpSrcPos++, scrnPlotPos += SCRN_LEN_BYTES)
+				else
 				{
-					*scrnPlotPos |= *bmpSrcPos >> modX;
-					*(scrnPlotPos + 1) |= *bmpSrcPos << numPxFromRight;
+					scrnPlotPos[LAST_LONG] &= ~rightMask;
 				}
 			}
 		}
 	}
 }
 
-void rect_area(UINT32* const base, int x, int length, int y, int height)
+void scroll_down(UINT32* const base, int top, int bottom, int distance)
 {
-	const int FINAL_X = x + length - 1;
-	const int FINAL_Y = y + height - 1;
-
-	int xIndex;
-	int yCounter;
-	int xMaxVal;
-	int yMaxVal;
-	int xLong;
-	int xMaxLong;
-	int xDiffLong;
-
-	UINT32 leftSegBitpattern;
-	UINT32 rightSegBitpattern;
-
-	UINT32* scrnPlotPos;
+	const int ROWS = bottom - top - distance + 1;
 
-	if (x >= 0 && x < SCRN_LEN && length > 0 &&
-		y >= 0 && y < SCRN_HEIGHT && height > 0)
+	if (ROWS > 0)
 	{
-		xMaxVal = (FINAL_X < SCRN_LEN ? FINAL_X : SCRN_MAX_X);
-		yMaxVal = (FINAL_Y < SCRN_HEIGHT ? FINAL_Y : SCRN_MAX_Y);
-
-		xLong = (x >> DIV_SHIFT_BY_32);
-		xMaxLong = (xMaxVal >> DIV_SHIFT_BY_32);
-		xDiffLong = xMaxLong - xLong;
-
-		scrnPlotPos = base + (y * SCRN_LEN_LONG) + xLong;
-
-		leftSegBitpattern = 0xFFFFFFFFu >> (x & 31);
-		rightSegBitpattern = 0xFFFFFFFFu << (31 - (xMaxVal & 31));
-
-		if (xLong == xMaxLong)
-		{
-			for (yCounter = y; yCounter <= yMaxVal;
-				 yCounter++, scrnPlotPos += SCRN_LEN_LONG)
-			{	
-				*scrnPlotPos |= swap32OnLE(leftSegBitpattern &
-										   rightSegBitpattern);
-			}
-		}
-		else
-		{
-			for (yCounter = y; yCounter <= yMaxVal;
-				 yCounter++, scrnPlotPos += SCRN_LEN_LONG)
-			{
-				*scrnPlotPos |= swap32OnLE(leftSegBitpattern);
-
-				for (xIndex = 1; xIndex < xDiffLong; xIndex++)
-				{
-					*(scrnPlotPos + xIndex) = 0xFFFFFFFFu;
-				}
-
-				*(scrnPlotPos + xIndex) |= swap32OnLE(rightSegBitpattern);
-			}
-		}
+		memmove(base + (top + distance) * SCRN_LEN_LONG,
+				base + top * SCRN_LEN_LONG,
+				ROWS * SCRN_LEN_LONG * sizeof(UINT32));
 	}
 }
 
-void clr_area(UINT32* const base, int x, int length, int y, int height)
+void fill_scrn(UINT32* const base)
 {
-	const int FINAL_X = x + length - 1;
-	const int FINAL_Y = y + height - 1;
-
-	int xIndex;
-	int yCounter;
-	int xMaxVal;
-	int yMaxVal;
-	int xLong;
-	int xMaxLong;
-	int xDiffLong;
-
-	UINT32 leftSegBitpattern;
-	UINT32 rightSegBitpattern;
-
-	UINT32* scrnPlotPos;
-
-	if (x >= 0 && x < SCRN_LEN && length > 0 &&
-		y >= 0 && y < SCRN_HEIGHT && height > 0)
-	{
-		xMaxVal = (FINAL_X < SCRN_LEN ? FINAL_X : SCRN_MAX_X);
-		yMaxVal = (FINAL_Y < SCRN_HEIGHT ? FINAL_Y : SCRN_MAX_Y);
-
-		xLong = (x >> DIV_SHIFT_BY_32);
-		xMaxLong = (xMaxVal >> DIV_SHIFT_BY_32);
-		xDiffLong = xMaxLong - xLong;
-
-		scrnPlotPos = base + (y * SCRN_LEN_LONG) + xLong;
-
-		leftSegBitpattern = 0xFFFFFFFFu << (32 - (x & 31));
-		rightSegBitpattern = 0xFFFFFFFFu >> (1 + (xMaxVal & 31));
-
-		if (xLong == xMaxLong)
-		{
-			for (yCounter = y; yCounter <= yMaxVal;
-				 yCounter++, scrnPlotPos += SCRN_LEN_LONG)
-			{	
-				*scrnPlotPos &= swap32OnLE(leftSegBitpattern ^
-										   rightSegBitpattern);
-			}
-		}
-		else
-		{
-			for (yCounter = y; yCounter <= yMaxVal;
-				 yCounter++, scrnPlotPos += SCRN_LEN_LONG)
-			{
-				*scrnPlotPos &= swap32OnLE(leftSegBitpattern);
-
-				for (xIndex = 1; xIndex < xDiffLong; xIndex++)
-				{
-					*(scrnPlotPos + xIndex) = 0;
-				}
-
-				*(scrnPlotPos + xIndex) &= swap32OnLE(rightSegBitpattern);
-			}
-		}
-	}
+	fillLongs(base, 0xFFFFFFFFu, SCRN_LONGS);
 }
 
-#ifndef M68K_CPU
-void fill_scrn(UINT32* const base)
+void clr_scrn(UINT32* const base)
 {
-	int index;
-
-	for (index = 0; index < SCRN_LONGS; index++)
-	{
-		base[index] = 0xFFFFFFFFu;
-	}
+	fillLongs(base, 0x00000000u, SCRN_LONGS);
 }
 
-void clr_scrn(UINT32* const base)
+/**
+ * @brief Sets a run of longs to the given pattern.
+ * @details When built for a host with SSE2 (or AVX2) enabled, as many of the
+ * longs as possible are written 128 (or 256) bits at a time. The pattern is
+ * written as is, so it must already be in the byte order of the screen.
+ *
+ * @param dest The first long to set.
+ * @param pattern The value to set every long to.
+ * @param count The number of longs to set.
+ */
+void fillLongs(UINT32* dest, UINT32 pattern, int count)
 {
-	int index;
+#ifdef __AVX2__
+	const __m256i PATTERN256 = _mm256_set1_epi32((int)pattern);
+#endif
+#ifdef __SSE2__
+	const __m128i PATTERN128 = _mm_set1_epi32((int)pattern);
+#endif
+
+#ifdef __AVX2__
+	for (; count >= 8; count -= 8, dest += 8)
+	{
+		_mm256_storeu_si256((__m256i *)dest, PATTERN256);
+	}
+#endif
+#ifdef __SSE2__
+	for (; count >= 4; count -= 4, dest += 4)
+	{
+		_mm_storeu_si128((__m128i *)dest, PATTERN128);
+	}
+#endif
 
-	for (index = 0; index < SCRN_LONGS; index++)
+	for (; count > 0; count--, dest++)
 	{
-		base[index] = 0x00000000u;
+		*dest = pattern;
 	}
 }
 #endif
\ No newline at end of file
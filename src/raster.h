@@ -219,6 +219,65 @@
 #define RAST8H_MIN_Y -7
 
 
+/**
+ * @brief Determines if a 32-bit wide raster at the given x coordinate can be
+ * plotted by plot_grid32() or plot_grid_alpha().
+ * @details This is the case when the raster starts on a word boundary and is
+ * entirely visible on the screen. All positions on the 32 px grid used by the
+ * game world (which starts 16 px in from the left side of the screen) satisfy
+ * this.
+ */
+#define onRast32Grid(x) \
+	(((x) & 15) == 0 && (x) >= 0 && (x) <= RAST32_MAX_VIS_X)
+
+/**
+ * @brief The ways in which a bitmap can be combined with the screen.
+ * @details RAST_OR overlays the bitmap, RAST_XOR overlays it in white on a
+ * black background, RAST_COPY replaces whatever was beneath the bitmap and
+ * RAST_COPY_INV does the same in white on a black background.
+ */
+typedef enum
+{
+	RAST_OR       = 0,
+	RAST_XOR      = 1,
+	RAST_COPY     = 2,
+	RAST_COPY_INV = 3
+} RastMode;
+
+/**
+ * @brief The number of values a RastMode can have.
+ */
+#define NUM_RAST_MODES 4
+
+/**
+ * @brief Gives the RastMode matching the destructive and blackScreen flags
+ * taken by plot_rast32(), plot_rast16() and plot_rast8().
+ */
+#define rastMode(destructive, blackScreen) \
+	((RastMode)(((destructive) ? RAST_COPY : RAST_OR) | \
+				((blackScreen) ? RAST_XOR : RAST_OR)))
+
+/**
+ * @brief A function that plots a 32-bit wide bitmap using a fixed RastMode.
+ * @details Clipping follows the same rules as plot_rast32().
+ */
+typedef void (*Rast32Fn)(UINT32* const base, int x, int y, int height,
+						 const UINT32* const bitmap);
+
+/**
+ * @brief A function that plots a 16-bit wide bitmap using a fixed RastMode.
+ * @details Clipping follows the same rules as plot_rast16().
+ */
+typedef void (*Rast16Fn)(UINT16* const base, int x, int y, int height,
+						 const UINT16* const bitmap);
+
+/**
+ * @brief A function that plots a 8-bit wide bitmap using a fixed RastMode.
+ * @details Clipping follows the same rules as plot_rast8().
+ */
+typedef void (*Rast8Fn)(UINT8* const base, int x, int y, int height,
+						const UINT8* const bitmap);
+
 /**
  * @brief Plots a pixel at the given coordinates on the screen.
  * @details Nothing will be plotted if the given x and y value are out of
@@ -349,6 +408,37 @@ void plot_rast32(UINT32* const base, int x, int y, int height,
 void plot_alpha(UINT32* const base, int x, int y, int height,
 				const UINT32* const bitmap);
 
+/**
+ * @brief The number of longs each row of a masked bitmap takes up.
+ * @details The first long of each row is the mask and the second is the image.
+ */
+#define MASKED_ROW_LONGS 2
+
+/**
+ * @brief Plots a 32-bit wide masked bitmap of any height.
+ * @details Each row of the masked bitmap holds a mask followed by an image.
+ * Every pixel set in the mask is cleared from the screen before the image is
+ * overlayed, all in one pass over the screen, so that a sprite replaces what
+ * was behind it without needing a separate call to plot_alpha() or clr_area().
+ * Clipping follows the same rules as plot_rast32().
+ * 
+ * @warning Extreme caution needs to be taken with the height parameter, as it
+ * is impossible to confirm if it exceeds any upper bound. If a height is given
+ * that is greater than the actual height of the bitmap, then it may corrupt
+ * part of memory.
+ * 
+ * @param base The location in memory to plot at.
+ * @param x The left-most column to begin to plot the raster (in pixels starting
+ * at zero).
+ * @param y The top-most row to begin to plot the raster (in pixels starting at
+ * zero).
+ * @param height The height of the masked bitmap. Must be one or greater.
+ * @param masked The masked bitmap that is to be plotted on screen, holding
+ * MASKED_ROW_LONGS longs per row.
+ */
+void plot_masked32(UINT32* const base, int x, int y, int height,
+				   const UINT32* const masked);
+
 /**
  * @brief Plots a 16-bit wide bitmap of any height.
  * @details The bitmap pointed to by the bitmap pointer will be plotted starting
@@ -446,6 +536,366 @@ void plot_rast16(UINT16* const base, int x, int y, int height,
 void plot_rast8(UINT8* const base, int x, int y, int height,
 				const UINT8* const bitmap, BOOL destructive, BOOL blackScreen);
 
+/**
+ * @brief Gives the function that plots 32-bit wide bitmaps using the given
+ * mode.
+ * @details Binding the function once and calling it for every bitmap avoids
+ * having to pick the mode out again on every call to plot_rast32().
+ *
+ * @param mode The way in which bitmaps are to be combined with the screen.
+ * @return One of plot_or32(), plot_xor32(), plot_copy32() or plot_inv32().
+ */
+Rast32Fn bind_rast32(RastMode mode);
+
+/**
+ * @brief Gives the function that plots 16-bit wide bitmaps using the given
+ * mode.
+ *
+ * @param mode The way in which bitmaps are to be combined with the screen.
+ * @return One of plot_or16(), plot_xor16(), plot_copy16() or plot_inv16().
+ */
+Rast16Fn bind_rast16(RastMode mode);
+
+/**
+ * @brief Gives the function that plots 8-bit wide bitmaps using the given
+ * mode.
+ *
+ * @param mode The way in which bitmaps are to be combined with the screen.
+ * @return One of plot_or8(), plot_xor8(), plot_copy8() or plot_inv8().
+ */
+Rast8Fn bind_rast8(RastMode mode);
+
+/**
+ * @brief Plots a 32-bit wide bitmap using RAST_OR (see plot_rast32()).
+ */
+void plot_or32(UINT32* const base, int x, int y, int height,
+			   const UINT32* const bitmap);
+
+/**
+ * @brief Plots a 32-bit wide bitmap using RAST_XOR (see plot_rast32()).
+ */
+void plot_xor32(UINT32* const base, int x, int y, int height,
+				const UINT32* const bitmap);
+
+/**
+ * @brief Plots a 32-bit wide bitmap using RAST_COPY (see plot_rast32()).
+ */
+void plot_copy32(UINT32* const base, int x, int y, int height,
+				 const UINT32* const bitmap);
+
+/**
+ * @brief Plots a 32-bit wide bitmap using RAST_COPY_INV (see plot_rast32()).
+ */
+void plot_inv32(UINT32* const base, int x, int y, int height,
+				const UINT32* const bitmap);
+
+/**
+ * @brief Plots a 16-bit wide bitmap using RAST_OR (see plot_rast16()).
+ */
+void plot_or16(UINT16* const base, int x, int y, int height,
+			   const UINT16* const bitmap);
+
+/**
+ * @brief Plots a 16-bit wide bitmap using RAST_XOR (see plot_rast16()).
+ */
+void plot_xor16(UINT16* const base, int x, int y, int height,
+				const UINT16* const bitmap);
+
+/**
+ * @brief Plots a 16-bit wide bitmap using RAST_COPY (see plot_rast16()).
+ */
+void plot_copy16(UINT16* const base, int x, int y, int height,
+				 const UINT16* const bitmap);
+
+/**
+ * @brief Plots a 16-bit wide bitmap using RAST_COPY_INV (see plot_rast16()).
+ */
+void plot_inv16(UINT16* const base, int x, int y, int height,
+				const UINT16* const bitmap);
+
+/**
+ * @brief Plots a 8-bit wide bitmap using RAST_OR (see plot_rast8()).
+ */
+void plot_or8(UINT8* const base, int x, int y, int height,
+			  const UINT8* const bitmap);
+
+/**
+ * @brief Plots a 8-bit wide bitmap using RAST_XOR (see plot_rast8()).
+ */
+void plot_xor8(UINT8* const base, int x, int y, int height,
+			   const UINT8* const bitmap);
+
+/**
+ * @brief Plots a 8-bit wide bitmap using RAST_COPY (see plot_rast8()).
+ */
+void plot_copy8(UINT8* const base, int x, int y, int height,
+				const UINT8* const bitmap);
+
+/**
+ * @brief Plots a 8-bit wide bitmap using RAST_COPY_INV (see plot_rast8()).
+ */
+void plot_inv8(UINT8* const base, int x, int y, int height,
+			   const UINT8* const bitmap);
+
+/**
+ * @brief Plots a 32-bit wide bitmap of any height that starts on a word
+ * boundary.
+ * @details Behaves like plot_rast32(), except that the x coordinate must
+ * satisfy onRast32Grid(). Since the 68000 only requires long accesses to be
+ * word aligned, every row of the bitmap is written to the screen as is without
+ * any shifting or masking. If the x coordinate is not on the grid, nothing will
+ * be plotted.
+ * 
+ * @param base The location in memory to plot at.
+ * @param x The left-most column to begin to plot the raster (in pixels starting
+ * at zero). Must be a multiple of 16.
+ * @param y The top-most row to begin to plot the raster (in pixels starting at
+ * zero).
+ * @param height The height of the bitmap. Must be one or greater.
+ * @param bitmap The bitmap that is to be plotted on screen.
+ * @param destructive When true, indicates that any pre-existing drawings in the
+ * region where the bitmap is being placed should be destroyed.
+ * @param blackScreen When true, indicates that the raster is to be printed on a
+ * black background.
+ */
+void plot_grid32(UINT32* const base, int x, int y, int height,
+				 const UINT32* const bitmap, BOOL destructive,
+				 BOOL blackScreen);
+
+/**
+ * @brief Applies a 32-bit wide alpha bitmap of any height that starts on a word
+ * boundary.
+ * @details Behaves like plot_alpha(), except that the x coordinate must
+ * satisfy onRast32Grid(). If it does not, nothing will be plotted.
+ * 
+ * @param base The location in memory to plot at.
+ * @param x The left-most column to begin to apply the alpha (in pixels starting
+ * at zero). Must be a multiple of 16.
+ * @param y The top-most row to begin to apply the alpha (in pixels starting at
+ * zero).
+ * @param height The height of the alpha bitmap. Must be one or greater.
+ * @param bitmap The alpha bitmap that is to be applied to the screen.
+ */
+void plot_grid_alpha(UINT32* const base, int x, int y, int height,
+					 const UINT32* const bitmap);
+
+/**
+ * @brief The most commands that a DrawList can hold before it has to be drawn.
+ */
+#define MAX_DRAW_CMDS 64
+
+/**
+ * @brief The ways in which a bitmap queued on a DrawList can be plotted.
+ * @details The first four modes plot 32-bit wide bitmaps and the next four
+ * plot 16-bit wide bitmaps, both in the order of RastMode. DRAW_MASKED32 plots
+ * a masked bitmap (see plot_masked32()).
+ */
+typedef enum
+{
+	DRAW_OR32     = 0,
+	DRAW_XOR32    = 1,
+	DRAW_COPY32   = 2,
+	DRAW_INV32    = 3,
+	DRAW_OR16     = 4,
+	DRAW_XOR16    = 5,
+	DRAW_COPY16   = 6,
+	DRAW_INV16    = 7,
+	DRAW_MASKED32 = 8
+} DrawMode;
+
+/**
+ * @brief The number of values a DrawMode can have.
+ */
+#define NUM_DRAW_MODES 9
+
+/**
+ * @brief Gives the DrawMode that plots 32-bit wide bitmaps using the given
+ * RastMode.
+ */
+#define drawMode32(rastMode) ((DrawMode)(rastMode))
+
+/**
+ * @brief Gives the DrawMode that plots 16-bit wide bitmaps using the given
+ * RastMode.
+ */
+#define drawMode16(rastMode) ((DrawMode)((rastMode) + DRAW_OR16))
+
+/**
+ * @brief A routine that plots a fixed bitmap at the given word on screen
+ * without doing any clipping, such as a compiled sprite (see cspr.h).
+ */
+typedef void (*DrawFixedFn)(UINT16* const dest);
+
+/**
+ * @brief A bitmap waiting to be plotted by draw_list().
+ * @details The clipping of the command and the word on screen that it starts
+ * at are worked out once when it is queued.
+ */
+typedef struct
+{
+	const void* bitmap;
+	DrawFixedFn fixed;
+	int         x;
+	int         y;
+	int         height;
+	DrawMode    mode;
+	int         offset;
+	BOOL        clipped;
+} DrawCmd;
+
+/**
+ * @brief Holds the bitmaps waiting to be plotted to a frame buffer.
+ */
+typedef struct
+{
+	UINT32* base;
+	DrawCmd cmds[MAX_DRAW_CMDS];
+	int     order[MAX_DRAW_CMDS];
+	int     numCmds;
+} DrawList;
+
+/**
+ * @brief Readies an empty DrawList for plotting to the given frame buffer.
+ * 
+ * @param list The DrawList to initialize.
+ * @param base The location in memory that the queued bitmaps are to be
+ * plotted at.
+ */
+void init_draw_list(DrawList* const list, UINT32* const base);
+
+/**
+ * @brief Queues a bitmap to be plotted by draw_list().
+ * @details Clipping follows the same rules as plot_rast32() (or plot_rast16()
+ * for 16-bit wide modes). A bitmap that would not be visible at all is not
+ * queued. If the list is already full, it is drawn first.
+ * 
+ * @warning The bitmap must remain valid until the list is drawn.
+ * 
+ * @param list The DrawList to queue the bitmap on.
+ * @param bitmap The bitmap that is to be plotted on screen. Holds UINT32 rows
+ * for 32-bit wide modes and UINT16 rows for 16-bit wide modes.
+ * @param x The left-most column to begin to plot the bitmap (in pixels starting
+ * at zero).
+ * @param y The top-most row to begin to plot the bitmap (in pixels starting at
+ * zero).
+ * @param height The height of the bitmap. Must be one or greater.
+ * @param mode The way in which the bitmap is to be plotted.
+ */
+void add_draw(DrawList* const list, const void* const bitmap, int x, int y,
+			  int height, DrawMode mode);
+
+/**
+ * @brief Queues a bitmap that also has a routine which can plot it without
+ * clipping (see add_draw()).
+ * @details The routine is used instead of the bitmap whenever the bitmap
+ * starts on a word boundary and is entirely visible on the screen.
+ * 
+ * @param list The DrawList to queue the bitmap on.
+ * @param fixed The routine that plots the same thing as the bitmap and mode.
+ * @param bitmap The bitmap that is to be plotted on screen.
+ * @param x The left-most column to begin to plot the bitmap (in pixels starting
+ * at zero).
+ * @param y The top-most row to begin to plot the bitmap (in pixels starting at
+ * zero).
+ * @param height The height of the bitmap. Must be one or greater.
+ * @param mode The way in which the bitmap is to be plotted.
+ */
+void add_fixed_draw(DrawList* const list, DrawFixedFn fixed,
+					const void* const bitmap, int x, int y, int height,
+					DrawMode mode);
+
+/**
+ * @brief Plots every bitmap queued on a DrawList and then empties it.
+ * @details The bitmaps are plotted in order of the address that they start at
+ * on screen. Bitmaps that start at the same address are plotted in the order
+ * they were queued, but bitmaps that overlap without starting at the same
+ * address may be plotted in any order, so they should be queued between
+ * separate calls to draw_list().
+ * 
+ * @param list The DrawList to draw.
+ */
+void draw_list(DrawList* const list);
+
+/**
+ * @brief The most areas that a SaveList can hold the background of.
+ */
+#define MAX_SAVED_AREAS 48
+
+/**
+ * @brief The number of longs of background that a SaveList can hold.
+ * @details Enough for MAX_SAVED_AREAS 32x32 sprites that are not long aligned.
+ */
+#define SAVE_POOL_LONGS 3072
+
+/**
+ * @brief The background of an area of the screen saved by save_area().
+ * @details The area is widened to whole longs. Its rows are stored one after
+ * another in the pool of the SaveList that holds it.
+ */
+typedef struct
+{
+	int offset;
+	int longs;
+	int rows;
+	int poolPos;
+} SavedArea;
+
+/**
+ * @brief Holds the backgrounds of the areas of a frame buffer that sprites
+ * were plotted over, so that they can later be erased without redrawing the
+ * whole background.
+ * @details If the background under a sprite could not be saved because the
+ * list was full, complete is set to FALSE, and the list can no longer be used
+ * to erase everything that was plotted.
+ */
+typedef struct
+{
+	UINT32*   base;
+	SavedArea areas[MAX_SAVED_AREAS];
+	UINT32    pool[SAVE_POOL_LONGS];
+	int       numAreas;
+	int       poolUsed;
+	BOOL      complete;
+} SaveList;
+
+/**
+ * @brief Readies an empty SaveList for the given frame buffer.
+ *
+ * @param list The SaveList to initialize.
+ * @param base The location in memory of the frame buffer whose background is
+ * to be saved.
+ */
+void init_save_list(SaveList* const list, UINT32* const base);
+
+/**
+ * @brief Saves the background of a rectangular area of the frame buffer of a
+ * SaveList, before a sprite is plotted over it.
+ * @details The area is cropped to the screen and widened to whole longs.
+ *
+ * @param list The SaveList to save the area on.
+ * @param x The left-most column of the area (in pixels starting at zero).
+ * @param length The number of columns that make up the area.
+ * @param y The top-most row of the area (in pixels starting at zero).
+ * @param height The number of rows that make up the area.
+ * @return TRUE if the area was saved (or lies entirely off screen); FALSE if
+ * the list was full, in which case the list is no longer complete.
+ */
+BOOL save_area(SaveList* const list, int x, int length, int y, int height);
+
+/**
+ * @brief Copies every area saved on a SaveList back onto its frame buffer and
+ * then empties the list.
+ * @details The areas are restored in the reverse of the order that they were
+ * saved, so areas that overlap are put back as they were before any of them
+ * were plotted over.
+ *
+ * @param list The SaveList to restore.
+ * @return TRUE if the frame buffer is back to how it was before the sprites
+ * were plotted; FALSE if the list was not complete, in which case the
+ * background has to be redrawn by the caller.
+ */
+BOOL restore_saves(SaveList* const list);
+
 /**
  * @brief Plots a black rectangular area at the given memory location.
  * @details The rectangular area's top-left corner will be defined by the given
@@ -493,6 +943,45 @@ void rect_area(UINT32* const base, int x, int length, int y, int height);
  */
 void clr_area(UINT32* const base, int x, int length, int y, int height);
 
+/**
+ * @brief Sets or clears every pixel of a span of columns over a number of
+ * rows at the given memory location.
+ * @details This is the routine that hline(), rect_area() and clr_area() are
+ * built on. The partial longs at either end of each row are masked, while the
+ * longs in between are written whole (in bursts of 13 on the 68000). A span
+ * taking up the entire length of the screen is filled as one contiguous block.
+ * 
+ * @warning No clipping is done, so the span must lie entirely on screen.
+ * 
+ * @param base The location in memory to plot at.
+ * @param x1 The left-most column of the span (in pixels starting at zero).
+ * @param x2 The right-most column of the span (in pixels starting at zero).
+ * Must not be less than x1.
+ * @param y The top-most row of the span (in pixels starting at zero).
+ * @param height The number of rows that the span is filled on. Must be one or
+ * greater.
+ * @param set When true, the span is set to black. Otherwise, it is cleared.
+ */
+void span_fill(UINT32* const base, int x1, int x2, int y, int height,
+			   BOOL set);
+
+/**
+ * @brief Moves a block of rows at the given memory location down the screen.
+ * @details The rows moved past the bottom of the block are lost, while the top
+ * distance rows of the block are left as they were, so that they can be
+ * redrawn. Whole rows are moved at once (with movem bursts on the 68000).
+ * 
+ * @warning No clipping is done, so the block must lie entirely on screen.
+ * 
+ * @param base The location in memory to move the rows at.
+ * @param top The top-most row of the block (in pixels starting at zero).
+ * @param bottom The bottom-most row of the block (in pixels starting at zero).
+ * Must not be less than top.
+ * @param distance The number of rows to move the block down by. Must be one or
+ * greater. Nothing is moved if it is greater than the height of the block.
+ */
+void scroll_down(UINT32* const base, int top, int bottom, int distance);
+
 /**
  * @brief Sets all the pixels on the screen, thus setting the screen to black.
  * @param base The location in memory to plot at.
@@ -11,35 +11,375 @@
 
 #include "bitmaps.h"
 #include "bool.h"
+#include "cspr.h"
 #include "font16.h"
 #include "model.h"
 #include "move.h"
+#include "preshift.h"
 #include "raster.h"
 #include "renderer.h"
 #include "types.h"
 
-#define MAX_NUM_DIGITS_IN_SCORE UINT32_MAX_DIGITS
+/**
+ * @brief The number of slots needed to hold a sprite for every possible
+ * Direction.
+ */
+#define NUM_ORIENT_SLOTS 5
+
+/**
+ * @brief Gives the slot that holds the sprite facing the given Direction.
+ */
+#define orientSlot(orientation) ((orientation) + 2)
+
+ShiftSpr32 feathersSprites[NUM_ORIENT_SLOTS];
+ShiftSpr16 cursorSprite;
+
+DrawList drawList;
+
+/**
+ * @brief The pre-rendered strip of every row of the world, indexed the same
+ * as World rows.
+ */
+RowStrip rowStrips[MAX_ROWS];
+
+/**
+ * @brief The bitmap plotted for a cell that has an unknown CellType.
+ */
+const UINT32 blankCell[CELL_HEIGHT] = {0};
+
+const UINT32* carMasked[NUM_ORIENT_SLOTS];
+const UINT32* trainMasked[NUM_TRAIN_PARTS];
+const UINT32* playerMasked[NUM_ORIENT_SLOTS];
+
+/**
+ * @brief The compiled sprite for every CellType, indexed by its value.
+ */
+void (*const cellCsprs[NUM_CELL_TYPES])(UINT16* const dest) =
+{
+	cspr_grass, cspr_road, cspr_track, cspr_spike, cspr_hedge
+};
 
-void renderCar(UINT32* const base, int x, int y, Direction orientation);
+/**
+ * @brief The compiled sprite of the car facing every Direction, indexed by
+ * orientSlot(). Only horizontal directions have one.
+ */
+void (*const carCsprs[NUM_ORIENT_SLOTS])(UINT16* const dest) =
+{
+	NULL, cspr_car_w, NULL, cspr_car_e, NULL
+};
+
+/**
+ * @brief The compiled sprite of every part of the train, from left to right.
+ */
+void (*const trainCsprs[NUM_TRAIN_PARTS])(UINT16* const dest) =
+{
+	cspr_train1, cspr_train2, cspr_train3
+};
+
+void queueRow(DrawList* const list, const Row* const row);
+void updateRowStrip(RowStrip* const strip, const Row* const row);
+void pasteRowStrip(UINT32* const base, const World* const world, int index);
+void pasteStripCell(UINT32* const base, const World* const world,
+					const CellRef* const cell);
+void queueCell(DrawList* const list, const Cell* const cell, int y);
+void queueHazards(DrawList* const list, const Row* const row);
+void renderSurfRowHazards(const Surface* const surface, const Row* const row);
+void renderBandedRow(UINT32* const base, const Surface* const surface,
+					 const Row* const row, int topRow);
+void saveRowHazards(SaveList* const saves, const Row* const row);
+void queueCar(DrawList* const list, int x, int y, Direction orientation);
 void renderFeathers(UINT32* const base, int x, int y, Direction orientation);
-void renderTrain(UINT32* const base, int x, int y);
+void queueTrain(DrawList* const list, int x, int y);
+void queueLabel(DrawList* const list, const Label* const label,
+				BOOL blackScreen);
+
+void queueButton(DrawList* const list, Button* button, BOOL blackScreen);
+void queueInfoBar(DrawList* const list, InfoBar* const infoBar,
+				  BOOL blackScrn);
+
+void initOrientSprites(ShiftSpr32 sprites[],
+					   const UINT32* (*getBitmap)(Direction, UINT32*),
+					   int height, ShiftOp op);
+void initOrientMasked(const UINT32* masked[],
+					  const UINT32* (*getMasked)(Direction, UINT32*));
+
+void initRenderer(void)
+{
+	int trainPart;
+
+	initOrientSprites(feathersSprites, getFeathersBitmap, FEATHERS_HEIGHT,
+					  SHIFT_OR);
+
+	initOrientMasked(carMasked, getCarMasked);
+	initOrientMasked(playerMasked, getPlayerMasked);
+
+	for (trainPart = 0; trainPart < NUM_TRAIN_PARTS; trainPart++)
+	{
+		trainMasked[trainPart] = getTrainMasked(NULL);
+	}
+	/* Resets the train iterator back to the first part. */
+	getTrainMasked(NULL);
+
+	init_shift16(&cursorSprite, getMouseCursor(NULL), CURSOR_HEIGHT,
+				 SHIFT_XOR);
+}
 
-void renderButton(UINT32* const base, Button* button, BOOL blackScreen);
-void renderInfoBar(UINT16* const base, InfoBar* const infoBar, BOOL blackScrn);
+/**
+ * @brief Registers a sprite with the pre-shift cache for every Direction that
+ * the given bitmap getter has a bitmap for.
+ * @details Slots for directions without a bitmap are left with a NULL bitmap.
+ *
+ * @param sprites The slots to fill (see orientSlot()).
+ * @param getBitmap The function that returns the bitmap facing a Direction.
+ * @param height The height of every bitmap returned by getBitmap.
+ * @param op The operation to use when plotting the sprites.
+ */
+void initOrientSprites(ShiftSpr32 sprites[],
+					   const UINT32* (*getBitmap)(Direction, UINT32*),
+					   int height, ShiftOp op)
+{
+	Direction orientation;
+
+	for (orientation = M_SOUTH; orientation <= M_NORTH; orientation++)
+	{
+		init_shift32(&sprites[orientSlot(orientation)],
+					 getBitmap(orientation, NULL), height, op);
+	}
+}
+
+/**
+ * @brief Looks up the masked bitmap facing every Direction that the given
+ * getter has a masked bitmap for.
+ * @details Slots for directions without a masked bitmap are left NULL.
+ *
+ * @param masked The slots to fill (see orientSlot()).
+ * @param getMasked The function that returns the masked bitmap facing a
+ * Direction.
+ */
+void initOrientMasked(const UINT32* masked[],
+					  const UINT32* (*getMasked)(Direction, UINT32*))
+{
+	Direction orientation;
+
+	for (orientation = M_SOUTH; orientation <= M_NORTH; orientation++)
+	{
+		masked[orientSlot(orientation)] = getMasked(orientation, NULL);
+	}
+}
 
 void renderUpdate(UINT32* const base, const World* const world)
 {
 	int index;
+
+	init_draw_list(&drawList, base);
+
+	for(index = world->bottom; index != world->top;
+		 index = (index + 1) % world->usableRows)
+	{
+		queueHazards(&drawList, &world->rows[index]);
+	}
+	queueHazards(&drawList, &world->rows[world->top]);
+
+	/* The hazards have to be drawn before the player, who may overlap them. */
+	draw_list(&drawList);
+	renderMainPlayer(base, &world->mainPlayer);
+}
+
+BOOL saveUpdate(SaveList* const saves, const World* const world)
+{
+	int index;
+
+	for(index = world->bottom; index != world->top;
+		 index = (index + 1) % world->usableRows)
+	{
+		saveRowHazards(saves, &world->rows[index]);
+	}
+	saveRowHazards(saves, &world->rows[world->top]);
+
+	save_area(saves, world->mainPlayer.x, PLAYER_LEN, world->mainPlayer.y,
+			  PLAYER_HEIGHT);
+
+	return saves->complete;
+}
+
+/**
+ * @brief Saves the background under all the hazards for a given row.
+ * @details Every hazard is saved at its full size, even where queueHazards()
+ * would not plot all of it.
+ * 
+ * @param saves The SaveList to save the backgrounds on.
+ * @param row The row that the hazards belong to.
+ */
+void saveRowHazards(SaveList* const saves, const Row* const row)
+{
+	const Hazard* hazard;
+
+	int index;
+
+	for (index = 0; index < row->hazardCount; index++)
+	{
+		hazard = &row->hazards[index];
+		switch(hazard->hazardType)
+		{
+			case CAR_HAZ:
+				save_area(saves, hazard->x, CAR_LEN, row->y, CAR_HEIGHT);
+				break;
+			case FEATHERS_HAZ:
+				save_area(saves, hazard->x, FEATHERS_LEN, row->y,
+						  FEATHERS_HEIGHT);
+				break;
+			case TRAIN_HAZ:
+				save_area(saves, hazard->x, NUM_TRAIN_PARTS * TRAIN_PART_LEN,
+						  row->y, TRAIN_HEIGHT);
+				break;
+			case NO_HAZ:
+				break;
+		}
+	}
+}
+
+void renderBandedUpdate(UINT32* const base, const Surface* const surface,
+						const World* const world)
+{
+	const int TOP_ROW = getTopBorderHeight(world->numPlayers);
+
+	int index;
+
+	init_draw_list(&drawList, base);
+
 	for(index = world->bottom; index != world->top;
 		 index = (index + 1) % world->usableRows)
 	{
-		renderHazards(base, &world->rows[index]);
+		renderBandedRow(base, surface, &world->rows[index], TOP_ROW);
+	}
+	renderBandedRow(base, surface, &world->rows[world->top], TOP_ROW);
+
+	/* The hazards have to be drawn before the player, who may overlap them. */
+	draw_list(&drawList);
+	renderMainPlayer(base, &world->mainPlayer);
+}
+
+BOOL hazardsCrossEdge(const Row* const row)
+{
+	const Hazard* hazard;
+
+	int index;
+	int length;
+
+	for (index = 0; index < row->hazardCount; index++)
+	{
+		hazard = &row->hazards[index];
+		switch(hazard->hazardType)
+		{
+			case CAR_HAZ:
+				length = CAR_LEN;
+				break;
+			case FEATHERS_HAZ:
+				length = FEATHERS_LEN;
+				break;
+			case TRAIN_HAZ:
+			case NO_HAZ:
+			default:
+				length = 0;
+				break;
+		}
+
+		if (length > 0 && (hazard->x < 0 || hazard->x + length > SCRN_LEN))
+		{
+			return TRUE;
+		}
+	}
+
+	return FALSE;
+}
+
+/**
+ * @brief Renders the hazards of a single row, on a guard-banded surface if
+ * any of them cross the edge of the screen and straight onto the frame buffer
+ * (through the DrawList) otherwise.
+ * @details The rows of the play area that the row covers are loaded from the
+ * frame buffer, so the surface needs nothing on it beforehand.
+ * 
+ * @param base The location in memory to plot at.
+ * @param surface A Surface set up with init_guard_surface().
+ * @param row The row whose hazards are to be rendered.
+ * @param topRow The top-most row of the play area.
+ */
+void renderBandedRow(UINT32* const base, const Surface* const surface,
+					 const Row* const row, int topRow)
+{
+	const int FIRST_ROW = (row->y < topRow ? topRow : row->y);
+	const int LAST_ROW  = (row->y + ROW_HEIGHT > BOTTOM_BORDER ?
+						   BOTTOM_BORDER - 1 : row->y + ROW_HEIGHT - 1);
+
+	if (!hazardsCrossEdge(row))
+	{
+		queueHazards(&drawList, row);
+	}
+	else if (FIRST_ROW <= LAST_ROW)
+	{
+		load_surface(surface, base, FIRST_ROW, LAST_ROW);
+		renderSurfRowHazards(surface, row);
+		present_surface(surface, base, FIRST_ROW, LAST_ROW);
+	}
+}
+
+/**
+ * @brief Renders all the hazards for a given row on a Surface.
+ * @details Matches queueHazards(), but plots each hazard straight away.
+ * 
+ * @param surface The Surface to plot on.
+ * @param row The row that the hazards belong to.
+ */
+void renderSurfRowHazards(const Surface* const surface, const Row* const row)
+{
+	const Hazard* hazard;
+	const UINT32* bitmap;
+
+	int index;
+	int trainPart;
+	int x;
+
+	for (index = 0; index < row->hazardCount; index++)
+	{
+		hazard = &row->hazards[index];
+		switch(hazard->hazardType)
+		{
+			case CAR_HAZ:
+				bitmap = carMasked[orientSlot(hazard->orientation)];
+				if (bitmap != NULL)
+				{
+					surf_plot_masked32(surface, hazard->x, row->y, CAR_HEIGHT,
+									   bitmap);
+				}
+				break;
+			case FEATHERS_HAZ:
+				bitmap =
+					feathersSprites[orientSlot(hazard->orientation)].bitmap;
+				if (bitmap != NULL)
+				{
+					surf_plot_rast32(surface, hazard->x, row->y,
+									 FEATHERS_HEIGHT, bitmap, RAST_OR);
+				}
+				break;
+			case TRAIN_HAZ:
+				for (trainPart = 0, x = hazard->x; trainPart < NUM_TRAIN_PARTS;
+					 x += CELL_LEN, trainPart++)
+				{
+					if (x <= MAX_CELL_X && x >= MIN_CELL_X)
+					{
+						surf_plot_masked32(surface, x, row->y, TRAIN_HEIGHT,
+										   trainMasked[trainPart]);
+					}
+				}
+				break;
+			case NO_HAZ:
+				break;
+		}
 	}
-	renderHazards(base, &world->rows[world->top]);
-	renderPlayers(base, world);
 }
 
-void renderPlayArea(UINT32* const base, const World* const world)
+void renderPlayArea(UINT32* const base, World* const world)
 {
 	Label youLabel;
 	Label otherLabel;
@@ -47,6 +387,7 @@ void renderPlayArea(UINT32* const base, const World* const world)
 	fill_scrn(base);
 	renderWorld(base, world);
 	renderUpdate(base, world);
+	renderStats(base, world);
 
 	if (world->numPlayers == 2)
 	{
@@ -58,78 +399,267 @@ void renderPlayArea(UINT32* const base, const World* const world)
 }
 
 void renderWorld(UINT32* const base, const World* const world)
+{
+	renderWorldRows(base, world, 0, world->usableRows);
+}
+
+int renderWorldRows(UINT32* const base, const World* const world, int first,
+					int count)
+{
+	const int NUM_ROWS = (world->top - world->bottom + world->usableRows) %
+						 world->usableRows + 1;
+
+	int row;
+
+	if (first == 0 && count > 0)
+	{
+		fill_scrn(base);
+	}
+
+	for (row = first; row < NUM_ROWS && row < first + count; row++)
+	{
+		pasteRowStrip(base, world, (world->bottom + row) % world->usableRows);
+	}
+
+	return (row < NUM_ROWS ? row : world->usableRows);
+}
+
+void renderUpdateWorld(UINT32* const base, const World* const world)
 {
 	int index;
+	int shifts;
 
-	fill_scrn(base);
+	if (worldRedrawNeeded(world))
+	{
+		renderWorld(base, world);
+	}
+	else
+	{
+		if (world->pendingShifts > 0)
+		{
+			scroll_down(base, getTopBorderHeight(world->numPlayers),
+						BOTTOM_BORDER - 1, world->pendingShifts * ROW_HEIGHT);
+
+			/* The newest rows are the ones just below the top in the world. */
+			for (index = world->top, shifts = world->pendingShifts;
+				 shifts > 0;
+				 index = (index + world->usableRows - 1) % world->usableRows,
+				 shifts--)
+			{
+				pasteRowStrip(base, world, index);
+			}
+		}
 
-	for (index = world->bottom;
-		 index != world->top;
-		 index = (index + 1) % world->usableRows)
+		/* Rows keep their index when the world shifts, so the stale cells are
+		   found wherever their rows have scrolled to. */
+		for (index = 0; index < world->numStaleCells; index++)
+		{
+			pasteStripCell(base, world, &world->staleCells[index]);
+		}
+	}
+}
+
+/**
+ * @brief Copies a single cell from the strip of its row onto the screen, after
+ * bringing the strip up to date with the row.
+ * 
+ * @param base The location in memory to copy to.
+ * @param world The game world that the cell belongs to.
+ * @param cell The cell to copy.
+ */
+void pasteStripCell(UINT32* const base, const World* const world,
+					const CellRef* const cell)
+{
+	const Row* const row    = &world->rows[cell->row];
+	const int        OFFSET = row->cells[cell->column].x >> DIV_SHIFT_BY_8;
+
+	UINT8* dest;
+	UINT8* src;
+	int    line;
+
+	updateRowStrip(&rowStrips[cell->row], row);
+
+	dest = (UINT8 *)(base + row->y * SCRN_LEN_LONG) + OFFSET;
+	src  = (UINT8 *)rowStrips[cell->row].longs + OFFSET;
+
+	for (line = 0; line < CELL_HEIGHT; line++)
+	{
+		memcpy(dest, src, CELL_LEN >> DIV_SHIFT_BY_8);
+		dest += SCRN_LEN_BYTES;
+		src  += SCRN_LEN_BYTES;
+	}
+}
+
+/**
+ * @brief Copies the strip of a row of the world onto the screen where the row
+ * is, after bringing the strip up to date with the row.
+ * 
+ * @param base The location in memory to copy to.
+ * @param world The game world that the row belongs to.
+ * @param index The index of the row in the world.
+ */
+void pasteRowStrip(UINT32* const base, const World* const world, int index)
+{
+	const Row* const row = &world->rows[index];
+
+	updateRowStrip(&rowStrips[index], row);
+	memcpy(base + row->y * SCRN_LEN_LONG, rowStrips[index].longs,
+		   ROW_STRIP_BYTES);
+}
+
+/**
+ * @brief Renders the cells of a row that do not match its strip onto the
+ * strip.
+ * @details A strip that has never been built is filled first and has every
+ * cell rendered onto it. Since a new row rarely matches the row that used to
+ * be held in the same place, the whole strip is usually rendered again after
+ * a row is created, but a collectable being picked up only renders its cell.
+ * 
+ * @param strip The RowStrip to bring up to date.
+ * @param row The row that the strip is to hold.
+ */
+void updateRowStrip(RowStrip* const strip, const Row* const row)
+{
+	const BOOL BUILD = !strip->built;
+
+	int index;
+
+	if (BUILD)
+	{
+		memset(strip->longs, 0xFF, ROW_STRIP_BYTES);
+		strip->built = TRUE;
+	}
+
+	init_draw_list(&drawList, strip->longs);
+
+	for (index = 0; index < MAX_CELLS; index++)
 	{
-		renderRow(base, &world->rows[index]);
+		if (BUILD ||
+			strip->cellTypes[index] != row->cells[index].cellType ||
+			strip->collectables[index] != row->cells[index].collectableValue)
+		{
+			queueCell(&drawList, &row->cells[index], 0);
+			strip->cellTypes[index]    = row->cells[index].cellType;
+			strip->collectables[index] = row->cells[index].collectableValue;
+		}
 	}
-	renderRow(base, &world->rows[world->top]);
+
+	draw_list(&drawList);
 }
 
 void renderRow(UINT32* const base, const Row* const row)
+{
+	init_draw_list(&drawList, base);
+	queueRow(&drawList, row);
+	draw_list(&drawList);
+}
+
+/**
+ * @brief Queues every cell of a row on a DrawList.
+ * 
+ * @param list The DrawList to queue the cells on.
+ * @param row The row that is to be rendered to the screen.
+ */
+void queueRow(DrawList* const list, const Row* const row)
 {
 	int index;
 
 	for (index = 0; index < MAX_CELLS; index++)
 	{
-		renderCell(base, &row->cells[index], row->y);
+		queueCell(list, &row->cells[index], row->y);
 	}
 }
 
 void renderCell(UINT32* const base, const Cell* const cell, int y)
 {
-	UINT32 cellBitmap[CELL_HEIGHT];
-	UINT32 collectableBitmap[COLLECTABLE_HEIGHT];
+	init_draw_list(&drawList, base);
+	queueCell(&drawList, cell, y);
+	draw_list(&drawList);
+}
+
+/**
+ * @brief Queues a cell and its collectable (if it has one) on a DrawList.
+ * @details The compiled sprite of the cell is used wherever it can be.
+ * 
+ * @param list The DrawList to queue the cell on.
+ * @param cell The cell that is to be rendered to the screen.
+ * @param y The y pixel position of the row on screen.
+ */
+void queueCell(DrawList* const list, const Cell* const cell, int y)
+{
+	const UINT32* cellBitmap;
 
 	switch(cell->cellType)
 	{
 		case GRASS_CELL:
-			getGrassBitmap(cellBitmap);
+			cellBitmap = getGrassBitmap(NULL);
 			break;
 		case HEDGE_CELL:
-			getHedgeBitmap(cellBitmap);
+			cellBitmap = getHedgeBitmap(NULL);
 			break;
 		case ROAD_CELL:
-			getRoadBitmap(cellBitmap);
+			cellBitmap = getRoadBitmap(NULL);
 			break;
 		case SPIKE_CELL:
-			getSpikeBitmap(cellBitmap);
+			cellBitmap = getSpikeBitmap(NULL);
 			break;
 		case TRACK_CELL:
-			getTrackBitmap(cellBitmap);
+			cellBitmap = getTrackBitmap(NULL);
 			break;
 		default:
-			memset(cellBitmap, 0, UINT32_BYTES * CELL_HEIGHT);
+			cellBitmap = blankCell;
 	}
 
-	plot_rast32(base, cell->x, y, CELL_HEIGHT, cellBitmap, TRUE, FALSE);
-	
+	if (cellBitmap != blankCell)
+	{
+		add_fixed_draw(list, cellCsprs[cell->cellType], cellBitmap, cell->x, y,
+					   CELL_HEIGHT, DRAW_COPY32);
+	}
+	else
+	{
+		add_draw(list, cellBitmap, cell->x, y, CELL_HEIGHT, DRAW_COPY32);
+	}
+
+	/* The collectable starts at the same address as the cell, so it is always
+	   drawn after it. */
 	switch(cell->collectableValue)
 	{
 		case A_COLLECT_VAL:
-			getACollectBitmap(collectableBitmap);
+			add_draw(list, getACollectBitmap(NULL), cell->x, y,
+					 COLLECTABLE_HEIGHT, DRAW_OR32);
 			break;
 		case B_COLLECT_VAL:
-			getBCollectBitmap(collectableBitmap);
+			add_draw(list, getBCollectBitmap(NULL), cell->x, y,
+					 COLLECTABLE_HEIGHT, DRAW_OR32);
 			break;
 		case C_COLLECT_VAL:
-			getCCollectBitmap(collectableBitmap);
+			add_draw(list, getCCollectBitmap(NULL), cell->x, y,
+					 COLLECTABLE_HEIGHT, DRAW_OR32);
+			break;
+		case NO_COLLECT:
 			break;
-		default:
-			memset(collectableBitmap, 0, UINT32_BYTES * COLLECTABLE_HEIGHT);
 	}
-
-	plot_rast32(base, cell->x, y, COLLECTABLE_HEIGHT, collectableBitmap,
-				FALSE, FALSE);
 }
 
 void renderHazards(UINT32* const base, const Row* const row)
+{
+	init_draw_list(&drawList, base);
+	queueHazards(&drawList, row);
+	draw_list(&drawList);
+}
+
+/**
+ * @brief Queues all the hazards for a given row on a DrawList.
+ * @details Mr. Feathers is plotted straight away using the pre-shift cache
+ * rather than queued, which is only safe because nothing on the list can
+ * overlap him. He is only ever placed on grass rows, which never hold a car or
+ * a train, and the hazards of a row never reach into the rows around it.
+ * 
+ * @param list The DrawList to queue the hazards on.
+ * @param row The row that the hazards belong to that is to be rendered to the
+ * screen.
+ */
+void queueHazards(DrawList* const list, const Row* const row)
 {
 	const Hazard* hazard;
 
@@ -141,13 +671,14 @@ void renderHazards(UINT32* const base, const Row* const row)
 		switch(hazard->hazardType)
 		{
 			case CAR_HAZ:
-				renderCar(base, hazard->x, row->y, hazard->orientation);
+				queueCar(list, hazard->x, row->y, hazard->orientation);
 				break;
 			case FEATHERS_HAZ:
-				renderFeathers(base, hazard->x, row->y, hazard->orientation);
+				renderFeathers(list->base, hazard->x, row->y,
+							   hazard->orientation);
 				break;
 			case TRAIN_HAZ:
-				renderTrain(base, hazard->x, row->y);
+				queueTrain(list, hazard->x, row->y);
 				break;
 			case NO_HAZ:
 				break;
@@ -156,23 +687,22 @@ void renderHazards(UINT32* const base, const Row* const row)
 }
 
 /**
- * @brief Renders a car at the given x and y position in the area of memory
- * pointed to by base.
- * @details Nothing will be rendered if the orientation is not horizontal.
+ * @brief Queues a car at the given x and y position on a DrawList.
+ * @details Nothing will be queued if the orientation is not horizontal.
  * 
- * @param base The location in memory to plot at.
+ * @param list The DrawList to queue the car on.
  * @param x The x pixel location (starting at zero) to start rendering the car.
  * @param y The y pixel location (starting at zero) to start rendering the car.
  * @param orientation The horizontal orientation of the car.
  */
-void renderCar(UINT32* const base, int x, int y, Direction orientation)
+void queueCar(DrawList* const list, int x, int y, Direction orientation)
 {
-	UINT32 carBitmap[CAR_HEIGHT];
+	const UINT32* const car = carMasked[orientSlot(orientation)];
 
-	if (getCarBitmap(orientation, carBitmap) != NULL)
+	if (car != NULL)
 	{
-		clr_area(base, x, CAR_LEN, y + CAR_Y_OFFSET, CAR_SMALLEST_HEIGHT);
-		plot_rast32(base, x, y, CAR_HEIGHT, carBitmap, FALSE, FALSE);
+		add_fixed_draw(list, carCsprs[orientSlot(orientation)], car, x, y,
+					   CAR_HEIGHT, DRAW_MASKED32);
 	}
 }
 
@@ -190,60 +720,41 @@ void renderCar(UINT32* const base, int x, int y, Direction orientation)
  */
 void renderFeathers(UINT32* const base, int x, int y, Direction orientation)
 {
-	UINT32 feathersBitmap[FEATHERS_HEIGHT];
+	ShiftSpr32* const feathersSprite =
+								&feathersSprites[orientSlot(orientation)];
 
-	if (getFeathersBitmap(orientation, feathersBitmap) != NULL)
+	if (feathersSprite->bitmap != NULL)
 	{
-		plot_rast32(base, x, y, FEATHERS_HEIGHT, feathersBitmap, FALSE, FALSE);
+		plot_shift32(base, x, y, feathersSprite);
 	}
 }
 
 /**
- * @brief Renders a train at the given x and y position in the area of memory
- * pointed to by base.
+ * @brief Queues a train at the given x and y position on a DrawList.
  * 
- * @param base The location in memory to plot at.
+ * @param list The DrawList to queue the train on.
  * @param x The x pixel location (starting at zero) to start rendering the
  * train.
  * @param y The y pixel location (starting at zero) to start rendering the
  * train.
  */
-void renderTrain(UINT32* const base, int x, int y)
+void queueTrain(DrawList* const list, int x, int y)
 {
-	const int CLR_Y_POS = y + TRAIN_Y_OFFSET;
+	int trainPart;
 
-	UINT32 trainBitmap[TRAIN_HEIGHT];
-	int    trainPart;
-
-	for(trainPart = 1; getTrainBitmap(trainBitmap) != NULL;
+	for(trainPart = 0; trainPart < NUM_TRAIN_PARTS;
 		x += CELL_LEN, trainPart++)
 	{
 		if (x <= MAX_CELL_X && x >= MIN_CELL_X)
 		{
-			switch(trainPart)
-			{
-				case 1:
-					clr_area(base, x + TRAIN_X_OFFSET, TRAIN_FIRST_PART_LEN,
-							 CLR_Y_POS, TRAIN_SMALLEST_HEIGHT);
-					break;
-				case NUM_TRAIN_PARTS:
-					clr_area(base, x, TRAIN_LAST_PART_LEN, CLR_Y_POS,
-							 TRAIN_SMALLEST_HEIGHT);
-					break;
-				default:
-					clr_area(base, x, CELL_LEN, CLR_Y_POS,
-							 TRAIN_SMALLEST_HEIGHT);
-					break;
-			}
-
-			plot_rast32(base, x, y, TRAIN_HEIGHT, trainBitmap, FALSE, FALSE);
+			add_fixed_draw(list, trainCsprs[trainPart], trainMasked[trainPart],
+						   x, y, TRAIN_HEIGHT, DRAW_MASKED32);
 		}
 	}
 }
 
-void renderPlayers(UINT32* const base, const World* const world)
+void renderStats(UINT32* const base, World* const world)
 {
-	renderMainPlayer(base, &world->mainPlayer);
 	renderScore((UINT16 *)base, &world->mainPlayer.score);
 	renderLives((UINT16 *)base, &world->mainPlayer.lives);
 
@@ -256,25 +767,33 @@ void renderPlayers(UINT32* const base, const World* const world)
 
 void renderMainPlayer(UINT32* const base, const Player* const player)
 {
-	UINT32 playerAlpha[PLAYER_HEIGHT];
-	UINT32 playerBitmap[PLAYER_HEIGHT];
+	const UINT32* const masked = playerMasked[orientSlot(player->orientation)];
 
-	if (getPlayerAlpha(player->orientation, playerAlpha) == NULL ||
-		getPlayerBitmap(player->orientation, playerBitmap) == NULL)
+	if (masked != NULL)
 	{
-		memset(playerAlpha, 0, UINT32_BYTES * PLAYER_HEIGHT);
-		memset(playerBitmap, 0, UINT32_BYTES * PLAYER_HEIGHT);
+		plot_masked32(base, player->x, player->y, PLAYER_HEIGHT, masked);
 	}
-
-	plot_alpha(base, player->x, player->y, PLAYER_HEIGHT, playerAlpha);
-	plot_rast32(base, player->x, player->y, PLAYER_HEIGHT, playerBitmap, FALSE,
-				FALSE);
 }
 
 void renderLabel(UINT16* const base, const Label* const label,
 				 BOOL blackScreen)
 {
-	const UINT16* currFont16Char;
+	init_draw_list(&drawList, (UINT32 *)base);
+	queueLabel(&drawList, label, blackScreen);
+	draw_list(&drawList);
+}
+
+/**
+ * @brief Queues every character of a label on a DrawList.
+ * 
+ * @param list The DrawList to queue the label on.
+ * @param label The label that is to be rendered to the screen.
+ * @param blackScreen Set to true if text is being rendered on black background.
+ */
+void queueLabel(DrawList* const list, const Label* const label,
+				BOOL blackScreen)
+{
+	const DrawMode mode = drawMode16(rastMode(TRUE, blackScreen));
 
 	int index;
 	int x;
@@ -282,49 +801,45 @@ void renderLabel(UINT16* const base, const Label* const label,
 	for (index = 0, x = 0; label->text[index] != '\0'; 
 		 index++, x += LABEL_FONT_WIDTH)
 	{
-		currFont16Char = getFont16Char(label->text[index], NULL);
-		plot_rast16(base, label->x + x, label->y, LABEL_FONT_HEIGHT,
-					currFont16Char, TRUE, blackScreen);
+		add_draw(list, getFont16Char(label->text[index], NULL), label->x + x,
+				 label->y, LABEL_FONT_HEIGHT, mode);
 	}
 }
 
 /**
  * @brief Renders a InfoBar to the screen.
- * @details Every character stored in the infoBar are rendered as 16x16
- * character sprites. Each string stored within the object is horizontally
+ * @details The background of the InfoBar is cleared straight away, while every
+ * character stored in the infoBar is queued on the DrawList as a 16x16
+ * character sprite. Each string stored within the object is horizontally
  * centered on the screen at the object's provided y pixel position.
  * 
- * @param base The location in memory to plot at.
+ * @param list The DrawList to queue the characters on.
  * @param infoBar The infoBar that is to be rendered to the screen.
  * @param blackScrn Indicates whether the InfoBar will be rendered on a black
  * or white area.
  */
-void renderInfoBar(UINT16* const base, InfoBar* const infoBar, BOOL blackScrn)
+void queueInfoBar(DrawList* const list, InfoBar* const infoBar,
+				  BOOL blackScrn)
 {
 	const int INFO_BAR_LINES = infoBar->numLabels *
 							   (FONT16_HEIGHT + infoBar->spacingBetweenLabels) -
 							   infoBar->spacingBetweenLabels;
-	int counter;
 	int index;
 
 	if (infoBar->needsUpdate)
 	{
 		if (blackScrn)
 		{
-			for (counter = infoBar->y; counter < infoBar->y + INFO_BAR_LINES;
-				counter++)
-			{
-				hline((UINT32 *)base, 0, SCRN_MAX_X, counter);
-			}
+			rect_area(list->base, 0, SCRN_LEN, infoBar->y, INFO_BAR_LINES);
 		}
 		else
 		{
-			clr_area((UINT32 *)base, 0, SCRN_LEN, infoBar->y, INFO_BAR_LINES);
+			clr_area(list->base, 0, SCRN_LEN, infoBar->y, INFO_BAR_LINES);
 		}
 
 		for (index = 0; index < infoBar->numLabels; index++)
 		{
-			renderLabel(base, &infoBar->labels[index], blackScrn);
+			queueLabel(list, &infoBar->labels[index], blackScrn);
 		}
 
 		infoBar->needsUpdate = FALSE;
@@ -333,9 +848,7 @@ void renderInfoBar(UINT16* const base, InfoBar* const infoBar, BOOL blackScrn)
 
 void renderScore(UINT16* const base, Score* const score)
 {
-	UINT32 value = score->value;
-	int index = MAX_NUM_DIGITS_IN_SCORE - 1;
-	int digits[MAX_NUM_DIGITS_IN_SCORE];
+	int place;
 	int x;
 
 	if (!score->labelRendered)
@@ -344,17 +857,13 @@ void renderScore(UINT16* const base, Score* const score)
 		score->labelRendered = TRUE;
 	}
 
-	do
-	{
-		digits[index--] = value % 10ul;
-		value /= 10;
-	} while (value != 0);
-
-	for(x = 0, index += 1; index < MAX_NUM_DIGITS_IN_SCORE;
-		index++, x += LABEL_FONT_WIDTH)
+	/* The digits are read straight from the BCD form of the score, skipping
+	   its leading zeros. */
+	for(x = 0, place = firstScoreDigit(score); place < SCORE_DIGITS;
+		place++, x += LABEL_FONT_WIDTH)
 	{
-		plot_rast16(base, score->x + x, score->y, LABEL_FONT_HEIGHT,
-					getFont16Digit(digits[index], NULL), TRUE, TRUE);
+		plot_inv16(base, score->x + x, score->y, LABEL_FONT_HEIGHT,
+				   getFont16Digit(scoreDigit(score, place), NULL));
 	}
 }
 
@@ -365,19 +874,21 @@ void renderLives(UINT16* const base, Lives* const lives)
 		renderLabel((UINT16 *)base, &lives->label, TRUE);
 		lives->labelRendered = TRUE;
 	}
-	plot_rast16(base, lives->x, lives->y, LABEL_FONT_HEIGHT,
-				getFont16Digit(lives->value, NULL), TRUE, TRUE);
+	plot_inv16(base, lives->x, lives->y, LABEL_FONT_HEIGHT,
+			   getFont16Digit(lives->value, NULL));
 }
 
 /**
  * @brief Renders a button to the screen.
+ * @details The button itself is drawn straight away, while its label is queued
+ * on the DrawList.
  * 
- * @param base The location in memory to plot at.
+ * @param list The DrawList to queue the label on.
  * @param button The Button that is to be rendered to the screen.
  * @param blackScreen When set to true indicates that button is being rendered 
  * on top of a black background.
  */
-void renderButton(UINT32* const base, Button* button, BOOL blackScreen)
+void queueButton(DrawList* const list, Button* button, BOOL blackScreen)
 {
 	const int BORDER_WIDTH  = 3;
 	const int BORDER_HEIGHT = 3;
@@ -386,72 +897,71 @@ void renderButton(UINT32* const base, Button* button, BOOL blackScreen)
 	{
 		if (button->selected == TRUE)
 		{
-			clr_area(base, button->x, button->width, button->y, button->height);
-			rect_area(base, button->x + BORDER_WIDTH,
+			clr_area(list->base, button->x, button->width, button->y,
+					 button->height);
+			rect_area(list->base, button->x + BORDER_WIDTH,
 					  button->width - (BORDER_WIDTH * 2),
 					  button->y + BORDER_HEIGHT,
 					  button->height - (BORDER_HEIGHT * 2));
-			renderLabel((UINT16 *)base, &button->label, blackScreen);
+			queueLabel(list, &button->label, blackScreen);
 		}
 		else
 		{
-			clr_area(base, button->x, button->width, button->y, button->height);
-			renderLabel((UINT16 *)base, &button->label, !blackScreen);
+			clr_area(list->base, button->x, button->width, button->y,
+					 button->height);
+			queueLabel(list, &button->label, !blackScreen);
 		}
 	}
 	else
 	{
 		if (button->selected == TRUE)
 		{
-			rect_area(base, button->x, button->width, button->y, button->height);
-			clr_area(base, button->x + BORDER_WIDTH,
+			rect_area(list->base, button->x, button->width, button->y,
+					  button->height);
+			clr_area(list->base, button->x + BORDER_WIDTH,
 					 button->width - (BORDER_WIDTH * 2),
 					 button->y + BORDER_HEIGHT,
 					 button->height - (BORDER_HEIGHT * 2));
-			renderLabel((UINT16 *)base, &button->label, blackScreen);
+			queueLabel(list, &button->label, blackScreen);
 		}
 		else
 		{
-			rect_area(base, button->x, button->width, button->y, button->height);	
-			renderLabel((UINT16 *)base, &button->label, !blackScreen);
+			rect_area(list->base, button->x, button->width, button->y,
+					  button->height);
+			queueLabel(list, &button->label, !blackScreen);
 		}
 	}
 }
 
 void renderTitle(UINT32* const base, int x, int y)
 {
-	UINT32 titleBitmap[TITLE_HEIGHT];
+	Surface scrn;
 
-	for (; getTitleBitmap(titleBitmap) != NULL; x += TITLE_PART_LEN)
-	{
-		plot_rast32(base, x, y, TITLE_HEIGHT, titleBitmap, TRUE, FALSE);
-	}
+	initScrnSurface(&scrn, base);
+	surf_plot_rle(&scrn, x, y, TITLE_LEN, TITLE_HEIGHT, getTitleRle(),
+				  RAST_COPY);
 }
 
 void renderGameOver(UINT32* const base, int x, int y)
 {
-	UINT32 goverBitmap[GAME_OVER_HEIGHT];
+	Surface scrn;
 
-	for (; getGameOverBitmap(goverBitmap) != NULL; x += GAME_OVER_PART_LEN)
-	{
-		plot_rast32(base, x, y, GAME_OVER_HEIGHT, goverBitmap, FALSE, TRUE);
-	}
+	initScrnSurface(&scrn, base);
+	surf_plot_rle(&scrn, x, y, GAME_OVER_LEN, GAME_OVER_HEIGHT,
+				  getGameOverRle(), RAST_XOR);
 }
 
 void renderCursor(UINT16* const base, int x, int y)
 {
-	UINT16 mouseCursor[CURSOR_HEIGHT];
-
-	if (getMouseCursor(mouseCursor) != NULL)
-	{
-		plot_rast16(base, x, y, CURSOR_HEIGHT, mouseCursor, FALSE, TRUE);
-	}
+	plot_shift16(base, x, y, &cursorSprite);
 }
 
 void renderMenu(UINT32* const base, Menu* menu)
 {
 	int index;
 
+	init_draw_list(&drawList, base);
+
 	if (!menu->initialRender)
 	{
 		if (menu->blackScreen)
@@ -468,7 +978,7 @@ void renderMenu(UINT32* const base, Menu* menu)
 
 		for (index = 0; index < menu->buttonFillLevel; index++)
 		{
-			renderButton(base, &menu->buttons[index], menu->blackScreen);
+			queueButton(&drawList, &menu->buttons[index], menu->blackScreen);
 		}
 
 		menu->initialRender = TRUE;
@@ -481,13 +991,13 @@ void renderMenu(UINT32* const base, Menu* menu)
 		{
 			if (menu->buttonSel != NO_BTN_SEL)
 			{
-				renderButton(base, &menu->buttons[menu->buttonSel],
+				queueButton(&drawList, &menu->buttons[menu->buttonSel],
 						 	menu->blackScreen);
 			}
 
 			if (menu->oldButtonSel != NO_BTN_SEL)
 			{
-				renderButton(base, &menu->buttons[menu->oldButtonSel],
+				queueButton(&drawList, &menu->buttons[menu->oldButtonSel],
 						 	menu->blackScreen);
 			}
 		}
@@ -498,7 +1008,8 @@ void renderMenu(UINT32* const base, Menu* menu)
 		/* InfoBar should be distinct from rest of menu. Hence, why InfoBar will
 		   be rendered with a black background when the rest of the menu is white
 		   and vice-versa. */
-		renderInfoBar((UINT16 *)base, &menu->infoBars[index],
-					  !menu->blackScreen);
+		queueInfoBar(&drawList, &menu->infoBars[index], !menu->blackScreen);
 	}
+
+	draw_list(&drawList);
 }
\ No newline at end of file
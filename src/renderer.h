@@ -13,6 +13,8 @@
 #include "font16.h"
 #include "model.h"
 #include "move.h"
+#include "scrn.h"
+#include "surface.h"
 #include "types.h"
 
 /**
@@ -25,22 +27,70 @@
  */
 #define LABEL_FONT_HEIGHT FONT16_HEIGHT
 
+/**
+ * @brief The number of longs that a pre-rendered row of the world takes up.
+ * @details A row strip is as wide as the screen and one row high, so it holds
+ * ROW_HEIGHT lines of SCRN_LEN_LONG longs (2560 bytes).
+ */
+#define ROW_STRIP_LONGS (SCRN_LEN_LONG * ROW_HEIGHT)
+
+/**
+ * @brief The number of bytes that a pre-rendered row of the world takes up.
+ */
+#define ROW_STRIP_BYTES (SCRN_LEN_BYTES * ROW_HEIGHT)
+
+/**
+ * @brief A row of the world rendered ahead of time, so that it can be copied
+ * onto the screen instead of plotting each of its cells.
+ * @details The strip is keyed by the contents of the row it was rendered from.
+ * The type and collectable of every cell are kept alongside it, so that only
+ * the cells that no longer match need to be rendered again. Where the row is
+ * on screen is not part of the key, as it does not change what the strip
+ * holds.
+ */
+typedef struct
+{
+	UINT32     longs[ROW_STRIP_LONGS];
+	CellType   cellTypes[MAX_CELLS];
+	CollectVal collectables[MAX_CELLS];
+	BOOL       built;
+} RowStrip;
+
+/**
+ * @brief Prepares the sprites used by the renderer.
+ * @details Must be called once before anything else is rendered, as the
+ * sprites are registered with the pre-shift cache here (see preshift.h).
+ */
+void initRenderer(void);
+
+/**
+ * @brief Determines if every cell of the world has to be rendered again, as
+ * opposed to only the rows and cells that have changed.
+ */
+#define worldRedrawNeeded(world) \
+	((world)->renderCells || (world)->pendingShifts >= (world)->usableRows)
+
 /**
  * @brief Renders an updated version of the world cells.
  * @details When a world shift has occurred this is to be called to draw the 
- * updated cell positions and newly generated cells at the top row.
- * @note This is a wrapper function that solely calls renderWorld().
+ * updated cell positions and newly generated cells at the top row. If the
+ * world has only shifted since the cells were last rendered, the cells already
+ * at base are scrolled down by a row for every shift (see scroll_down()) and
+ * only the new rows at the top are rendered. Cells marked with
+ * invalidateCell() are then copied from their row strips one at a time. If
+ * every cell is to be rendered again, it falls back to renderWorld().
  * 
- * @param base The location in memory to plot at.
+ * @param base The location in memory to plot at. Must hold the cells as they
+ * were last rendered.
  * @param world The game world that is to be updated on the screen.
  */
-#define renderUpdateWorld(base, world) renderWorld(base, world)
+void renderUpdateWorld(UINT32* const base, const World* const world);
 
 /**
  * @brief Renders an updated version of all the inhabitants in the world.
- * @details Is to be called when any score or lives have been updated, any 
- * hazards have moved, or if the player has moved. Any objects owned by
- * inhabitants, such as player lives and score boxes, will also be rendered.
+ * @details Is to be called when any hazards have moved, or if the player has
+ * moved. The scores and lives of the players are not rendered (see
+ * renderStats() and renderHud()).
  * 
  * @param base The location in memory to plot at.
  * @param world The game world that is to have all of its inhabitants updated on
@@ -48,6 +98,51 @@
  */
 void renderUpdate(UINT32* const base, const World* const world);
 
+/**
+ * @brief Saves the background under every inhabitant of the world that
+ * renderUpdate() is about to plot over.
+ * @details Is to be called just before renderUpdate() on the same frame
+ * buffer, so that the inhabitants can be erased on the next update with
+ * restore_saves() instead of redrawing the play area from scratch. The scores
+ * and lives are not saved, as they always redraw their own background.
+ * 
+ * @param saves The SaveList of the frame buffer that is to be plotted to.
+ * @param world The game world whose inhabitants are about to be rendered.
+ * @return TRUE if every background was saved; FALSE if the SaveList ran out of
+ * room.
+ */
+BOOL saveUpdate(SaveList* const saves, const World* const world);
+
+/**
+ * @brief Renders an updated version of all the inhabitants in the world,
+ * composing the rows whose hazards cross the edge of the screen on a
+ * guard-banded surface.
+ * @details Behaves like renderUpdate(), except that each row with a hazard
+ * partly off the screen (see hazardsCrossEdge()) is loaded onto the surface,
+ * has its hazards plotted there without any clipping, and is presented back
+ * onto the frame buffer. Only those rows are copied, so the rest of the play
+ * area is left to the SaveList and the damage tracking as usual.
+ * 
+ * @param base The location in memory to plot at.
+ * @param surface A Surface set up with init_guard_surface().
+ * @param world The game world that is to have all of its inhabitants updated on
+ * the screen.
+ */
+void renderBandedUpdate(UINT32* const base, const Surface* const surface,
+						const World* const world);
+
+/**
+ * @brief Determines if any hazard of a row lies partly off the screen, and so
+ * would need to be clipped to be plotted on it.
+ * @details Trains are only ever plotted a whole part at a time, so they never
+ * need clipping.
+ * 
+ * @param row The row whose hazards are to be checked.
+ * @return TRUE if a car or Mr. Feathers crosses the edge of the screen; FALSE
+ * otherwise.
+ */
+BOOL hazardsCrossEdge(const Row* const row);
+
 /**
  * @brief Renders the initial frame of the entire game play area. 
  * @details This includes the world border. Both player scores and lives if in 
@@ -58,17 +153,36 @@ void renderUpdate(UINT32* const base, const World* const world);
  * @param base The location in memory to plot at.
  * @param world The game world that is to be rendered to the screen.
  */
-void renderPlayArea(UINT32* const base, const World* const world);
+void renderPlayArea(UINT32* const base, World* const world);
 
 /**
  * @brief Renders the world to the screen. 
- * @details The Game World constitutes all the cell-containing rows.
+ * @details The Game World constitutes all the cell-containing rows. Each row is
+ * copied from its row strip, which is brought up to date with the row first.
  * 
  * @param base The location in memory to plot at.
  * @param world The game world that is to be rendered to the screen.
  */
 void renderWorld(UINT32* const base, const World* const world);
 
+/**
+ * @brief Renders some of the rows of the world to the screen, so that
+ * rendering the whole world can be spread over several frames.
+ * @details Rows are counted from the bottom of the world up, in the same order
+ * that renderWorld() renders them in. The screen is filled first if the
+ * bottom row is among those to be rendered.
+ * 
+ * @param base The location in memory to plot at.
+ * @param world The game world that is to be rendered to the screen.
+ * @param first The first row to render, counting from the bottom of the world
+ * (starting at zero).
+ * @param count The most rows to render.
+ * @return The row after the last one rendered, counting from the bottom of the
+ * world. Equal to the number of usable rows once the top row is rendered.
+ */
+int renderWorldRows(UINT32* const base, const World* const world, int first,
+					int count);
+
 /**
  * @brief Renders a row to the screen.
  * @details Renders each cell of the row.
@@ -102,16 +216,18 @@ void renderCell(UINT32* const base, const Cell* const cell, int y);
 void renderHazards(UINT32* const base, const Row* const row);
 
 /**
- * @brief Renders main player, players scores and lives to the screen.
+ * @brief Renders players scores and lives to the screen.
  * @details If in two player mode renders both players score and lives otherwise
- * just main player score and lives will be rendered to the screen. Also renders
- * the main players to the screen.
+ * just main player score and lives will be rendered to the screen. Every digit
+ * is rendered, whether it has changed or not (see renderHud() for a version
+ * that only renders what has changed). The labels are only rendered the first
+ * time, after which they are marked as rendered.
  * 
  * @param base The location in memory to plot at.
- * @param world The world that is to have its player(s) sprite, score, and lives
- * to the screen.
+ * @param world The world that is to have its player(s) score and lives
+ * rendered to the screen.
  */
-void renderPlayers(UINT32* const base, const World* const world);
+void renderStats(UINT32* const base, World* const world);
 
 /**
  * @brief Renders the main players sprite to the screen.
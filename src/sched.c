@@ -0,0 +1,33 @@
+/**
+ * @file sched.c
+ * @author Academia Team
+ * @brief Contains functions to keep the work done between two vertical blanks
+ * within a budget.
+ *
+ * @copyright Copyright Academia Team 2023
+ */
+
+#include "bool.h"
+#include "sched.h"
+#include "types.h"
+
+void init_sched(FrameSched* const sched, UINT32 budget)
+{
+	sched->budget = budget;
+	sched->spent  = 0;
+}
+
+void begin_slice(FrameSched* const sched)
+{
+	sched->spent = 0;
+}
+
+BOOL fits_slice(const FrameSched* const sched, UINT32 cost)
+{
+	return (sched->spent == 0 || sched->spent + cost <= sched->budget);
+}
+
+void spend_slice(FrameSched* const sched, UINT32 cost)
+{
+	sched->spent += cost;
+}
\ No newline at end of file
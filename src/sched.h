@@ -0,0 +1,64 @@
+/**
+ * @file sched.h
+ * @author Academia Team
+ * @brief Keeps the work done between two vertical blanks within a budget.
+ * @details Work is split into jobs whose cost is estimated up front, in units
+ * of roughly the time taken to copy a byte. A slice of work begins after every
+ * vertical blank, and a job is only started in a slice if its cost fits in
+ * what is left of the budget. Jobs that do not fit wait for the next slice,
+ * except that the first job of a slice is always started so that work is never
+ * held up for good.
+ *
+ * @copyright Copyright Academia Team 2023
+ */
+
+#ifndef SCHED_H
+#define SCHED_H
+
+#include "bool.h"
+#include "types.h"
+
+/**
+ * @brief Keeps track of the budget of the current slice.
+ */
+typedef struct
+{
+	UINT32 budget;
+	UINT32 spent;
+} FrameSched;
+
+/**
+ * @brief Readies a FrameSched with no work spent.
+ *
+ * @param sched The FrameSched to initialize.
+ * @param budget The cost that may be spent in every slice.
+ */
+void init_sched(FrameSched* const sched, UINT32 budget);
+
+/**
+ * @brief Begins a new slice with the whole budget left to spend.
+ *
+ * @param sched The FrameSched to begin a slice of.
+ */
+void begin_slice(FrameSched* const sched);
+
+/**
+ * @brief Determines if a job can be started in the current slice.
+ *
+ * @param sched The FrameSched of the slice.
+ * @param cost The estimated cost of the job.
+ * @return TRUE if nothing has been spent in the slice yet or the cost fits in
+ * what is left of the budget; FALSE otherwise.
+ */
+BOOL fits_slice(const FrameSched* const sched, UINT32 cost);
+
+/**
+ * @brief Takes the cost of a job that has been done out of the budget of the
+ * current slice.
+ *
+ * @param sched The FrameSched of the slice.
+ * @param cost The estimated cost of the job.
+ */
+void spend_slice(FrameSched* const sched, UINT32 cost);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,593 @@
+/**
+ * @file spr_gen.c
+ * @author Academia Team
+ * @brief A build tool that turns the static tile and hazard bitmaps into
+ * compiled sprites.
+ * @details Every bitmap is turned into a straight-line routine that writes
+ * its rows to the screen as immediate values, so no bitmap is read and no loop
+ * is run when it is plotted. Sprites are either copied to the screen or built
+ * from a masked bitmap (see plot_masked32()), in which case rows that neither
+ * clear nor set anything are left out. Values that appear on several rows are
+ * loaded into a register once.
+ *
+ * Usage: spr_gen <output>
+ *
+ * If the name of the output file ends in ".c", portable C versions of the
+ * routines are written instead of 68000 assembly (see cspr.h).
+ *
+ * @copyright Copyright Academia Team 2023
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "bitmaps.h"
+#include "bool.h"
+#include "move.h"
+#include "raster.h"
+#include "scrn.h"
+#include "types.h"
+
+/**
+ * @brief The most data registers that a compiled sprite may load repeated
+ * values into.
+ */
+#define MAX_VAL_REGS 4
+
+/**
+ * @brief The most rows that a compiled sprite can have.
+ */
+#define MAX_SPR_HEIGHT 32
+
+/**
+ * @brief The column that instructions start at in the assembly output.
+ */
+#define INSTR_COL 20
+
+/**
+ * @brief The width of a tab in the assembly output.
+ */
+#define TAB_LEN 4
+
+/**
+ * @brief The most characters (including the null terminator) that an operand
+ * written by the generator can have.
+ */
+#define MAX_OPERAND_LEN 24
+
+/**
+ * @brief Describes a bitmap that is to be compiled.
+ * @details Exactly one of bitmap (which is copied to the screen) and masked
+ * (which is plotted like plot_masked32()) is set.
+ */
+typedef struct
+{
+	const char*   name;
+	const UINT32* bitmap;
+	const UINT32* masked;
+	int           height;
+} SprSpec;
+
+void writeAsmSprite(FILE* out, const SprSpec* const spec);
+void writeCSprite(FILE* out, const SprSpec* const spec);
+void writeAsmWord(FILE* out, UINT16 mask, UINT16 image, int offset);
+void writeCWord(FILE* out, UINT16 mask, UINT16 image, int offset);
+UINT32 rowMask(const SprSpec* const spec, int index);
+UINT32 rowImage(const SprSpec* const spec, int index);
+BOOL rowFillsLong(const SprSpec* const spec, int index);
+int  pickValRegs(const SprSpec* const spec, UINT32 vals[]);
+int  findValReg(const UINT32 vals[], int numVals, UINT32 value);
+void formatDest(char* operand, int offset);
+
+int main(int argc, char **argv)
+{
+	SprSpec specs[12];
+	FILE*   out;
+	BOOL    cOutput;
+	int     numSpecs = 0;
+	int     index;
+	int     nameLen;
+
+	if (argc != 2)
+	{
+		fprintf(stderr, "Usage: spr_gen <output>\n");
+		return 1;
+	}
+
+	nameLen = strlen(argv[1]);
+	cOutput = (nameLen > 2 && (strcmp(&argv[1][nameLen - 2], ".c") == 0 ||
+							   strcmp(&argv[1][nameLen - 2], ".C") == 0));
+
+	if ((out = fopen(argv[1], "w")) == NULL)
+	{
+		fprintf(stderr, "spr_gen: Unable to open %s\n", argv[1]);
+		return 1;
+	}
+
+	specs[numSpecs].name = "grass";
+	specs[numSpecs].bitmap = getGrassBitmap(NULL);
+	specs[numSpecs].masked = NULL;
+	specs[numSpecs++].height = GRASS_CELL_HEIGHT;
+
+	specs[numSpecs].name = "hedge";
+	specs[numSpecs].bitmap = getHedgeBitmap(NULL);
+	specs[numSpecs].masked = NULL;
+	specs[numSpecs++].height = HEDGE_CELL_HEIGHT;
+
+	specs[numSpecs].name = "road";
+	specs[numSpecs].bitmap = getRoadBitmap(NULL);
+	specs[numSpecs].masked = NULL;
+	specs[numSpecs++].height = ROAD_CELL_HEIGHT;
+
+	specs[numSpecs].name = "spike";
+	specs[numSpecs].bitmap = getSpikeBitmap(NULL);
+	specs[numSpecs].masked = NULL;
+	specs[numSpecs++].height = SPIKE_CELL_HEIGHT;
+
+	specs[numSpecs].name = "track";
+	specs[numSpecs].bitmap = getTrackBitmap(NULL);
+	specs[numSpecs].masked = NULL;
+	specs[numSpecs++].height = TRACK_CELL_HEIGHT;
+
+	specs[numSpecs].name = "car_w";
+	specs[numSpecs].bitmap = NULL;
+	specs[numSpecs].masked = getCarMasked(M_WEST, NULL);
+	specs[numSpecs++].height = CAR_HEIGHT;
+
+	specs[numSpecs].name = "car_e";
+	specs[numSpecs].bitmap = NULL;
+	specs[numSpecs].masked = getCarMasked(M_EAST, NULL);
+	specs[numSpecs++].height = CAR_HEIGHT;
+
+	specs[numSpecs].name = "train1";
+	specs[numSpecs].bitmap = NULL;
+	specs[numSpecs].masked = getTrainMasked(NULL);
+	specs[numSpecs++].height = TRAIN_HEIGHT;
+
+	specs[numSpecs].name = "train2";
+	specs[numSpecs].bitmap = NULL;
+	specs[numSpecs].masked = getTrainMasked(NULL);
+	specs[numSpecs++].height = TRAIN_HEIGHT;
+
+	specs[numSpecs].name = "train3";
+	specs[numSpecs].bitmap = NULL;
+	specs[numSpecs].masked = getTrainMasked(NULL);
+	specs[numSpecs++].height = TRAIN_HEIGHT;
+
+	if (cOutput)
+	{
+		fprintf(out, "/**\n");
+		fprintf(out, " * @file cspr.c\n");
+		fprintf(out, " * @author Academia Team\n");
+		fprintf(out, " * @brief Contains the portable versions of the compiled "
+					 "sprites.\n");
+		fprintf(out, " * @note Generated by spr_gen from the bitmaps in "
+					 "bitmaps.c. Do not edit.\n");
+		fprintf(out, " * \n");
+		fprintf(out, " * @copyright Copyright Academia Team 2023\n");
+		fprintf(out, " */\n\n");
+		fprintf(out, "#include \"cpu.h\"\n");
+		fprintf(out, "#include \"cspr.h\"\n");
+		fprintf(out, "#include \"endian.h\"\n");
+		fprintf(out, "#include \"scrn.h\"\n\n");
+		fprintf(out, "#ifndef M68K_CPU\n");
+	}
+	else
+	{
+		fprintf(out, "; Contains the compiled sprites declared in cspr.h.\n");
+		fprintf(out, ";\n");
+		fprintf(out, "; Generated by spr_gen from the bitmaps in bitmaps.c. "
+					 "Do not edit.\n");
+		fprintf(out, "; \n");
+		fprintf(out, "; Copyright Academia Team 2023\n\n");
+
+		for (index = 0; index < numSpecs; index++)
+		{
+			fprintf(out, "\t\t\t\t\txdef\t\t\t_cspr_%s\n", specs[index].name);
+		}
+	}
+
+	for (index = 0; index < numSpecs; index++)
+	{
+		if (cOutput)
+		{
+			writeCSprite(out, &specs[index]);
+		}
+		else
+		{
+			writeAsmSprite(out, &specs[index]);
+		}
+	}
+
+	if (cOutput)
+	{
+		fprintf(out, "#endif");
+	}
+
+	fclose(out);
+	return 0;
+}
+
+/**
+ * @brief Writes the 68000 version of a compiled sprite.
+ * @details Since the 68000 only requires long accesses to be word aligned, each
+ * row that is entirely copied or entirely overlayed is written with a single
+ * instruction. Every other row is written a word at a time.
+ *
+ * @param out The file to write to.
+ * @param spec The bitmap to compile.
+ */
+void writeAsmSprite(FILE* out, const SprSpec* const spec)
+{
+	UINT32 vals[MAX_VAL_REGS];
+	UINT32 mask;
+	UINT32 image;
+	char   regList[MAX_OPERAND_LEN];
+	char   dest[MAX_OPERAND_LEN];
+	int    numVals = pickValRegs(spec, vals);
+	int    index;
+	int    reg;
+	int    offset;
+
+	/* The return address and every saved register sit above the parameter. */
+	const int DEST_OFFSET = 4 + 4 + numVals * 4;
+
+	if (numVals > 1)
+	{
+		sprintf(regList, "d0-%d/a0", numVals - 1);
+	}
+	else
+	{
+		strcpy(regList, "d0/a0");
+	}
+
+	fprintf(out, "\n\n; void cspr_%s(UINT16* const dest)\n;\n", spec->name);
+
+	if (spec->masked != NULL)
+	{
+		fprintf(out, "; Plots the masked %s bitmap onto the screen at the "
+					 "given word.\n;\n", spec->name);
+	}
+	else
+	{
+		fprintf(out, "; Copies the %s bitmap to the screen at the given "
+					 "word.\n;\n", spec->name);
+	}
+
+	fprintf(out, "; Register Table:\n;\n");
+
+	for (reg = 0; reg < numVals; reg++)
+	{
+		fprintf(out, "; d%d\t-\tHolds a value found on several rows.\n", reg);
+	}
+
+	fprintf(out, "; a0\t-\tHolds the position on screen to plot at.\n\n");
+	fprintf(out, "_cspr_%s:", spec->name);
+
+	/* Pad the label out to the column that instructions start at. */
+	for (index = (strlen(spec->name) + 7) / TAB_LEN * TAB_LEN;
+		 index < INSTR_COL; index += TAB_LEN)
+	{
+		fprintf(out, "\t");
+	}
+
+	if (numVals > 0)
+	{
+		fprintf(out, "movem.l\t\t\t%s,-(sp)\n", regList);
+	}
+	else
+	{
+		fprintf(out, "move.l\t\t\ta0,-(sp)\n");
+	}
+
+	fprintf(out, "\t\t\t\t\tmovea.l\t\t\t%d(sp),a0\n", DEST_OFFSET);
+
+	for (reg = 0; reg < numVals; reg++)
+	{
+		fprintf(out, "\t\t\t\t\tmove.l\t\t\t#$%08lX,d%d\n",
+				(unsigned long)vals[reg], reg);
+	}
+
+	for (index = 0, offset = 0; index < spec->height;
+		 index++, offset += SCRN_LEN_BYTES)
+	{
+		mask = rowMask(spec, index);
+		image = rowImage(spec, index);
+		reg = findValReg(vals, numVals, image);
+		formatDest(dest, offset);
+
+		if (reg >= 0 && rowFillsLong(spec, index))
+		{
+			fprintf(out, "\t\t\t\t\t%s.l\t\t\td%d,%s\n",
+					mask != 0 ? "move" : "or", reg, dest);
+		}
+		else if (mask == 0xFFFFFFFFu && image == 0)
+		{
+			fprintf(out, "\t\t\t\t\tclr.l\t\t\t%s\n", dest);
+		}
+		else if (mask == 0xFFFFFFFFu)
+		{
+			fprintf(out, "\t\t\t\t\tmove.l\t\t\t#$%08lX,%s\n",
+					(unsigned long)image, dest);
+		}
+		else if (mask == 0 && (image >> 16) != 0 && (image & 0xFFFFu) != 0)
+		{
+			fprintf(out, "\t\t\t\t\tori.l\t\t\t#$%08lX,%s\n",
+					(unsigned long)image, dest);
+		}
+		else
+		{
+			writeAsmWord(out, (UINT16)(mask >> 16), (UINT16)(image >> 16),
+						 offset);
+			writeAsmWord(out, (UINT16)mask, (UINT16)image, offset + 2);
+		}
+	}
+
+	if (numVals > 0)
+	{
+		fprintf(out, "\t\t\t\t\tmovem.l\t\t\t(sp)+,%s\n", regList);
+	}
+	else
+	{
+		fprintf(out, "\t\t\t\t\tmovea.l\t\t\t(sp)+,a0\n");
+	}
+
+	fprintf(out, "\t\t\t\t\trts");
+}
+
+/**
+ * @brief Writes the 68000 instructions that plot one word of a row.
+ * @details Nothing is written if the word would not change on screen.
+ *
+ * @param out The file to write to.
+ * @param mask The pixels of the word to clear.
+ * @param image The pixels of the word to set.
+ * @param offset The number of bytes after a0 that the word is at.
+ */
+void writeAsmWord(FILE* out, UINT16 mask, UINT16 image, int offset)
+{
+	char dest[MAX_OPERAND_LEN];
+
+	formatDest(dest, offset);
+
+	if (mask == 0xFFFFu && image == 0)
+	{
+		fprintf(out, "\t\t\t\t\tclr.w\t\t\t%s\n", dest);
+	}
+	else if (mask == 0xFFFFu)
+	{
+		fprintf(out, "\t\t\t\t\tmove.w\t\t\t#$%04X,%s\n", image, dest);
+	}
+	else
+	{
+		if (mask != 0)
+		{
+			fprintf(out, "\t\t\t\t\tandi.w\t\t\t#$%04X,%s\n",
+					(UINT16)~mask, dest);
+		}
+
+		if (image != 0)
+		{
+			fprintf(out, "\t\t\t\t\tori.w\t\t\t#$%04X,%s\n", image, dest);
+		}
+	}
+}
+
+/**
+ * @brief Writes the portable C version of a compiled sprite.
+ * @details Each row is split into its two words, since a long can't be
+ * accessed on a word boundary on every CPU.
+ *
+ * @param out The file to write to.
+ * @param spec The bitmap to compile.
+ */
+void writeCSprite(FILE* out, const SprSpec* const spec)
+{
+	UINT32 mask;
+	UINT32 image;
+	int    index;
+	int    offset;
+
+	fprintf(out, "\nvoid cspr_%s(UINT16* const dest)\n{\n", spec->name);
+
+	for (index = 0, offset = 0; index < spec->height;
+		 index++, offset += SCRN_LEN_WORDS)
+	{
+		mask = rowMask(spec, index);
+		image = rowImage(spec, index);
+
+		writeCWord(out, (UINT16)(mask >> 16), (UINT16)(image >> 16), offset);
+		writeCWord(out, (UINT16)mask, (UINT16)image, offset + 1);
+	}
+
+	fprintf(out, "}\n");
+}
+
+/**
+ * @brief Writes the C statements that plot one word of a row.
+ * @details Nothing is written if the word would not change on screen.
+ *
+ * @param out The file to write to.
+ * @param mask The pixels of the word to clear.
+ * @param image The pixels of the word to set.
+ * @param offset The number of words after dest that the word is at.
+ */
+void writeCWord(FILE* out, UINT16 mask, UINT16 image, int offset)
+{
+	if (mask == 0xFFFFu)
+	{
+		fprintf(out, "\tdest[%d] = (UINT16)swap16OnLE(0x%04Xu);\n",
+				offset, image);
+	}
+	else
+	{
+		if (mask != 0)
+		{
+			fprintf(out, "\tdest[%d] &= (UINT16)swap16OnLE(0x%04Xu);\n",
+					offset, (UINT16)~mask);
+		}
+
+		if (image != 0)
+		{
+			fprintf(out, "\tdest[%d] |= (UINT16)swap16OnLE(0x%04Xu);\n",
+					offset, image);
+		}
+	}
+}
+
+/**
+ * @brief Gives the pixels that a row of a sprite clears from the screen.
+ *
+ * @param spec The bitmap being compiled.
+ * @param index The row of the bitmap.
+ * @return The mask of the row.
+ */
+UINT32 rowMask(const SprSpec* const spec, int index)
+{
+	if (spec->masked != NULL)
+	{
+		return spec->masked[index * MASKED_ROW_LONGS];
+	}
+
+	return 0xFFFFFFFFu;
+}
+
+/**
+ * @brief Gives the pixels that a row of a sprite sets on the screen.
+ *
+ * @param spec The bitmap being compiled.
+ * @param index The row of the bitmap.
+ * @return The image of the row.
+ */
+UINT32 rowImage(const SprSpec* const spec, int index)
+{
+	if (spec->masked != NULL)
+	{
+		return spec->masked[index * MASKED_ROW_LONGS + 1];
+	}
+
+	return spec->bitmap[index];
+}
+
+/**
+ * @brief Determines if a row of a sprite is written as a whole long from a
+ * data register, which is the case when the row is non-zero and is either
+ * entirely copied or entirely overlayed across both of its words.
+ *
+ * @param spec The bitmap being compiled.
+ * @param index The row of the bitmap.
+ * @return TRUE if a data register could be used for the row, FALSE otherwise.
+ */
+BOOL rowFillsLong(const SprSpec* const spec, int index)
+{
+	const UINT32 mask = rowMask(spec, index);
+	const UINT32 image = rowImage(spec, index);
+
+	return (mask == 0xFFFFFFFFu && image != 0) ||
+		   (mask == 0 && (image >> 16) != 0 && (image & 0xFFFFu) != 0);
+}
+
+/**
+ * @brief Picks the row values of a sprite that are worth loading into a data
+ * register once instead of being repeated as immediate values.
+ * @details Only values that appear on at least three rows (and would need a
+ * full long to be written) are picked, as loading the register costs about as
+ * much as two rows save.
+ *
+ * @param spec The bitmap being compiled.
+ * @param vals The values picked, most frequent first. Returned by reference.
+ * @return The number of values picked.
+ */
+int pickValRegs(const SprSpec* const spec, UINT32 vals[])
+{
+	int    counts[MAX_SPR_HEIGHT];
+	int    numVals = 0;
+	int    best;
+	int    index;
+	int    other;
+
+	for (index = 0; index < spec->height; index++)
+	{
+		counts[index] = 0;
+
+		/* Rows that have a cheaper dedicated instruction are skipped. */
+		if (rowFillsLong(spec, index))
+		{
+			for (other = 0; other < spec->height; other++)
+			{
+				if (rowFillsLong(spec, other) &&
+					rowImage(spec, other) == rowImage(spec, index))
+				{
+					counts[index]++;
+				}
+			}
+		}
+	}
+
+	while (numVals < MAX_VAL_REGS)
+	{
+		best = -1;
+
+		for (index = 0; index < spec->height; index++)
+		{
+			if (counts[index] >= 3 &&
+				findValReg(vals, numVals, rowImage(spec, index)) < 0 &&
+				(best < 0 || counts[index] > counts[best]))
+			{
+				best = index;
+			}
+		}
+
+		if (best < 0)
+		{
+			break;
+		}
+
+		vals[numVals++] = rowImage(spec, best);
+	}
+
+	return numVals;
+}
+
+/**
+ * @brief Finds the data register that a value has been loaded into.
+ *
+ * @param vals The values loaded into registers.
+ * @param numVals The number of values loaded into registers.
+ * @param value The value to look for.
+ * @return The number of the data register holding the value or -1 if there
+ * isn't one.
+ */
+int findValReg(const UINT32 vals[], int numVals, UINT32 value)
+{
+	int reg;
+
+	for (reg = 0; reg < numVals; reg++)
+	{
+		if (vals[reg] == value)
+		{
+			return reg;
+		}
+	}
+
+	return -1;
+}
+
+/**
+ * @brief Formats the operand for a spot on screen relative to a0.
+ *
+ * @param operand The formatted operand. Returned by reference. Must be able to
+ * hold MAX_OPERAND_LEN characters.
+ * @param offset The number of bytes after a0 that the spot is at.
+ */
+void formatDest(char* operand, int offset)
+{
+	if (offset == 0)
+	{
+		strcpy(operand, "(a0)");
+	}
+	else
+	{
+		sprintf(operand, "%d(a0)", offset);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,559 @@
+/**
+ * @file surface.c
+ * @author Academia Team
+ * @brief Contains versions of the raster routines that plot to a Surface of
+ * any size.
+ *
+ * @copyright Copyright Academia Team 2023
+ */
+
+#include <string.h>
+
+#include "endian.h"
+#include "num_util.h"
+#include "surface.h"
+
+void surfPlot(const Surface* const surface, int x, int y, int height,
+			  const void* const bitmap, int width, RastMode mode);
+int surfWordMasks(const Surface* const surface, int x, int y, int height,
+				  int width, int* firstY, UINT16 masks[]);
+void surfPutRow(UINT16* const scrnPlotPos, UINT32 row, int shift,
+				const UINT16 masks[], RastMode mode);
+const UINT16* surfPlotRleColumn(const Surface* const surface, int x, int y,
+								int height, const UINT16* rle, RastMode mode);
+UINT32 surfBitmapRow(const void* const bitmap, int width, int row);
+UINT16 clipWordMask(const ClipRect* const clip, int word);
+void surfFill(const Surface* const surface, int x1, int x2, int y1, int y2,
+			  BOOL set);
+
+void init_surface(Surface* const surface, UINT32* const base, int pitch,
+				  int width, int height)
+{
+	surface->base = base;
+	surface->pitch = pitch;
+	surface->width = width;
+	surface->height = height;
+
+	surface->clip.left = 0;
+	surface->clip.top = 0;
+	surface->clip.right = width - 1;
+	surface->clip.bottom = height - 1;
+
+	surface->guard = surface->clip;
+}
+
+void init_guard_surface(Surface* const surface, UINT32* const mem)
+{
+	init_surface(surface, mem + GUARD_ROWS * GUARD_PITCH + GUARD_LONGS,
+				 GUARD_PITCH, SCRN_LEN, SCRN_HEIGHT);
+
+	surface->guard.left = -GUARD_LONGS * 32;
+	surface->guard.top = -GUARD_ROWS;
+	surface->guard.right = (SCRN_LEN_LONG + GUARD_LONGS) * 32 - 1;
+	surface->guard.bottom = SCRN_HEIGHT + GUARD_ROWS - 1;
+}
+
+void clip_surface(Surface* const surface, int x, int y, int length,
+				  int height)
+{
+	surface->clip.left = (x > 0 ? x : 0);
+	surface->clip.top = (y > 0 ? y : 0);
+	surface->clip.right = x + length - 1;
+	surface->clip.bottom = y + height - 1;
+
+	if (surface->clip.right >= surface->width)
+	{
+		surface->clip.right = surface->width - 1;
+	}
+
+	if (surface->clip.bottom >= surface->height)
+	{
+		surface->clip.bottom = surface->height - 1;
+	}
+
+	surface->guard = surface->clip;
+}
+
+void surf_plot_rast32(const Surface* const surface, int x, int y, int height,
+					  const UINT32* const bitmap, RastMode mode)
+{
+	surfPlot(surface, x, y, height, bitmap, 32, mode);
+}
+
+void surf_plot_rast16(const Surface* const surface, int x, int y, int height,
+					  const UINT16* const bitmap, RastMode mode)
+{
+	surfPlot(surface, x, y, height, bitmap, 16, mode);
+}
+
+void surf_plot_rast8(const Surface* const surface, int x, int y, int height,
+					 const UINT8* const bitmap, RastMode mode)
+{
+	surfPlot(surface, x, y, height, bitmap, 8, mode);
+}
+
+void surf_plot_masked32(const Surface* const surface, int x, int y, int height,
+						const UINT32* const masked)
+{
+	const int SHIFT = x & 15;
+	const int FIRST_WORD = (x - SHIFT) / 16;
+
+	const UINT32* srcPos;
+
+	UINT16 masks[3];
+	UINT16 maskWords[3];
+	UINT16 imageWords[3];
+
+	int firstY;
+	int rows;
+	int word;
+
+	UINT16* scrnPlotPos;
+
+	rows = surfWordMasks(surface, x, y, height, 32, &firstY, masks);
+
+	srcPos = masked + (firstY - y) * MASKED_ROW_LONGS;
+	scrnPlotPos = (UINT16 *)surfaceRow(surface, firstY);
+
+	for (; rows > 0; rows--, srcPos += MASKED_ROW_LONGS,
+		 scrnPlotPos += surface->pitch * 2)
+	{
+		maskWords[0] = (UINT16)(srcPos[0] >> (16 + SHIFT));
+		maskWords[1] = (UINT16)(srcPos[0] >> SHIFT);
+		maskWords[2] = (UINT16)(srcPos[0] << (16 - SHIFT));
+
+		imageWords[0] = (UINT16)(srcPos[1] >> (16 + SHIFT));
+		imageWords[1] = (UINT16)(srcPos[1] >> SHIFT);
+		imageWords[2] = (UINT16)(srcPos[1] << (16 - SHIFT));
+
+		for (word = 0; word < 3; word++)
+		{
+			if (masks[word] != 0)
+			{
+				scrnPlotPos[FIRST_WORD + word] = swap16OnLE((UINT16)(
+					(swap16OnLE(scrnPlotPos[FIRST_WORD + word]) &
+					 ~(maskWords[word] & masks[word])) |
+					(imageWords[word] & masks[word])));
+			}
+		}
+	}
+}
+
+void surf_plot_rle(const Surface* const surface, int x, int y, int length,
+				   int height, const UINT16* rle, RastMode mode)
+{
+	for (; length > 0; length -= RLE_COLUMN_LEN, x += RLE_COLUMN_LEN)
+	{
+		rle = surfPlotRleColumn(surface, x, y, height, rle, mode);
+	}
+}
+
+/**
+ * @brief Decodes a single column of a run-length encoded bitmap onto a Surface
+ * (see surf_plot_rle()).
+ *
+ * @param surface The Surface to plot on.
+ * @param x The left-most column of the bitmap column (in pixels starting at
+ * zero).
+ * @param y The top-most row of the bitmap (in pixels starting at zero).
+ * @param height The height of the bitmap.
+ * @param rle The first packet of the column.
+ * @param mode The way in which the column is to be combined with the surface.
+ * @return The first packet of the next column.
+ */
+const UINT16* surfPlotRleColumn(const Surface* const surface, int x, int y,
+								int height, const UINT16* rle, RastMode mode)
+{
+	const int SHIFT = x & 15;
+	const int FIRST_WORD = (x - SHIFT) / 16;
+
+	UINT16 masks[3];
+	UINT16 header;
+	UINT32 row = 0;
+
+	int firstY;
+	int rows;
+	int currentY;
+	int count;
+
+	UINT16* scrnPlotPos;
+
+	rows = surfWordMasks(surface, x, y, height, RLE_COLUMN_LEN, &firstY,
+						 masks);
+	scrnPlotPos = (UINT16 *)surfaceRow(surface, y) + FIRST_WORD;
+
+	for (currentY = y; currentY < y + height;)
+	{
+		header = *rle++;
+		count = header & RLE_COUNT_MASK;
+
+		if (header & RLE_RUN)
+		{
+			row = (UINT32)*rle++ << 16;
+
+			/* A blank run leaves the surface alone unless it is copied. */
+			if (row == 0 && (mode == RAST_OR || mode == RAST_XOR))
+			{
+				currentY += count;
+				scrnPlotPos += count * surface->pitch * 2;
+				count = 0;
+			}
+		}
+
+		for (; count > 0;
+			 count--, currentY++, scrnPlotPos += surface->pitch * 2)
+		{
+			if (!(header & RLE_RUN))
+			{
+				row = (UINT32)*rle++ << 16;
+			}
+
+			if (currentY >= firstY && currentY < firstY + rows)
+			{
+				surfPutRow(scrnPlotPos, row, SHIFT, masks, mode);
+			}
+		}
+	}
+
+	return rle;
+}
+
+void surf_hline(const Surface* const surface, int x1, int x2, int y)
+{
+	if (x1 > x2)
+	{
+		swap(x1, x2);
+	}
+
+	surfFill(surface, x1, x2, y, y, TRUE);
+}
+
+void surf_rect_area(const Surface* const surface, int x, int length, int y,
+					int height)
+{
+	if (length > 0 && height > 0)
+	{
+		surfFill(surface, x, x + length - 1, y, y + height - 1, TRUE);
+	}
+}
+
+void surf_clr_area(const Surface* const surface, int x, int length, int y,
+				   int height)
+{
+	if (length > 0 && height > 0)
+	{
+		surfFill(surface, x, x + length - 1, y, y + height - 1, FALSE);
+	}
+}
+
+/**
+ * @brief Plots a bitmap of any width up to 32 pixels on a Surface.
+ * @details The bitmap is plotted a word at a time. The bits of each of the
+ * (up to three) words that a row touches that lie inside both the bitmap and
+ * the clip rectangle are worked out once before any row is plotted.
+ *
+ * @param surface The Surface to plot on.
+ * @param x The left-most column to begin to plot the raster (in pixels starting
+ * at zero).
+ * @param y The top-most row to begin to plot the raster (in pixels starting at
+ * zero).
+ * @param height The height of the bitmap.
+ * @param bitmap The bitmap that is to be plotted.
+ * @param width The width of the bitmap (32, 16 or 8).
+ * @param mode The way in which the bitmap is to be combined with the surface.
+ */
+void surfPlot(const Surface* const surface, int x, int y, int height,
+			  const void* const bitmap, int width, RastMode mode)
+{
+	const int SHIFT = x & 15;
+	const int FIRST_WORD = (x - SHIFT) / 16;
+
+	UINT16 masks[3];
+
+	int firstY;
+	int currentY;
+	int rows;
+
+	UINT16* scrnPlotPos;
+
+	rows = surfWordMasks(surface, x, y, height, width, &firstY, masks);
+	scrnPlotPos = (UINT16 *)surfaceRow(surface, firstY) + FIRST_WORD;
+
+	for (currentY = firstY; rows > 0;
+		 rows--, currentY++, scrnPlotPos += surface->pitch * 2)
+	{
+		surfPutRow(scrnPlotPos, surfBitmapRow(bitmap, width, currentY - y),
+				   SHIFT, masks, mode);
+	}
+}
+
+/**
+ * @brief Combines a row of a bitmap with the (up to three) words on a surface
+ * that it touches.
+ *
+ * @param scrnPlotPos The first word that the row touches.
+ * @param row The row with its left-most pixel in the highest bit.
+ * @param shift The number of pixels that the row is away from a word boundary.
+ * @param masks The bits of each word to plot on (see surfWordMasks()).
+ * @param mode The way in which the row is to be combined with the surface.
+ */
+void surfPutRow(UINT16* const scrnPlotPos, UINT32 row, int shift,
+				const UINT16 masks[], RastMode mode)
+{
+	UINT16 values[3];
+	UINT16 scrnVal;
+
+	int word;
+
+	values[0] = (UINT16)(row >> (16 + shift));
+	values[1] = (UINT16)(row >> shift);
+	values[2] = (UINT16)(row << (16 - shift));
+
+	for (word = 0; word < 3; word++)
+	{
+		if (masks[word] != 0)
+		{
+			scrnVal = swap16OnLE(scrnPlotPos[word]);
+
+			switch(mode)
+			{
+				case RAST_OR:
+					scrnVal |= values[word] & masks[word];
+					break;
+				case RAST_XOR:
+					scrnVal ^= values[word] & masks[word];
+					break;
+				case RAST_COPY:
+					scrnVal = (scrnVal & ~masks[word]) |
+							  (values[word] & masks[word]);
+					break;
+				case RAST_COPY_INV:
+					scrnVal = (scrnVal & ~masks[word]) |
+							  (~values[word] & masks[word]);
+					break;
+			}
+
+			scrnPlotPos[word] = swap16OnLE(scrnVal);
+		}
+	}
+}
+
+/**
+ * @brief Works out the rows of a surface that a bitmap is to be plotted on,
+ * along with the bits of each of the (up to three) words in those rows.
+ * @details A bitmap that lies inside the guard rectangle of the surface is not
+ * clipped at all, so only the bits that it covers are worked out. Otherwise,
+ * the bits that lie outside of the clip rectangle are left out as well.
+ *
+ * @param surface The Surface to plot on.
+ * @param x The left-most column of the bitmap (in pixels starting at zero).
+ * @param y The top-most row of the bitmap (in pixels starting at zero).
+ * @param height The height of the bitmap.
+ * @param width The width of the bitmap (32, 16 or 8).
+ * @param firstY Returns the first row of the surface to plot on.
+ * @param masks Returns the bits of each word to plot on.
+ * @return The number of rows to plot on, which is zero or less if none are.
+ */
+int surfWordMasks(const Surface* const surface, int x, int y, int height,
+				  int width, int* firstY, UINT16 masks[])
+{
+	const int    SHIFT = x & 15;
+	const int    FIRST_WORD = (x - SHIFT) / 16;
+	const UINT32 COVER = 0xFFFFFFFFu << (32 - width);
+
+	int lastY = y + height - 1;
+
+	masks[0] = (UINT16)(COVER >> (16 + SHIFT));
+	masks[1] = (UINT16)(COVER >> SHIFT);
+	masks[2] = (UINT16)(COVER << (16 - SHIFT));
+
+	if (inGuardBand(surface, x, y, width, height))
+	{
+		*firstY = y;
+	}
+	else
+	{
+		*firstY = (y > surface->clip.top ? y : surface->clip.top);
+
+		if (lastY > surface->clip.bottom)
+		{
+			lastY = surface->clip.bottom;
+		}
+
+		masks[0] &= clipWordMask(&surface->clip, FIRST_WORD);
+		masks[1] &= clipWordMask(&surface->clip, FIRST_WORD + 1);
+		masks[2] &= clipWordMask(&surface->clip, FIRST_WORD + 2);
+	}
+
+	return lastY - *firstY + 1;
+}
+
+/**
+ * @brief Gives a row of a bitmap with its left-most pixel in the highest bit
+ * of a long.
+ *
+ * @param bitmap The bitmap to read from.
+ * @param width The width of the bitmap (32, 16 or 8).
+ * @param row The row of the bitmap to read.
+ * @return The row of the bitmap.
+ */
+UINT32 surfBitmapRow(const void* const bitmap, int width, int row)
+{
+	switch(width)
+	{
+		case 16:
+			return (UINT32)((const UINT16 *)bitmap)[row] << 16;
+		case 8:
+			return (UINT32)((const UINT8 *)bitmap)[row] << 24;
+		default:
+			return ((const UINT32 *)bitmap)[row];
+	}
+}
+
+/**
+ * @brief Gives the bits of a word in a row that lie inside a clip rectangle.
+ *
+ * @param clip The clip rectangle.
+ * @param word The index of the word in the row.
+ * @return The bits of the word inside the clip rectangle, which will be zero
+ * if the word lies outside of it.
+ */
+UINT16 clipWordMask(const ClipRect* const clip, int word)
+{
+	const int LEFT = word * 16;
+	const int RIGHT = LEFT + 15;
+
+	UINT16 mask = 0;
+
+	if (RIGHT >= clip->left && LEFT <= clip->right)
+	{
+		mask = 0xFFFFu;
+
+		if (clip->left > LEFT)
+		{
+			mask &= 0xFFFFu >> (clip->left - LEFT);
+		}
+
+		if (clip->right < RIGHT)
+		{
+			mask &= 0xFFFFu << (RIGHT - clip->right);
+		}
+	}
+
+	return mask;
+}
+
+/**
+ * @brief Sets or clears every pixel of a rectangular area on a Surface.
+ * @details The area is cropped to the clip rectangle of the surface.
+ *
+ * @param surface The Surface to plot on.
+ * @param x1 The left-most column of the area.
+ * @param x2 The right-most column of the area.
+ * @param y1 The top-most row of the area.
+ * @param y2 The bottom-most row of the area.
+ * @param set When true, the area is set to black. Otherwise, it is cleared.
+ */
+void surfFill(const Surface* const surface, int x1, int x2, int y1, int y2,
+			  BOOL set)
+{
+	UINT32 leftMask;
+	UINT32 rightMask;
+
+	int firstLong;
+	int lastLong;
+	int currentY;
+	int index;
+
+	UINT32* line;
+
+	if (x1 < surface->clip.left)
+	{
+		x1 = surface->clip.left;
+	}
+
+	if (x2 > surface->clip.right)
+	{
+		x2 = surface->clip.right;
+	}
+
+	if (y1 < surface->clip.top)
+	{
+		y1 = surface->clip.top;
+	}
+
+	if (y2 > surface->clip.bottom)
+	{
+		y2 = surface->clip.bottom;
+	}
+
+	if (x1 <= x2 && y1 <= y2)
+	{
+		firstLong = x1 >> DIV_SHIFT_BY_32;
+		lastLong = x2 >> DIV_SHIFT_BY_32;
+
+		leftMask = 0xFFFFFFFFu >> (x1 & 31);
+		rightMask = 0xFFFFFFFFu << (31 - (x2 & 31));
+
+		if (firstLong == lastLong)
+		{
+			leftMask &= rightMask;
+		}
+
+		line = surfaceRow(surface, y1);
+
+		for (currentY = y1; currentY <= y2;
+			 currentY++, line += surface->pitch)
+		{
+			if (set)
+			{
+				line[firstLong] |= swap32OnLE(leftMask);
+			}
+			else
+			{
+				line[firstLong] &= swap32OnLE(~leftMask);
+			}
+
+			if (firstLong != lastLong)
+			{
+				for (index = firstLong + 1; index < lastLong; index++)
+				{
+					line[index] = (set ? 0xFFFFFFFFu : 0);
+				}
+
+				if (set)
+				{
+					line[lastLong] |= swap32OnLE(rightMask);
+				}
+				else
+				{
+					line[lastLong] &= swap32OnLE(~rightMask);
+				}
+			}
+		}
+	}
+}
+
+void present_surface(const Surface* const surface, UINT32* const base,
+					 int startRow, int endRow)
+{
+	int row;
+
+	for (row = startRow; row <= endRow; row++)
+	{
+		memcpy(base + row * SCRN_LEN_LONG, surfaceRow(surface, row),
+			   SCRN_LEN_BYTES);
+	}
+}
+
+void load_surface(const Surface* const surface, const UINT32* const base,
+				  int startRow, int endRow)
+{
+	int row;
+
+	for (row = startRow; row <= endRow; row++)
+	{
+		memcpy(surfaceRow(surface, row), base + row * SCRN_LEN_LONG,
+			   SCRN_LEN_BYTES);
+	}
+}
\ No newline at end of file
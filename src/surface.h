@@ -0,0 +1,324 @@
+/**
+ * @file surface.h
+ * @author Academia Team
+ * @brief Contains a description of a frame buffer of any size along with
+ * versions of the raster routines that plot to one.
+ * @details The routines in raster.h can only plot to a full screen. The
+ * routines in this file take a Surface instead, so that they can also plot to
+ * smaller off-screen buffers (such as a strip holding a single row of the
+ * world) that are later composed onto the screen.
+ *
+ * @copyright Copyright Academia Team 2023
+ */
+
+#ifndef SURFACE_H
+#define SURFACE_H
+
+#include "bool.h"
+#include "raster.h"
+#include "types.h"
+
+/**
+ * @brief A rectangle of pixels that plotting is limited to.
+ * @details Both the right and bottom edges are part of the rectangle.
+ */
+typedef struct
+{
+	int left;
+	int top;
+	int right;
+	int bottom;
+} ClipRect;
+
+/**
+ * @brief Describes a frame buffer that can be plotted to.
+ * @details Every row of the frame buffer takes up pitch longs, of which only
+ * the left-most width pixels are part of the surface. Nothing is plotted
+ * outside of the clip rectangle, unless a guard band surrounds it (see
+ * init_guard_surface()).
+ * 
+ * The guard rectangle is the area that a bitmap may be plotted on without any
+ * clipping. It is the same as the clip rectangle unless the surface has a
+ * guard band, in which case it takes in the guard band as well.
+ */
+typedef struct
+{
+	UINT32*  base;
+	int      pitch;
+	int      width;
+	int      height;
+	ClipRect clip;
+	ClipRect guard;
+} Surface;
+
+/**
+ * @brief The number of longs of guard band on either side of every row of a
+ * guard-banded surface.
+ * @details Must leave room for a train part at MIN_VIS_X_TRAIN.
+ */
+#define GUARD_LONGS 2
+
+/**
+ * @brief The number of rows of guard band above and below a guard-banded
+ * surface.
+ */
+#define GUARD_ROWS 32
+
+/**
+ * @brief The number of longs that every row of a guard-banded surface takes up.
+ */
+#define GUARD_PITCH (SCRN_LEN_LONG + 2 * GUARD_LONGS)
+
+/**
+ * @brief The number of longs of memory needed to hold a guard-banded surface,
+ * including its guard band.
+ */
+#define GUARD_SURFACE_LONGS (GUARD_PITCH * (SCRN_HEIGHT + 2 * GUARD_ROWS))
+
+/**
+ * @brief Determines if a bitmap at the given position lies entirely inside the
+ * guard rectangle of a surface, and so can be plotted without any clipping.
+ */
+#define inGuardBand(surface, x, y, width, height) \
+	((x) >= (surface)->guard.left && \
+	 (x) + (width) - 1 <= (surface)->guard.right && \
+	 (y) >= (surface)->guard.top && \
+	 (y) + (height) - 1 <= (surface)->guard.bottom)
+
+/**
+ * @brief Sets up a Surface that describes a full Atari ST monochrome screen.
+ */
+#define initScrnSurface(surface, scrnBase) \
+	init_surface(surface, scrnBase, SCRN_LEN_LONG, SCRN_LEN, SCRN_HEIGHT)
+
+/**
+ * @brief Gives the address of the first long of the given row of a surface.
+ */
+#define surfaceRow(surface, y) ((surface)->base + (y) * (surface)->pitch)
+
+/**
+ * @brief Sets up a Surface whose clip rectangle covers all of it.
+ *
+ * @param surface The Surface to initialize.
+ * @param base The location in memory of the frame buffer.
+ * @param pitch The number of longs that each row of the frame buffer takes up.
+ * Must be one or greater.
+ * @param width The number of pixels in each row of the surface. Must not
+ * exceed the number of pixels in pitch longs.
+ * @param height The number of rows in the surface. Must be one or greater.
+ */
+void init_surface(Surface* const surface, UINT32* const base, int pitch,
+				  int width, int height);
+
+/**
+ * @brief Sets up a Surface the size of the screen that is surrounded by a
+ * guard band.
+ * @details The guard band is GUARD_LONGS longs wide on either side of every
+ * row and GUARD_ROWS rows high above and below the surface. Any bitmap that
+ * lies inside the guard band is plotted without being clipped, even if part of
+ * it lies outside the clip rectangle. Since whatever is plotted on the guard
+ * band is never meant to be seen, the surface is not displayed directly but
+ * is copied onto the screen with present_surface(), which crops it.
+ *
+ * @param surface The Surface to initialize.
+ * @param mem The location in memory that holds the surface along with its
+ * guard band. Must hold GUARD_SURFACE_LONGS longs.
+ */
+void init_guard_surface(Surface* const surface, UINT32* const mem);
+
+/**
+ * @brief Limits plotting on a Surface to the given rectangle.
+ * @details The rectangle is cropped to the bounds of the surface. If the
+ * rectangle lies entirely off the surface, nothing will be plotted on the
+ * surface until its clip rectangle is changed. Any guard band that the
+ * surface has is no longer used.
+ *
+ * @param surface The Surface to set the clip rectangle of.
+ * @param x The left-most column of the rectangle (in pixels starting at zero).
+ * @param y The top-most row of the rectangle (in pixels starting at zero).
+ * @param length The number of columns that make up the rectangle.
+ * @param height The number of rows that make up the rectangle.
+ */
+void clip_surface(Surface* const surface, int x, int y, int length,
+				  int height);
+
+/**
+ * @brief Plots a 32-bit wide bitmap of any height on a Surface.
+ * @details Behaves like plot_rast32(), except that the bitmap is cropped to the
+ * clip rectangle of the surface instead of the screen.
+ *
+ * @param surface The Surface to plot on.
+ * @param x The left-most column to begin to plot the raster (in pixels starting
+ * at zero).
+ * @param y The top-most row to begin to plot the raster (in pixels starting at
+ * zero).
+ * @param height The height of the bitmap. Must be one or greater.
+ * @param bitmap The bitmap that is to be plotted.
+ * @param mode The way in which the bitmap is to be combined with the surface.
+ */
+void surf_plot_rast32(const Surface* const surface, int x, int y, int height,
+					  const UINT32* const bitmap, RastMode mode);
+
+/**
+ * @brief Plots a 16-bit wide bitmap of any height on a Surface.
+ * @details Behaves like plot_rast16(), except that the bitmap is cropped to the
+ * clip rectangle of the surface instead of the screen.
+ *
+ * @param surface The Surface to plot on.
+ * @param x The left-most column to begin to plot the raster (in pixels starting
+ * at zero).
+ * @param y The top-most row to begin to plot the raster (in pixels starting at
+ * zero).
+ * @param height The height of the bitmap. Must be one or greater.
+ * @param bitmap The bitmap that is to be plotted.
+ * @param mode The way in which the bitmap is to be combined with the surface.
+ */
+void surf_plot_rast16(const Surface* const surface, int x, int y, int height,
+					  const UINT16* const bitmap, RastMode mode);
+
+/**
+ * @brief Plots an 8-bit wide bitmap of any height on a Surface.
+ * @details Behaves like plot_rast8(), except that the bitmap is cropped to the
+ * clip rectangle of the surface instead of the screen.
+ *
+ * @param surface The Surface to plot on.
+ * @param x The left-most column to begin to plot the raster (in pixels starting
+ * at zero).
+ * @param y The top-most row to begin to plot the raster (in pixels starting at
+ * zero).
+ * @param height The height of the bitmap. Must be one or greater.
+ * @param bitmap The bitmap that is to be plotted.
+ * @param mode The way in which the bitmap is to be combined with the surface.
+ */
+void surf_plot_rast8(const Surface* const surface, int x, int y, int height,
+					 const UINT8* const bitmap, RastMode mode);
+
+/**
+ * @brief Plots a 32-bit wide masked bitmap of any height on a Surface.
+ * @details Behaves like plot_masked32(), except that the bitmap is cropped to
+ * the clip rectangle of the surface instead of the screen.
+ *
+ * @param surface The Surface to plot on.
+ * @param x The left-most column to begin to plot the raster (in pixels starting
+ * at zero).
+ * @param y The top-most row to begin to plot the raster (in pixels starting at
+ * zero).
+ * @param height The height of the masked bitmap. Must be one or greater.
+ * @param masked The masked bitmap that is to be plotted, holding
+ * MASKED_ROW_LONGS longs per row.
+ */
+void surf_plot_masked32(const Surface* const surface, int x, int y, int height,
+						const UINT32* const masked);
+
+/**
+ * @brief The width (in pixels) of every column of a run-length encoded bitmap.
+ */
+#define RLE_COLUMN_LEN 16
+
+/**
+ * @brief The bit set in the header of a packet of a run-length encoded bitmap
+ * that holds a run of a single row.
+ */
+#define RLE_RUN 0x8000u
+
+/**
+ * @brief The bits in the header of a packet of a run-length encoded bitmap that
+ * hold the number of rows the packet makes up.
+ */
+#define RLE_COUNT_MASK 0x7FFFu
+
+/**
+ * @brief Decodes a run-length encoded bitmap straight onto a Surface.
+ * @details The bitmap is encoded as one column of RLE_COLUMN_LEN pixels at a
+ * time from left to right, each of which is read from top to bottom. A column
+ * is made up of packets that each start with a header word. If RLE_RUN is set
+ * in the header, the word after it is a row repeated for the number of rows
+ * given in the header (see RLE_COUNT_MASK). Otherwise, that number of rows
+ * follows the header, one word each. A packet never spans two columns.
+ *
+ * Rows are combined with the surface as they are decoded, so the bitmap is
+ * never held in memory in its decoded form. Runs of blank rows are skipped in
+ * RAST_OR and RAST_XOR modes. The bitmap is cropped to the clip rectangle of
+ * the surface.
+ *
+ * @param surface The Surface to plot on.
+ * @param x The left-most column to begin to plot the bitmap (in pixels
+ * starting at zero).
+ * @param y The top-most row to begin to plot the bitmap (in pixels starting at
+ * zero).
+ * @param length The width of the bitmap. Must be a multiple of RLE_COLUMN_LEN.
+ * @param height The height of the bitmap. Must be one or greater.
+ * @param rle The encoded bitmap.
+ * @param mode The way in which the bitmap is to be combined with the surface.
+ */
+void surf_plot_rle(const Surface* const surface, int x, int y, int length,
+				   int height, const UINT16* rle, RastMode mode);
+
+/**
+ * @brief Plots a black horizontal line on a Surface.
+ * @details Behaves like hline(), except that the line is cropped to the clip
+ * rectangle of the surface instead of the screen.
+ *
+ * @param surface The Surface to plot on.
+ * @param x1 One end of the line (in pixels starting at zero).
+ * @param x2 The other end of the line (in pixels starting at zero).
+ * @param y The row to plot the line on (in pixels starting at zero).
+ */
+void surf_hline(const Surface* const surface, int x1, int x2, int y);
+
+/**
+ * @brief Plots a black rectangular area on a Surface.
+ * @details Behaves like rect_area(), except that the area may start anywhere
+ * and is cropped to the clip rectangle of the surface.
+ *
+ * @param surface The Surface to plot on.
+ * @param x The left-most column of the rectangle (in pixels starting at zero).
+ * @param length The number of columns that make up the rectangle.
+ * @param y The top-most row of the rectangle (in pixels starting at zero).
+ * @param height The number of rows that make up the rectangle.
+ */
+void surf_rect_area(const Surface* const surface, int x, int length, int y,
+					int height);
+
+/**
+ * @brief Clears a rectangular area on a Surface.
+ * @details Behaves like clr_area(), except that the area may start anywhere
+ * and is cropped to the clip rectangle of the surface.
+ *
+ * @param surface The Surface to plot on.
+ * @param x The left-most column of the rectangle (in pixels starting at zero).
+ * @param length The number of columns that make up the rectangle.
+ * @param y The top-most row of the rectangle (in pixels starting at zero).
+ * @param height The number of rows that make up the rectangle.
+ */
+void surf_clr_area(const Surface* const surface, int x, int length, int y,
+				   int height);
+
+/**
+ * @brief Copies the given rows of a surface the size of the screen onto the
+ * screen.
+ * @details Only the part of each row inside the bounds of the surface is
+ * copied, so any guard band is cropped off.
+ *
+ * @param surface The Surface to copy from.
+ * @param base The location in memory of the screen to copy to.
+ * @param startRow The first row to copy (starting at zero).
+ * @param endRow The last row to copy (starting at zero).
+ */
+void present_surface(const Surface* const surface, UINT32* const base,
+					 int startRow, int endRow);
+
+/**
+ * @brief Copies the given rows of the screen onto a surface the size of the
+ * screen.
+ * @details The guard band of the surface (if it has one) is left alone.
+ *
+ * @param surface The Surface to copy to.
+ * @param base The location in memory of the screen to copy from.
+ * @param startRow The first row to copy (starting at zero).
+ * @param endRow The last row to copy (starting at zero).
+ */
+void load_surface(const Surface* const surface, const UINT32* const base,
+				  int startRow, int endRow);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,224 @@
+/**
+ * @file timer.c
+ * @author Academia Team
+ * @brief Contains functions to run callbacks once a given number of ticks has
+ * passed, either once or periodically.
+ *
+ * @copyright Copyright Academia Team 2023
+ */
+
+#include <stddef.h>
+
+#include "bool.h"
+#include "timer.h"
+#include "types.h"
+
+#define TIMER_SLOT_MASK (TIMER_SLOTS - 1)
+
+/**
+ * @brief The number of ticks that the slots of the given level each cover.
+ */
+#define levelTicks(level) (1UL << ((level) * TIMER_SLOT_BITS))
+
+/**
+ * @brief The first tick past the furthest one that a TimerWheel can hold.
+ */
+#define TIMER_RANGE levelTicks(TIMER_LEVELS)
+
+/**
+ * @brief The slot of the given level that holds the given tick.
+ */
+#define slotOf(tick, level) \
+	((int)(((tick) >> ((level) * TIMER_SLOT_BITS)) & TIMER_SLOT_MASK))
+
+void queueTimer(TimerWheel* const wheel, Timer* const timer);
+void cascadeSlot(TimerWheel* const wheel, int level, int slot);
+void spliceList(TimerLink* const dest, TimerLink* const src);
+void linkTimer(TimerLink* const list, Timer* const timer);
+void unlinkTimer(Timer* const timer);
+
+void init_timer_wheel(TimerWheel* const wheel, UINT32 now)
+{
+	int level;
+	int slot;
+
+	for (level = 0; level < TIMER_LEVELS; level++)
+	{
+		for (slot = 0; slot < TIMER_SLOTS; slot++)
+		{
+			wheel->slots[level][slot].next = &wheel->slots[level][slot];
+			wheel->slots[level][slot].prev = &wheel->slots[level][slot];
+		}
+	}
+
+	wheel->now = now;
+}
+
+void init_timer(Timer* const timer, void (*callback)(void))
+{
+	timer->link.next = NULL;
+	timer->link.prev = NULL;
+	timer->deadline  = 0;
+	timer->period    = 0;
+	timer->callback  = callback;
+	timer->pending   = FALSE;
+}
+
+void start_timer(TimerWheel* const wheel, Timer* const timer, UINT32 delay,
+				 UINT32 period)
+{
+	stop_timer(timer);
+
+	timer->deadline = wheel->now + (delay == 0 ? 1 : delay);
+	timer->period   = period;
+	queueTimer(wheel, timer);
+}
+
+void stop_timer(Timer* const timer)
+{
+	if (timer->pending)
+	{
+		unlinkTimer(timer);
+		timer->pending = FALSE;
+	}
+}
+
+void advance_timers(TimerWheel* const wheel, UINT32 now)
+{
+	TimerLink expired;
+	Timer*    timer;
+	UINT32    tick;
+	int       level;
+
+	while (wheel->now < now)
+	{
+		tick = ++wheel->now;
+
+		/* Timers move down a level as the wheel turns past their slot. */
+		for (level = 1;
+			 level < TIMER_LEVELS && (tick & (levelTicks(level) - 1)) == 0;
+			 level++)
+		{
+			cascadeSlot(wheel, level, slotOf(tick, level));
+		}
+
+		/* The slot is emptied before any callback is run, so that a timer
+		   started by a callback cannot expire on the same tick. */
+		expired.next = expired.prev = &expired;
+		spliceList(&expired, &wheel->slots[0][slotOf(tick, 0)]);
+
+		while (expired.next != &expired)
+		{
+			timer = (Timer *)expired.next;
+			unlinkTimer(timer);
+			timer->pending = FALSE;
+
+			if (timer->period != 0)
+			{
+				timer->deadline += timer->period;
+				queueTimer(wheel, timer);
+			}
+
+			timer->callback();
+		}
+	}
+}
+
+/**
+ * @brief Puts a timer in the slot of the lowest level of a TimerWheel that can
+ * hold its deadline.
+ *
+ * @param wheel The TimerWheel to put the timer in.
+ * @param timer The Timer to put in the wheel. Its deadline must be after the
+ * current tick of the wheel.
+ */
+void queueTimer(TimerWheel* const wheel, Timer* const timer)
+{
+	UINT32 deadline = timer->deadline;
+	int    level    = 0;
+
+	if (deadline - wheel->now >= TIMER_RANGE)
+	{
+		deadline = wheel->now + TIMER_RANGE - 1;
+	}
+
+	while (level < TIMER_LEVELS - 1 &&
+		   deadline - wheel->now >= levelTicks(level + 1))
+	{
+		level++;
+	}
+
+	linkTimer(&wheel->slots[level][slotOf(deadline, level)], timer);
+	timer->pending = TRUE;
+}
+
+/**
+ * @brief Puts every timer in a slot of a TimerWheel in the level below.
+ * @details Timers held in the top level that are still out of range are put
+ * back in the top level.
+ *
+ * @param wheel The TimerWheel to move the timers of.
+ * @param level The level of the slot.
+ * @param slot The slot whose timers are to be moved.
+ */
+void cascadeSlot(TimerWheel* const wheel, int level, int slot)
+{
+	TimerLink cascading;
+	Timer*    timer;
+
+	cascading.next = cascading.prev = &cascading;
+	spliceList(&cascading, &wheel->slots[level][slot]);
+
+	while (cascading.next != &cascading)
+	{
+		timer = (Timer *)cascading.next;
+		unlinkTimer(timer);
+		queueTimer(wheel, timer);
+	}
+}
+
+/**
+ * @brief Moves every timer from one list to the end of another.
+ *
+ * @param dest The list to move the timers to.
+ * @param src The list to move the timers from, which is left empty.
+ */
+void spliceList(TimerLink* const dest, TimerLink* const src)
+{
+	if (src->next != src)
+	{
+		src->next->prev  = dest->prev;
+		dest->prev->next = src->next;
+		src->prev->next  = dest;
+		dest->prev       = src->prev;
+
+		src->next = src->prev = src;
+	}
+}
+
+/**
+ * @brief Adds a timer to the end of a list.
+ *
+ * @param list The list to add to.
+ * @param timer The Timer to add.
+ */
+void linkTimer(TimerLink* const list, Timer* const timer)
+{
+	timer->link.next = list;
+	timer->link.prev = list->prev;
+	list->prev->next = &timer->link;
+	list->prev       = &timer->link;
+}
+
+/**
+ * @brief Removes a timer from whichever list it is in.
+ *
+ * @param timer The Timer to remove.
+ */
+void unlinkTimer(Timer* const timer)
+{
+	timer->link.prev->next = timer->link.next;
+	timer->link.next->prev = timer->link.prev;
+	timer->link.next       = NULL;
+	timer->link.prev       = NULL;
+}
\ No newline at end of file
@@ -0,0 +1,131 @@
+/**
+ * @file timer.h
+ * @author Academia Team
+ * @brief Runs callbacks once a given number of ticks has passed, either once
+ * or periodically.
+ * @details Timers are kept in a hierarchical timer wheel. Each level of the
+ * wheel is made up of TIMER_SLOTS slots, and every slot of a level covers
+ * TIMER_SLOTS times as many ticks as a slot of the level below it. A timer is
+ * put in the lowest level that can hold its deadline, and is moved down a
+ * level whenever the wheel turns past the start of its slot. That way, a tick
+ * only costs as much as the timers that expire on it (plus the occasional
+ * move down a level), however many timers are running.
+ *
+ * A wheel does not read the time itself, but is moved on to a given tick,
+ * such as the one returned by get_time() (see vbl.h). Timers are owned by
+ * whoever starts them, so no memory is ever allocated.
+ *
+ * @copyright Copyright Academia Team 2023
+ */
+
+#ifndef TIMER_H
+#define TIMER_H
+
+#include "bool.h"
+#include "types.h"
+
+/**
+ * @brief The number of bits of a deadline that pick the slot of a level.
+ */
+#define TIMER_SLOT_BITS 5
+
+/**
+ * @brief The number of slots in every level of a TimerWheel.
+ */
+#define TIMER_SLOTS (1 << TIMER_SLOT_BITS)
+
+/**
+ * @brief The number of levels in a TimerWheel.
+ * @details Timers that expire further in the future than the levels cover are
+ * held in the top level until they come within range.
+ */
+#define TIMER_LEVELS 3
+
+/**
+ * @brief A link in the circular list of timers held in a slot of a TimerWheel.
+ */
+typedef struct TimerLink
+{
+	struct TimerLink* next;
+	struct TimerLink* prev;
+} TimerLink;
+
+/**
+ * @brief A callback to run once a given tick has been reached.
+ * @details A periodic timer is started again before its callback is run, so
+ * the callback may stop it. The link must come first.
+ */
+typedef struct
+{
+	TimerLink link;
+	UINT32    deadline;
+	UINT32    period;
+	void    (*callback)(void);
+	BOOL      pending;
+} Timer;
+
+/**
+ * @brief Holds every timer that is running, sorted by the slot they expire in.
+ */
+typedef struct
+{
+	TimerLink slots[TIMER_LEVELS][TIMER_SLOTS];
+	UINT32    now;
+} TimerWheel;
+
+/**
+ * @brief Readies a TimerWheel that holds no timers.
+ *
+ * @param wheel The TimerWheel to initialize.
+ * @param now The tick that the wheel starts at.
+ */
+void init_timer_wheel(TimerWheel* const wheel, UINT32 now);
+
+/**
+ * @brief Readies a Timer that is not running.
+ *
+ * @param timer The Timer to initialize.
+ * @param callback The function to run when the timer expires.
+ */
+void init_timer(Timer* const timer, void (*callback)(void));
+
+/**
+ * @brief Starts a Timer on a TimerWheel, stopping it first if it is already
+ * running.
+ *
+ * @param wheel The TimerWheel to run the timer on.
+ * @param timer The Timer to start.
+ * @param delay The number of ticks from the current tick of the wheel until
+ * the timer expires. A delay of zero is taken as one.
+ * @param period The number of ticks between each time the timer expires after
+ * the first, or zero if it is only to expire once.
+ */
+void start_timer(TimerWheel* const wheel, Timer* const timer, UINT32 delay,
+				 UINT32 period);
+
+/**
+ * @brief Stops a Timer, so that its callback is not run. Nothing is done if the
+ * timer is not running.
+ *
+ * @param timer The Timer to stop.
+ */
+void stop_timer(Timer* const timer);
+
+/**
+ * @brief Determines if a Timer is running.
+ */
+#define timer_pending(timer) ((timer)->pending)
+
+/**
+ * @brief Moves a TimerWheel on to the given tick, running the callback of
+ * every timer that expires on the way.
+ * @details The callbacks are run a tick at a time, so those of timers that
+ * expire on an earlier tick are always run first.
+ *
+ * @param wheel The TimerWheel to move on.
+ * @param now The tick to move the wheel on to. Nothing is done if the wheel
+ * has already reached it.
+ */
+void advance_timers(TimerWheel* const wheel, UINT32 now);
+
+#endif
\ No newline at end of file
@@ -7,6 +7,7 @@
  * @copyright Copyright Academia Team 2023
  */
 
+#include <stdio.h>
 #include <string.h>
 
 #include "bitmaps.h"
@@ -129,6 +130,109 @@ void t33Rast8(ArgList *args);
 void t34Rast8(ArgList *args);
 void t35Rast8(ArgList *args);
 
+void regGrid32Tests(BOOL blackScreen, BOOL destructive);
+void t1Grid32(ArgList *args);
+void t2Grid32(ArgList *args);
+void t3Grid32(ArgList *args);
+void t4Grid32(ArgList *args);
+BOOL tstGrid32(ArgList *args, int x, BOOL onGrid);
+
+void regGridAlphaTests(void);
+void t1GridAlpha(ArgList *args);
+void t2GridAlpha(ArgList *args);
+void t3GridAlpha(ArgList *args);
+void t4GridAlpha(ArgList *args);
+BOOL tstGridAlpha(ArgList *args, int x, BOOL onGrid);
+
+void regMasked32Tests(void);
+void t1Masked32(ArgList *args);
+void t2Masked32(ArgList *args);
+void t3Masked32(ArgList *args);
+void t4Masked32(ArgList *args);
+BOOL tstMasked32(ArgList *args, int x, int y, int height);
+void refMasked32(UINT32* const base, int x, int y, int height,
+				 const UINT32* const masked);
+
+/**
+ * @brief The height of the bitmap plotted by the grid tests.
+ */
+#define GRID_TST_HEIGHT 32
+
+/**
+ * @brief The most entries a draw list test can queue, which is more than a
+ * DrawList can hold at once.
+ */
+#define MAX_DRAW_TST_ENTRIES 80
+
+/**
+ * @brief A bitmap for a draw list test to queue.
+ * @details The bitmap queued is picked by the mode. When fixed is TRUE, the
+ * bitmap is queued along with drawTstFixed() (see add_fixed_draw()), which is
+ * only valid for DRAW_MASKED32.
+ */
+typedef struct
+{
+	int      x;
+	int      y;
+	DrawMode mode;
+	BOOL     fixed;
+} DrawTstEntry;
+
+void regDrawListTests(void);
+void t1DrawList(ArgList *args);
+void t2DrawList(ArgList *args);
+void t3DrawList(ArgList *args);
+void t4DrawList(ArgList *args);
+BOOL tstDrawList(ArgList *args, const DrawTstEntry entries[], int numEntries,
+				 int numFixed);
+void refDraw(UINT32* const base, int x, int y, DrawMode mode);
+void drawTstFixed(UINT16* const dest);
+
+void initGridTstBitmap(void);
+void initMaskedTstBitmap(void);
+
+/**
+ * @brief The rows that the grid tests plot their bitmap at, from entirely above
+ * the screen to entirely below it.
+ */
+const int gridTstYs[] = {-GRID_TST_HEIGHT, -31, -20, 0, 184, 368, 388,
+						 SCRN_MAX_Y, SCRN_HEIGHT};
+
+/**
+ * @brief A 32px wide bitmap with a different pattern on every row, so that a
+ * row plotted in the wrong place can be told apart.
+ */
+UINT32 gridTstBitmap[GRID_TST_HEIGHT];
+
+/**
+ * @brief A masked bitmap with a different mask and image on every row, which
+ * holds pixels that are only masked, only set, both or neither.
+ */
+UINT32 maskedTstBitmap[GRID_TST_HEIGHT * MASKED_ROW_LONGS];
+
+/**
+ * @brief The frame buffer that the output of the function under test is
+ * compared against.
+ */
+UINT32 refScrn[SCRN_LONGS];
+
+/**
+ * @brief A 16px wide bitmap with a different pattern on every row.
+ */
+UINT16 gridTstBitmap16[GRID_TST_HEIGHT];
+
+/**
+ * @brief The list that the draw list tests queue their bitmaps on.
+ */
+DrawList drawTstList;
+
+/**
+ * @brief The frame buffer that drawTstFixed() plots to and the number of times
+ * it has been called.
+ */
+UINT32* drawTstBase;
+int     numDrawTstFixed;
+
 int main(int argc, char **argv)
 {
 	regRast32Tests(BLACK_SCREEN_OFF, DESTRUCT_OFF);
@@ -146,6 +250,17 @@ int main(int argc, char **argv)
 	regRast8Tests(BLACK_SCREEN_ON, DESTRUCT_OFF);
 	regRast8Tests(BLACK_SCREEN_ON, DESTRUCT_ON);
 
+	regGrid32Tests(BLACK_SCREEN_OFF, DESTRUCT_OFF);
+	regGrid32Tests(BLACK_SCREEN_OFF, DESTRUCT_ON);
+	regGrid32Tests(BLACK_SCREEN_ON, DESTRUCT_OFF);
+	regGrid32Tests(BLACK_SCREEN_ON, DESTRUCT_ON);
+
+	regGridAlphaTests();
+
+	regMasked32Tests();
+
+	regDrawListTests();
+
 	handleTests();
 
 	return 0;
@@ -3797,4 +3912,844 @@ void t35Rast8(ArgList *args)
 
 	plot_rast8((UINT8 *)getArgFromList("base", args), 0, SCRN_HEIGHT + 1,
 				HEIGHT, img, destructive, blackScreen);
+}
+
+/**
+ * @brief Handle the registration of all tests related to the plot_grid32()
+ * function.
+ * @details These tests check their own results against plot_rast32(). The
+ * screen is covered by a pattern that differs on every row, so it is expected
+ * to look like noise.
+ * 
+ * @param blackScreen Whether the bitmaps are plotted as if on a black surface.
+ * @param destructive Whether the bitmaps destroy what was behind them.
+ */
+void regGrid32Tests(BOOL blackScreen, BOOL destructive)
+{
+	TestSuiteID suiteID;
+
+	if (blackScreen)
+	{
+		if (destructive)
+		{
+			suiteID = registerTestSuite("Tests plotting 32px wide bitmaps on the grid destructively on a black surface.",
+										rastTstBlack);
+		}
+		else
+		{
+			suiteID = registerTestSuite("Tests plotting 32px wide bitmaps on the grid non-destructively on a black surface.",
+										rastTstBlackPerserve);
+		}
+	}
+	else
+	{
+		if (destructive)
+		{
+			suiteID = registerTestSuite("Tests plotting 32px wide bitmaps on the grid destructively on a white surface.",
+										rastTstWhite);
+		}
+		else
+		{
+			suiteID = registerTestSuite("Tests plotting 32px wide bitmaps on the grid non-destructively on a white surface.",
+										rastTstWhitePerserve);
+		}
+	}
+
+	registerTestCase(suiteID,
+					 "When x is at its minimum value (zero) and y is clipped at the top and bottom.",
+					 NULL, t1Grid32);
+
+	registerTestCase(suiteID,
+					 "When x is 16, so the bitmap is not long aligned, and y is clipped at the top and bottom.",
+					 NULL, t2Grid32);
+
+	registerTestCase(suiteID,
+					 "When x is the maximum value it can be without getting the image cropped.",
+					 NULL, t3Grid32);
+
+	registerTestCase(suiteID,
+					 "When x is not on the grid.",
+					 NULL, t4Grid32);
+}
+
+/**
+ * @brief Tests plot_grid32() when x is at its minimum value (zero).
+ * @details The expected results are that, at every row in gridTstYs, the
+ * screen holds exactly what plot_rast32() plots.
+ * 
+ * @param args The list of arguments required by the function.
+ * 
+ * - base: The location in memory to plot at.
+ * - blackScreen: Whether an image is being placed on top of a black background
+ * or not.
+ * - destructive: Whether the image should destroy whatever was at the position
+ * it is being plotted at.
+ */
+void t1Grid32(ArgList *args)
+{
+	puts(tstGrid32(args, 0, TRUE) ?
+		 "The test has succeeded." :
+		 "The test has failed.");
+}
+
+/**
+ * @brief Tests plot_grid32() when x is 16, so that the bitmap starts on a word
+ * boundary that is not a long boundary.
+ * @details The expected results are that, at every row in gridTstYs, the
+ * screen holds exactly what plot_rast32() plots.
+ * 
+ * @param args The list of arguments required by the function.
+ * 
+ * - base: The location in memory to plot at.
+ * - blackScreen: Whether an image is being placed on top of a black background
+ * or not.
+ * - destructive: Whether the image should destroy whatever was at the position
+ * it is being plotted at.
+ */
+void t2Grid32(ArgList *args)
+{
+	puts(tstGrid32(args, 16, TRUE) ?
+		 "The test has succeeded." :
+		 "The test has failed.");
+}
+
+/**
+ * @brief Tests plot_grid32() when x is the maximum value it can be without
+ * getting the image cropped.
+ * @details The expected results are that, at every row in gridTstYs, the
+ * screen holds exactly what plot_rast32() plots.
+ * 
+ * @param args The list of arguments required by the function.
+ * 
+ * - base: The location in memory to plot at.
+ * - blackScreen: Whether an image is being placed on top of a black background
+ * or not.
+ * - destructive: Whether the image should destroy whatever was at the position
+ * it is being plotted at.
+ */
+void t3Grid32(ArgList *args)
+{
+	puts(tstGrid32(args, RAST32_MAX_VIS_X, TRUE) ?
+		 "The test has succeeded." :
+		 "The test has failed.");
+}
+
+/**
+ * @brief Tests plot_grid32() when x is not on the grid.
+ * @details The expected results are that nothing is plotted, whether x is
+ * not a multiple of 16 or would crop the image.
+ * 
+ * @param args The list of arguments required by the function.
+ * 
+ * - base: The location in memory to plot at.
+ * - blackScreen: Whether an image is being placed on top of a black background
+ * or not.
+ * - destructive: Whether the image should destroy whatever was at the position
+ * it is being plotted at.
+ */
+void t4Grid32(ArgList *args)
+{
+	puts(tstGrid32(args, 8, FALSE) && tstGrid32(args, -16, FALSE) &&
+		 tstGrid32(args, RAST32_MAX_VIS_X + 16, FALSE) ?
+		 "The test has succeeded." :
+		 "The test has failed.");
+}
+
+/**
+ * @brief Plots a bitmap with plot_grid32() at every row in gridTstYs and
+ * checks that the screen holds the same bytes as a copy that had the bitmap
+ * plotted by plot_rast32().
+ * 
+ * @param args The list of arguments passed to the test.
+ * @param x The column to plot the bitmap at.
+ * @param onGrid Whether x satisfies onRast32Grid(). When it does not, the copy
+ * is left as it was, as nothing should be plotted.
+ * @return TRUE if the screen matched the copy at every row; FALSE otherwise.
+ */
+BOOL tstGrid32(ArgList *args, int x, BOOL onGrid)
+{
+	const int NUM_YS = sizeof(gridTstYs) / sizeof(gridTstYs[0]);
+
+	UINT32* const base = (UINT32 *)getArgFromList("base", args);
+	const BOOL blackScreen = *(BOOL *)getArgFromList("blackScreen", args);
+	const BOOL destructive = *(BOOL *)getArgFromList("destructive", args);
+
+	int  index;
+	BOOL passed = TRUE;
+
+	initGridTstBitmap();
+
+	for (index = 0; index < NUM_YS && passed; index++)
+	{
+		fillRowPattern(base);
+		memcpy(refScrn, base, SCRN_BYTES);
+
+		plot_grid32(base, x, gridTstYs[index], GRID_TST_HEIGHT, gridTstBitmap,
+					destructive, blackScreen);
+
+		if (onGrid)
+		{
+			plot_rast32(refScrn, x, gridTstYs[index], GRID_TST_HEIGHT,
+						gridTstBitmap, destructive, blackScreen);
+		}
+
+		if (!(passed = chkSameScrn(base, refScrn)))
+		{
+			printf("The bitmap was plotted at (%i, %i).\n", x,
+				   gridTstYs[index]);
+		}
+	}
+
+	return passed;
+}
+
+/**
+ * @brief Handle the registration of all tests related to the plot_grid_alpha()
+ * function.
+ * @details These tests check their own results against plot_alpha(). The
+ * screen is covered by a pattern that differs on every row, so it is expected
+ * to look like noise.
+ */
+void regGridAlphaTests(void)
+{
+	TestSuiteID suiteID;
+
+	suiteID = registerTestSuite("Tests applying 32px wide alpha bitmaps on the grid.",
+								rastTstWhite);
+
+	registerTestCase(suiteID,
+					 "When x is at its minimum value (zero) and y is clipped at the top and bottom.",
+					 NULL, t1GridAlpha);
+
+	registerTestCase(suiteID,
+					 "When x is 16, so the bitmap is not long aligned, and y is clipped at the top and bottom.",
+					 NULL, t2GridAlpha);
+
+	registerTestCase(suiteID,
+					 "When x is the maximum value it can be without getting the alpha cropped.",
+					 NULL, t3GridAlpha);
+
+	registerTestCase(suiteID,
+					 "When x is not on the grid.",
+					 NULL, t4GridAlpha);
+}
+
+/**
+ * @brief Tests plot_grid_alpha() when x is at its minimum value (zero).
+ * @details The expected results are that, at every row in gridTstYs, the
+ * screen holds exactly what plot_alpha() applies.
+ * 
+ * @param args The list of arguments required by the function.
+ * 
+ * - base: The location in memory to plot at.
+ */
+void t1GridAlpha(ArgList *args)
+{
+	puts(tstGridAlpha(args, 0, TRUE) ?
+		 "The test has succeeded." :
+		 "The test has failed.");
+}
+
+/**
+ * @brief Tests plot_grid_alpha() when x is 16, so that the alpha starts on a
+ * word boundary that is not a long boundary.
+ * @details The expected results are that, at every row in gridTstYs, the
+ * screen holds exactly what plot_alpha() applies.
+ * 
+ * @param args The list of arguments required by the function.
+ * 
+ * - base: The location in memory to plot at.
+ */
+void t2GridAlpha(ArgList *args)
+{
+	puts(tstGridAlpha(args, 16, TRUE) ?
+		 "The test has succeeded." :
+		 "The test has failed.");
+}
+
+/**
+ * @brief Tests plot_grid_alpha() when x is the maximum value it can be without
+ * getting the alpha cropped.
+ * @details The expected results are that, at every row in gridTstYs, the
+ * screen holds exactly what plot_alpha() applies.
+ * 
+ * @param args The list of arguments required by the function.
+ * 
+ * - base: The location in memory to plot at.
+ */
+void t3GridAlpha(ArgList *args)
+{
+	puts(tstGridAlpha(args, RAST32_MAX_VIS_X, TRUE) ?
+		 "The test has succeeded." :
+		 "The test has failed.");
+}
+
+/**
+ * @brief Tests plot_grid_alpha() when x is not on the grid.
+ * @details The expected results are that nothing is applied, whether x is not
+ * a multiple of 16 or would crop the alpha.
+ * 
+ * @param args The list of arguments required by the function.
+ * 
+ * - base: The location in memory to plot at.
+ */
+void t4GridAlpha(ArgList *args)
+{
+	puts(tstGridAlpha(args, 8, FALSE) && tstGridAlpha(args, -16, FALSE) &&
+		 tstGridAlpha(args, RAST32_MAX_VIS_X + 16, FALSE) ?
+		 "The test has succeeded." :
+		 "The test has failed.");
+}
+
+/**
+ * @brief Applies an alpha bitmap with plot_grid_alpha() at every row in
+ * gridTstYs and checks that the screen holds the same bytes as a copy that had
+ * the alpha applied by plot_alpha().
+ * 
+ * @param args The list of arguments passed to the test.
+ * @param x The column to apply the alpha at.
+ * @param onGrid Whether x satisfies onRast32Grid(). When it does not, the copy
+ * is left as it was, as nothing should be applied.
+ * @return TRUE if the screen matched the copy at every row; FALSE otherwise.
+ */
+BOOL tstGridAlpha(ArgList *args, int x, BOOL onGrid)
+{
+	const int NUM_YS = sizeof(gridTstYs) / sizeof(gridTstYs[0]);
+
+	UINT32* const base = (UINT32 *)getArgFromList("base", args);
+
+	int  index;
+	BOOL passed = TRUE;
+
+	initGridTstBitmap();
+
+	for (index = 0; index < NUM_YS && passed; index++)
+	{
+		fillRowPattern(base);
+		memcpy(refScrn, base, SCRN_BYTES);
+
+		plot_grid_alpha(base, x, gridTstYs[index], GRID_TST_HEIGHT,
+						gridTstBitmap);
+
+		if (onGrid)
+		{
+			plot_alpha(refScrn, x, gridTstYs[index], GRID_TST_HEIGHT,
+					   gridTstBitmap);
+		}
+
+		if (!(passed = chkSameScrn(base, refScrn)))
+		{
+			printf("The alpha was applied at (%i, %i).\n", x,
+				   gridTstYs[index]);
+		}
+	}
+
+	return passed;
+}
+
+/**
+ * @brief Handle the registration of all tests related to the plot_masked32()
+ * function.
+ * @details These tests check their own results against a copy of the screen
+ * that has the masked bitmap plotted a pixel at a time. The screen is covered
+ * by a pattern that differs on every row, so it is expected to look like
+ * noise.
+ */
+void regMasked32Tests(void)
+{
+	TestSuiteID suiteID;
+
+	suiteID = registerTestSuite("Tests plotting 32px wide masked bitmaps.",
+								rastTstWhite);
+
+	registerTestCase(suiteID,
+					 "When x starts at every possible offset within a long.",
+					 NULL, t1Masked32);
+
+	registerTestCase(suiteID,
+					 "When x is set to values such that the image is cropped from the left or the right.",
+					 NULL, t2Masked32);
+
+	registerTestCase(suiteID,
+					 "When y is set to values such that the image is cropped from the top or the bottom.",
+					 NULL, t3Masked32);
+
+	registerTestCase(suiteID,
+					 "When the image is entirely off the screen or its height is below one.",
+					 NULL, t4Masked32);
+}
+
+/**
+ * @brief Tests plot_masked32() when x starts at every possible offset within a
+ * long.
+ * @details The expected results are that, at each of the 32 offsets, the
+ * screen holds exactly what plotting the masked bitmap a pixel at a time does.
+ * 
+ * @param args The list of arguments required by the function.
+ * 
+ * - base: The location in memory to plot at.
+ */
+void t1Masked32(ArgList *args)
+{
+	int  offset;
+	BOOL passed = TRUE;
+
+	for (offset = 0; offset < 32 && passed; offset++)
+	{
+		passed = tstMasked32(args, 96 + offset, RAST32H_MID_VIS_Y,
+							 GRID_TST_HEIGHT);
+	}
+
+	puts(passed ? "The test has succeeded." : "The test has failed.");
+}
+
+/**
+ * @brief Tests plot_masked32() when the image is cropped from the left or the
+ * right.
+ * @details The expected results are that only the columns that are on screen
+ * are plotted, without anything wrapping around to the other side.
+ * 
+ * @param args The list of arguments required by the function.
+ * 
+ * - base: The location in memory to plot at.
+ */
+void t2Masked32(ArgList *args)
+{
+	const int xs[] = {-1, RAST32_LHALF_X, RAST32_MIN_X, RAST32_MAX_VIS_X + 1,
+					  RAST32_RHALF_X, SCRN_MAX_X};
+	const int NUM_XS = sizeof(xs) / sizeof(xs[0]);
+
+	int  index;
+	BOOL passed = TRUE;
+
+	for (index = 0; index < NUM_XS && passed; index++)
+	{
+		passed = tstMasked32(args, xs[index], RAST32H_MID_VIS_Y,
+							 GRID_TST_HEIGHT);
+	}
+
+	puts(passed ? "The test has succeeded." : "The test has failed.");
+}
+
+/**
+ * @brief Tests plot_masked32() when the image is cropped from the top or the
+ * bottom.
+ * @details The expected results are that only the rows that are on screen are
+ * plotted, starting from the right row of the masked bitmap.
+ * 
+ * @param args The list of arguments required by the function.
+ * 
+ * - base: The location in memory to plot at.
+ */
+void t3Masked32(ArgList *args)
+{
+	const int ys[] = {-1, RAST32H_THALF_Y, RAST32H_MIN_Y, RAST32H_MAX_VIS_Y + 1,
+					  RAST32H_BHALF_Y, SCRN_MAX_Y};
+	const int NUM_YS = sizeof(ys) / sizeof(ys[0]);
+
+	int  index;
+	BOOL passed = TRUE;
+
+	for (index = 0; index < NUM_YS && passed; index++)
+	{
+		passed = tstMasked32(args, 100, ys[index], GRID_TST_HEIGHT);
+	}
+
+	puts(passed ? "The test has succeeded." : "The test has failed.");
+}
+
+/**
+ * @brief Tests plot_masked32() when the image is entirely off the screen or its
+ * height is below one.
+ * @details The expected results are that nothing is plotted.
+ * 
+ * @param args The list of arguments required by the function.
+ * 
+ * - base: The location in memory to plot at.
+ */
+void t4Masked32(ArgList *args)
+{
+	puts(tstMasked32(args, -32, 100, GRID_TST_HEIGHT) &&
+		 tstMasked32(args, SCRN_LEN, 100, GRID_TST_HEIGHT) &&
+		 tstMasked32(args, 100, -GRID_TST_HEIGHT, GRID_TST_HEIGHT) &&
+		 tstMasked32(args, 100, SCRN_HEIGHT, GRID_TST_HEIGHT) &&
+		 tstMasked32(args, 100, 100, 0) &&
+		 tstMasked32(args, 100, 100, -1) ?
+		 "The test has succeeded." :
+		 "The test has failed.");
+}
+
+/**
+ * @brief Plots a masked bitmap with plot_masked32() and checks that the screen
+ * holds the same bytes as a copy that had it plotted by refMasked32().
+ * 
+ * @param args The list of arguments passed to the test.
+ * @param x The column to plot the masked bitmap at.
+ * @param y The row to plot the masked bitmap at.
+ * @param height The number of rows of the masked bitmap to plot.
+ * @return TRUE if the screen matched the copy; FALSE otherwise.
+ */
+BOOL tstMasked32(ArgList *args, int x, int y, int height)
+{
+	UINT32* const base = (UINT32 *)getArgFromList("base", args);
+
+	BOOL passed;
+
+	initMaskedTstBitmap();
+
+	fillRowPattern(base);
+	memcpy(refScrn, base, SCRN_BYTES);
+
+	plot_masked32(base, x, y, height, maskedTstBitmap);
+	refMasked32(refScrn, x, y, height, maskedTstBitmap);
+
+	if (!(passed = chkSameScrn(base, refScrn)))
+	{
+		printf("The masked bitmap was plotted at (%i, %i).\n", x, y);
+	}
+
+	return passed;
+}
+
+/**
+ * @brief Plots a masked bitmap a pixel at a time, for plot_masked32() to be
+ * checked against.
+ * @details Every pixel set in the mask of a row is cleared and then every pixel
+ * set in its image is set. Pixels off screen are left out.
+ * 
+ * @param base The location in memory to plot at.
+ * @param x The left-most column to begin to plot the masked bitmap.
+ * @param y The top-most row to begin to plot the masked bitmap.
+ * @param height The number of rows of the masked bitmap to plot.
+ * @param masked The masked bitmap, holding MASKED_ROW_LONGS longs per row.
+ */
+void refMasked32(UINT32* const base, int x, int y, int height,
+				 const UINT32* const masked)
+{
+	UINT32 bit;
+	int    row;
+	int    col;
+
+	for (row = 0; row < height; row++)
+	{
+		for (col = 0, bit = 0x80000000UL; col < 32; col++, bit >>= 1)
+		{
+			if (masked[row * MASKED_ROW_LONGS] & bit)
+			{
+				putPixel(base, x + col, y + row, FALSE);
+			}
+
+			if (masked[row * MASKED_ROW_LONGS + 1] & bit)
+			{
+				putPixel(base, x + col, y + row, TRUE);
+			}
+		}
+	}
+}
+
+/**
+ * @brief Handle the registration of all tests related to the draw_list()
+ * function.
+ * @details These tests check their own results against a copy of the screen
+ * that has every bitmap plotted straight away in the order it was queued. The
+ * screen is covered by a pattern that differs on every row, so it is expected
+ * to look like noise.
+ */
+void regDrawListTests(void)
+{
+	TestSuiteID suiteID;
+
+	suiteID = registerTestSuite("Tests drawing the bitmaps queued on a draw list.",
+								rastTstWhite);
+
+	registerTestCase(suiteID,
+					 "When plain bitmaps are queued in every mode, including ones that are clipped.",
+					 NULL, t1DrawList);
+
+	registerTestCase(suiteID,
+					 "When masked bitmaps are queued on and off the grid, with and without a fixed routine.",
+					 NULL, t2DrawList);
+
+	registerTestCase(suiteID,
+					 "When bitmaps that overlap are queued at the same place, out of order with others.",
+					 NULL, t3DrawList);
+
+	registerTestCase(suiteID,
+					 "When more bitmaps are queued than the list can hold at once.",
+					 NULL, t4DrawList);
+}
+
+/**
+ * @brief Tests draw_list() when plain bitmaps are queued in every mode.
+ * @details The expected results are that every bitmap is plotted as if by the
+ * plot function of its mode, including those cropped by the edges of the
+ * screen.
+ * 
+ * @param args The list of arguments required by the function.
+ * 
+ * - base: The location in memory to plot at.
+ */
+void t1DrawList(ArgList *args)
+{
+	const DrawTstEntry entries[] =
+	{
+		{16, 20, DRAW_OR32, FALSE},
+		{89, 60, DRAW_XOR32, FALSE},
+		{162, 100, DRAW_COPY32, FALSE},
+		{235, 140, DRAW_INV32, FALSE},
+		{304, 180, DRAW_OR16, FALSE},
+		{381, 220, DRAW_XOR16, FALSE},
+		{454, 260, DRAW_COPY16, FALSE},
+		{527, 300, DRAW_INV16, FALSE},
+		{-7, 340, DRAW_COPY32, FALSE},
+		{620, 20, DRAW_INV32, FALSE},
+		{200, -20, DRAW_COPY16, FALSE},
+		{300, 390, DRAW_INV16, FALSE}
+	};
+
+	puts(tstDrawList(args, entries, sizeof(entries) / sizeof(entries[0]), 0) ?
+		 "The test has succeeded." :
+		 "The test has failed.");
+}
+
+/**
+ * @brief Tests draw_list() when masked bitmaps are queued on and off the grid,
+ * with and without a fixed routine.
+ * @details The expected results are that every bitmap is plotted as if by
+ * plot_masked32(), and that the fixed routine is only used for the two bitmaps
+ * that are on the grid and entirely on screen.
+ * 
+ * @param args The list of arguments required by the function.
+ * 
+ * - base: The location in memory to plot at.
+ */
+void t2DrawList(ArgList *args)
+{
+	const DrawTstEntry entries[] =
+	{
+		{64, 64, DRAW_MASKED32, TRUE},
+		{RAST32_MAX_VIS_X, RAST32H_MAX_VIS_Y, DRAW_MASKED32, TRUE},
+		{168, 64, DRAW_MASKED32, TRUE},
+		{RAST32_LHALF_X, 128, DRAW_MASKED32, TRUE},
+		{256, RAST32H_BHALF_Y, DRAW_MASKED32, TRUE},
+		{320, 200, DRAW_MASKED32, FALSE},
+		{413, 200, DRAW_MASKED32, FALSE},
+		{SCRN_MAX_X, RAST32H_THALF_Y, DRAW_MASKED32, FALSE}
+	};
+
+	puts(tstDrawList(args, entries, sizeof(entries) / sizeof(entries[0]), 2) ?
+		 "The test has succeeded." :
+		 "The test has failed.");
+}
+
+/**
+ * @brief Tests draw_list() when bitmaps that overlap are queued at the same
+ * place.
+ * @details Bitmaps further down the screen are queued in between them, so
+ * that they have to be sorted. The expected results are that the bitmaps at the
+ * same place are plotted in the order they were queued.
+ * 
+ * @param args The list of arguments required by the function.
+ * 
+ * - base: The location in memory to plot at.
+ */
+void t3DrawList(ArgList *args)
+{
+	const DrawTstEntry entries[] =
+	{
+		{400, 300, DRAW_COPY32, FALSE},
+		{96, 100, DRAW_COPY32, FALSE},
+		{400, 300, DRAW_MASKED32, FALSE},
+		{96, 100, DRAW_INV32, FALSE},
+		{200, 50, DRAW_OR16, FALSE},
+		{96, 100, DRAW_MASKED32, FALSE},
+		{200, 50, DRAW_INV16, FALSE},
+		{400, 300, DRAW_XOR32, FALSE},
+		{96, 100, DRAW_MASKED32, TRUE},
+		{200, 50, DRAW_COPY16, FALSE},
+		{96, 100, DRAW_XOR32, FALSE}
+	};
+
+	puts(tstDrawList(args, entries, sizeof(entries) / sizeof(entries[0]), 1) ?
+		 "The test has succeeded." :
+		 "The test has failed.");
+}
+
+/**
+ * @brief Tests draw_list() when more bitmaps are queued than the list can hold
+ * at once.
+ * @details The expected results are that the list is drawn as it fills up, so
+ * that every bitmap is still plotted.
+ * 
+ * @param args The list of arguments required by the function.
+ * 
+ * - base: The location in memory to plot at.
+ */
+void t4DrawList(ArgList *args)
+{
+	DrawTstEntry entries[MAX_DRAW_TST_ENTRIES];
+	int          index;
+
+	for (index = 0; index < MAX_DRAW_TST_ENTRIES; index++)
+	{
+		entries[index].x = (index % 16) * 40;
+		entries[index].y = (index / 16) * 80;
+		entries[index].mode = (DrawMode)(index % NUM_DRAW_MODES);
+		entries[index].fixed = FALSE;
+	}
+
+	puts(tstDrawList(args, entries, MAX_DRAW_TST_ENTRIES, 0) ?
+		 "The test has succeeded." :
+		 "The test has failed.");
+}
+
+/**
+ * @brief Queues bitmaps on a DrawList, draws it and checks that the screen
+ * holds the same bytes as a copy that had the bitmaps plotted in order by
+ * refDraw().
+ * 
+ * @param args The list of arguments passed to the test.
+ * @param entries The bitmaps to queue, in order.
+ * @param numEntries The number of bitmaps to queue.
+ * @param numFixed The number of times that drawTstFixed() should be used.
+ * @return TRUE if the screen matched the copy and drawTstFixed() was used as
+ * often as expected; FALSE otherwise.
+ */
+BOOL tstDrawList(ArgList *args, const DrawTstEntry entries[], int numEntries,
+				 int numFixed)
+{
+	UINT32* const base = (UINT32 *)getArgFromList("base", args);
+
+	const void* bitmap;
+	int         index;
+	BOOL        passed;
+
+	initGridTstBitmap();
+	initMaskedTstBitmap();
+
+	for (index = 0; index < GRID_TST_HEIGHT; index++)
+	{
+		gridTstBitmap16[index] = (UINT16)(gridTstBitmap[index] >> 8);
+	}
+
+	fillRowPattern(base);
+	memcpy(refScrn, base, SCRN_BYTES);
+
+	drawTstBase = base;
+	numDrawTstFixed = 0;
+	init_draw_list(&drawTstList, base);
+
+	for (index = 0; index < numEntries; index++)
+	{
+		if (entries[index].mode == DRAW_MASKED32)
+		{
+			bitmap = maskedTstBitmap;
+		}
+		else if (entries[index].mode >= DRAW_OR16)
+		{
+			bitmap = gridTstBitmap16;
+		}
+		else
+		{
+			bitmap = gridTstBitmap;
+		}
+
+		add_fixed_draw(&drawTstList,
+					   entries[index].fixed ? drawTstFixed : NULL, bitmap,
+					   entries[index].x, entries[index].y, GRID_TST_HEIGHT,
+					   entries[index].mode);
+
+		refDraw(refScrn, entries[index].x, entries[index].y,
+				entries[index].mode);
+	}
+
+	draw_list(&drawTstList);
+
+	passed = chkSameScrn(base, refScrn);
+
+	if (numDrawTstFixed != numFixed)
+	{
+		printf("The fixed routine was used %i times rather than %i.\n",
+			   numDrawTstFixed, numFixed);
+		passed = FALSE;
+	}
+
+	return passed;
+}
+
+/**
+ * @brief Plots the bitmap that tstDrawList() queues in the given mode straight
+ * away, for draw_list() to be checked against.
+ * 
+ * @param base The location in memory to plot at.
+ * @param x The left-most column to begin to plot the bitmap.
+ * @param y The top-most row to begin to plot the bitmap.
+ * @param mode The way in which the bitmap is to be plotted.
+ */
+void refDraw(UINT32* const base, int x, int y, DrawMode mode)
+{
+	if (mode == DRAW_MASKED32)
+	{
+		plot_masked32(base, x, y, GRID_TST_HEIGHT, maskedTstBitmap);
+	}
+	else if (mode >= DRAW_OR16)
+	{
+		bind_rast16((RastMode)(mode - DRAW_OR16))((UINT16 *)base, x, y,
+												  GRID_TST_HEIGHT,
+												  gridTstBitmap16);
+	}
+	else
+	{
+		bind_rast32((RastMode)mode)(base, x, y, GRID_TST_HEIGHT,
+									gridTstBitmap);
+	}
+}
+
+/**
+ * @brief A fixed routine for the masked test bitmap (see add_fixed_draw()).
+ * @details It works out where on drawTstBase it was asked to plot, plots the
+ * masked bitmap there and counts how many times it has been used.
+ * 
+ * @param dest The word on screen where the top-left corner of the bitmap should
+ * be.
+ */
+void drawTstFixed(UINT16* const dest)
+{
+	const int OFFSET = dest - (UINT16 *)drawTstBase;
+
+	plot_masked32(drawTstBase, (OFFSET % SCRN_LEN_WORDS) << DIV_SHIFT_BY_16,
+				  OFFSET / SCRN_LEN_WORDS, GRID_TST_HEIGHT, maskedTstBitmap);
+
+	numDrawTstFixed++;
+}
+
+/**
+ * @brief Fills gridTstBitmap with a pattern that is different on every row and
+ * has bits set and clear in both of its words.
+ */
+void initGridTstBitmap(void)
+{
+	int row;
+
+	for (row = 0; row < GRID_TST_HEIGHT; row++)
+	{
+		gridTstBitmap[row] = 0x8001F00FUL ^ ((UINT32)(row + 1) * 0x01020409UL);
+	}
+}
+
+/**
+ * @brief Fills maskedTstBitmap with a mask and an image that are different on
+ * every row and overlap in some places but not others.
+ */
+void initMaskedTstBitmap(void)
+{
+	int row;
+
+	for (row = 0; row < GRID_TST_HEIGHT; row++)
+	{
+		maskedTstBitmap[row * MASKED_ROW_LONGS] =
+			0x0FF0F00FUL ^ ((UINT32)(row + 1) * 0x00810204UL);
+		maskedTstBitmap[row * MASKED_ROW_LONGS + 1] =
+			0x3C3C00FFUL ^ ((UINT32)(row + 3) * 0x02040801UL);
+	}
 }
\ No newline at end of file
@@ -0,0 +1,200 @@
+/**
+ * @file tst_cspr.c
+ * @author Academia Team
+ * @brief Contains functions aimed at testing the compiled sprites.
+ * @details Every compiled sprite is plotted on the screen, while the bitmap it
+ * was generated from is plotted on a copy of the screen with plot_rast32() or
+ * plot_masked32(). The two must then hold the same bytes.
+ *
+ * @copyright Copyright Academia Team 2023
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "arg_list.h"
+#include "bitmaps.h"
+#include "bool.h"
+#include "cspr.h"
+#include "move.h"
+#include "raster.h"
+#include "scrn.h"
+#include "test.h"
+#include "tst_hndl.h"
+#include "tst_rast.h"
+#include "types.h"
+
+/**
+ * @brief The frame buffer that the bitmaps are plotted to, so that they can be
+ * compared against the compiled sprites.
+ */
+UINT32 refScrn[SCRN_LONGS];
+
+void t1Cspr(ArgList *args);
+void t2Cspr(ArgList *args);
+void t3Cspr(ArgList *args);
+
+BOOL tstCspr(ArgList *args, const char* name, DrawFixedFn cspr,
+			 const UINT32* const bitmap, BOOL masked, int height);
+
+int main(int argc, char **argv)
+{
+	TestSuiteID suiteID;
+
+	suiteID = registerTestSuite("Tests the compiled sprites against the bitmaps they were generated from.",
+								rastTstWhite);
+
+	registerTestCase(suiteID,
+					 "Checks that every cell sprite plots the same as its bitmap copied with plot_rast32().",
+					 NULL, t1Cspr);
+
+	registerTestCase(suiteID,
+					 "Checks that both car sprites plot the same as their masked bitmaps.",
+					 NULL, t2Cspr);
+
+	registerTestCase(suiteID,
+					 "Checks that every part of the train sprite plots the same as its masked bitmap.",
+					 NULL, t3Cspr);
+
+	handleTests();
+
+	return 0;
+}
+
+/**
+ * @brief Tests the compiled sprites of the cells.
+ * @details The expected results are that each of them writes exactly what
+ * plot_rast32() does when it destructively plots the cell bitmap.
+ *
+ * @param args The list of arguments required by the function.
+ *
+ * - base: The location in memory to plot at.
+ */
+void t1Cspr(ArgList *args)
+{
+	BOOL passed;
+
+	passed = tstCspr(args, "grass", cspr_grass, getGrassBitmap(NULL), FALSE,
+					 GRASS_CELL_HEIGHT);
+	passed &= tstCspr(args, "hedge", cspr_hedge, getHedgeBitmap(NULL), FALSE,
+					  HEDGE_CELL_HEIGHT);
+	passed &= tstCspr(args, "road", cspr_road, getRoadBitmap(NULL), FALSE,
+					  ROAD_CELL_HEIGHT);
+	passed &= tstCspr(args, "spike", cspr_spike, getSpikeBitmap(NULL), FALSE,
+					  SPIKE_CELL_HEIGHT);
+	passed &= tstCspr(args, "track", cspr_track, getTrackBitmap(NULL), FALSE,
+					  TRACK_CELL_HEIGHT);
+
+	puts(passed ? "The test has succeeded." : "The test has failed.");
+}
+
+/**
+ * @brief Tests the compiled sprites of the car.
+ * @details The expected results are that each of them writes exactly what
+ * plot_masked32() does with the masked car bitmap facing the same way.
+ *
+ * @param args The list of arguments required by the function.
+ *
+ * - base: The location in memory to plot at.
+ */
+void t2Cspr(ArgList *args)
+{
+	BOOL passed;
+
+	passed = tstCspr(args, "car_w", cspr_car_w, getCarMasked(M_WEST, NULL),
+					 TRUE, CAR_HEIGHT);
+	passed &= tstCspr(args, "car_e", cspr_car_e, getCarMasked(M_EAST, NULL),
+					  TRUE, CAR_HEIGHT);
+
+	puts(passed ? "The test has succeeded." : "The test has failed.");
+}
+
+/**
+ * @brief Tests the compiled sprites of the train.
+ * @details The expected results are that each of them writes exactly what
+ * plot_masked32() does with the same part of the masked train bitmap.
+ *
+ * @param args The list of arguments required by the function.
+ *
+ * - base: The location in memory to plot at.
+ */
+void t3Cspr(ArgList *args)
+{
+	const UINT32* const train1 = getTrainMasked(NULL);
+	const UINT32* const train2 = getTrainMasked(NULL);
+	const UINT32* const train3 = getTrainMasked(NULL);
+
+	BOOL passed;
+
+	/* Resets the train iterator back to the first part. */
+	getTrainMasked(NULL);
+
+	passed = tstCspr(args, "train1", cspr_train1, train1, TRUE, TRAIN_HEIGHT);
+	passed &= tstCspr(args, "train2", cspr_train2, train2, TRUE,
+					  TRAIN_HEIGHT);
+	passed &= tstCspr(args, "train3", cspr_train3, train3, TRUE,
+					  TRAIN_HEIGHT);
+
+	puts(passed ? "The test has succeeded." : "The test has failed.");
+}
+
+/**
+ * @brief Plots a compiled sprite at the corners and the middle of the screen
+ * and checks that the screen holds the same bytes as a copy that had the
+ * bitmap it was generated from plotted at the same place.
+ * @details The screen is covered by a pattern that differs on every row first,
+ * so that anything the sprite leaves behind or wrongly clears shows up.
+ *
+ * @param args The list of arguments passed to the test.
+ * @param name The name of the compiled sprite, without its "cspr_" prefix.
+ * @param cspr The compiled sprite.
+ * @param bitmap The bitmap that the sprite was generated from.
+ * @param masked Whether bitmap is a masked bitmap (see plot_masked32()) rather
+ * than one that is copied to the screen.
+ * @param height The height of the bitmap.
+ * @return TRUE if the screen matched the copy at every position; FALSE
+ * otherwise.
+ */
+BOOL tstCspr(ArgList *args, const char* name, DrawFixedFn cspr,
+			 const UINT32* const bitmap, BOOL masked, int height)
+{
+	const int xs[] = {0, 16, RAST32_MID_VIS_X, RAST32_MAX_VIS_X};
+	const int ys[] = {0, RAST32H_MID_VIS_Y, RAST32H_MAX_VIS_Y};
+	const int NUM_XS = sizeof(xs) / sizeof(xs[0]);
+	const int NUM_YS = sizeof(ys) / sizeof(ys[0]);
+
+	UINT32* const base = (UINT32 *)getArgFromList("base", args);
+
+	int  xIndex;
+	int  yIndex;
+	BOOL passed = TRUE;
+
+	for (yIndex = 0; yIndex < NUM_YS && passed; yIndex++)
+	{
+		for (xIndex = 0; xIndex < NUM_XS && passed; xIndex++)
+		{
+			fillRowPattern(base);
+			memcpy(refScrn, base, SCRN_BYTES);
+
+			cspr(csprDest(base, xs[xIndex], ys[yIndex]));
+
+			if (masked)
+			{
+				plot_masked32(refScrn, xs[xIndex], ys[yIndex], height, bitmap);
+			}
+			else
+			{
+				plot_rast32(refScrn, xs[xIndex], ys[yIndex], height, bitmap,
+							DESTRUCT_ON, BLACK_SCREEN_OFF);
+			}
+
+			if (!(passed = chkSameScrn(base, refScrn)))
+			{
+				printf("cspr_%s was plotted at (%i, %i).\n", name, xs[xIndex],
+					   ys[yIndex]);
+			}
+		}
+	}
+
+	return passed;
+}
\ No newline at end of file
@@ -0,0 +1,611 @@
+/**
+ * @file tst_dmg.c
+ * @author Academia Team
+ * @brief Contains functions aimed at testing the damage tracking.
+ * @details The cells that should be damaged are worked out one cell at a time
+ * by checking if an area overlaps it, rather than with the masks used by the
+ * damage tracking itself. Frame buffers are copied between plain arrays, so
+ * every test runs in an instant and gives the same results every time.
+ *
+ * @copyright Copyright Academia Team 2023
+ */
+
+#include <stdio.h>
+
+#include "arg_list.h"
+#include "bool.h"
+#include "damage.h"
+#include "input.h"
+#include "scrn.h"
+#include "test.h"
+#include "tst_hndl.h"
+#include "types.h"
+#include "vector.h"
+
+/**
+ * @brief The number of longs past the end of the frame buffer copied to that
+ * are checked for being left alone.
+ * @details Covers the part of the bottom row of cells that lies off screen.
+ */
+#define DMG_GUARD_LONGS (SCRN_LEN_LONG * DAMAGE_CELL_LEN)
+
+/**
+ * @brief The frame buffers that the copy_damaged() tests copy from and to,
+ * along with a copy of the one copied to taken before anything was copied.
+ */
+UINT32 dmgSrc[SCRN_LONGS];
+UINT32 dmgDest[SCRN_LONGS + DMG_GUARD_LONGS];
+UINT32 dmgOrig[SCRN_LONGS + DMG_GUARD_LONGS];
+
+void damageTstMgr(void (*tstFunc)(ArgList *args));
+
+void t1Damage(ArgList *args);
+void t2Damage(ArgList *args);
+void t3Damage(ArgList *args);
+void t4Damage(ArgList *args);
+void t5Damage(ArgList *args);
+
+BOOL chkAreas(const int areas[][4], int numAreas, FILE *stream);
+BOOL chkCopy(const int areas[][4], int numAreas, FILE *stream);
+BOOL chkDamage(const Damage* const actual, const Damage* const expected,
+			   FILE *stream);
+void refDamage(Damage* const expected, const int areas[][4], int numAreas);
+BOOL cellTouched(const int area[4], int row, int col);
+void outResult(BOOL passed, FILE *stream);
+
+int main(int argc, char **argv)
+{
+	TestSuiteID suiteID;
+
+	suiteID = registerTestSuite("Tests the damage tracking.", damageTstMgr);
+
+	registerTestCase(suiteID,
+					 "Checks that an area damages exactly the cells it touches, once it is cropped to the screen.",
+					 NULL, t1Damage);
+
+	registerTestCase(suiteID,
+					 "Checks that areas add to the damage already recorded, and that merged damage holds the cells of both.",
+					 NULL, t2Damage);
+
+	registerTestCase(suiteID,
+					 "Checks that only the damaged cells are copied between frame buffers, and nothing past the bottom of the screen.",
+					 NULL, t3Damage);
+
+	registerTestCase(suiteID,
+					 "Checks that the damage since a frame buffer was composed is the damage of the newest frames, for every age that is remembered.",
+					 NULL, t4Damage);
+
+	registerTestCase(suiteID,
+					 "Checks that an age of zero or one older than the history remembers asks for a full redraw.",
+					 NULL, t5Damage);
+
+	handleTests();
+
+	return 0;
+}
+
+/**
+ * @brief Sets up an environment for testing the damage tracking.
+ * @details It ensures that a test doesn't end until a key is pressed.
+ *
+ * @param tstFunc The function to test the damage tracking.
+ */
+void damageTstMgr(void (*tstFunc)(ArgList *args))
+{
+	ArgList args;
+	Vector origKybd = initKybd();
+	IKBD_Scancode scancode;
+
+	initArgList(&args);
+
+	tstFunc(&args);
+
+	while ((scancode = getKey()) == NO_KEY);
+
+	restoreKybd(origKybd);
+}
+
+/**
+ * @brief Checks if a single area damages exactly the cells it touches,
+ * whether it lies inside a cell, across several cells, partly off the screen
+ * or entirely off it.
+ *
+ * @param args Holds a list of arguments. (Unused)
+ */
+void t1Damage(ArgList *args)
+{
+	const int areas[][4] =
+	{
+		{0, 1, 0, 1},
+		{31, 2, 31, 2},
+		{32, 32, 32, 32},
+		{33, 30, 33, 30},
+		{100, 300, 150, 1},
+		{-10, 20, -10, 20},
+		{630, 40, 390, 40},
+		{SCRN_MAX_X, 1, SCRN_MAX_Y, 1},
+		{0, SCRN_LEN, 0, SCRN_HEIGHT},
+		{-50, 50, 100, 10},
+		{SCRN_LEN, 10, 100, 10},
+		{100, 10, -50, 50},
+		{100, 10, SCRN_HEIGHT, 16},
+		{100, 0, 100, 10},
+		{100, 10, 100, 0}
+	};
+	const int NUM_AREAS = sizeof(areas) / sizeof(areas[0]);
+
+	int  index;
+	BOOL passed = TRUE;
+
+	for (index = 0; index < NUM_AREAS; index++)
+	{
+		passed &= chkAreas(&areas[index], 1, stdout);
+	}
+
+	outResult(passed, stdout);
+}
+
+/**
+ * @brief Checks if areas add to the damage already recorded rather than
+ * replacing it, and if merge_damage() and count_damaged() take in every cell
+ * damaged by either Damage.
+ *
+ * @param args Holds a list of arguments. (Unused)
+ */
+void t2Damage(ArgList *args)
+{
+	const int firstAreas[][4] =
+	{
+		{0, 1, 0, 1},
+		{40, 100, 40, 10},
+		{600, 40, 380, 20}
+	};
+	const int secondAreas[][4] =
+	{
+		{20, 20, 20, 20},
+		{0, SCRN_LEN, 200, 1},
+		{300, 1, 0, SCRN_HEIGHT}
+	};
+	const int NUM_FIRST = sizeof(firstAreas) / sizeof(firstAreas[0]);
+	const int NUM_SECOND = sizeof(secondAreas) / sizeof(secondAreas[0]);
+
+	Damage first;
+	Damage second;
+	Damage expected;
+	Damage expectedSecond;
+
+	int  index;
+	int  count;
+	int  row;
+	int  col;
+	BOOL passed;
+
+	passed = chkAreas(firstAreas, NUM_FIRST, stdout);
+	passed &= chkAreas(secondAreas, NUM_SECOND, stdout);
+
+	clear_damage(&first);
+	clear_damage(&second);
+
+	for (index = 0; index < NUM_FIRST; index++)
+	{
+		add_damage(&first, firstAreas[index][0], firstAreas[index][1],
+				   firstAreas[index][2], firstAreas[index][3]);
+	}
+
+	for (index = 0; index < NUM_SECOND; index++)
+	{
+		add_damage(&second, secondAreas[index][0], secondAreas[index][1],
+				   secondAreas[index][2], secondAreas[index][3]);
+	}
+
+	merge_damage(&first, &second);
+
+	refDamage(&expected, firstAreas, NUM_FIRST);
+	refDamage(&expectedSecond, secondAreas, NUM_SECOND);
+
+	for (row = 0, count = 0; row < DAMAGE_ROWS; row++)
+	{
+		expected.rows[row] |= expectedSecond.rows[row];
+
+		for (col = 0; col < DAMAGE_COLS; col++)
+		{
+			count += (expected.rows[row] >> col) & 1;
+		}
+	}
+
+	if (!chkDamage(&first, &expected, stdout) ||
+		!chkDamage(&second, &expectedSecond, stdout))
+	{
+		puts("The merged damage was wrong.");
+		passed = FALSE;
+	}
+
+	if (count_damaged(&first) != count)
+	{
+		printf("%i cells were counted instead of %i.\n",
+			   count_damaged(&first), count);
+		passed = FALSE;
+	}
+
+	clear_damage(&first);
+
+	if (count_damaged(&first) != 0)
+	{
+		puts("Cleared damage still held damaged cells.");
+		passed = FALSE;
+	}
+
+	outResult(passed, stdout);
+}
+
+/**
+ * @brief Checks if copy_damaged() copies every damaged cell and nothing else,
+ * whether the damaged cells are on their own, in runs, in rows damaged across
+ * the entire screen or in the bottom row, which is only partly on screen.
+ *
+ * @param args Holds a list of arguments. (Unused)
+ */
+void t3Damage(ArgList *args)
+{
+	const int singleCell[][4] = {{0, 1, 0, 1}};
+	const int runs[][4] =
+	{
+		{40, 260, 40, 1},
+		{352, 1, 40, 1},
+		{600, 1, 40, 1},
+		{0, 1, 40, 1}
+	};
+	const int fullRows[][4] =
+	{
+		{0, SCRN_LEN, 64, 96},
+		{100, 100, 160, 1}
+	};
+	const int bottomRows[][4] = {{0, SCRN_LEN, 360, 40}};
+	const int bottomCells[][4] =
+	{
+		{SCRN_MAX_X, 1, SCRN_MAX_Y, 1},
+		{0, 64, 390, 10}
+	};
+	const int fullScreen[][4] = {{0, SCRN_LEN, 0, SCRN_HEIGHT}};
+
+	BOOL passed;
+
+	passed = chkCopy(singleCell, 0, stdout);
+	passed &= chkCopy(singleCell, 1, stdout);
+	passed &= chkCopy(runs, sizeof(runs) / sizeof(runs[0]), stdout);
+	passed &= chkCopy(fullRows, sizeof(fullRows) / sizeof(fullRows[0]),
+					  stdout);
+	passed &= chkCopy(bottomRows, 1, stdout);
+	passed &= chkCopy(bottomCells, sizeof(bottomCells) / sizeof(bottomCells[0]),
+					  stdout);
+	passed &= chkCopy(fullScreen, 1, stdout);
+
+	outResult(passed, stdout);
+}
+
+/**
+ * @brief Checks if damage_since() gives the damage of exactly the newest age
+ * frames for every age from one to MAX_DAMAGE_AGE, including once more frames
+ * have been pushed than the history remembers.
+ *
+ * @param args Holds a list of arguments. (Unused)
+ */
+void t4Damage(ArgList *args)
+{
+	const int NUM_FRAMES = MAX_DAMAGE_AGE + 2;
+
+	DamageHistory history;
+	Damage        frame;
+	Damage        actual;
+	Damage        expected;
+
+	int  index;
+	int  age;
+	BOOL passed = TRUE;
+
+	init_damage_history(&history);
+
+	if (!damage_since(&history, MAX_DAMAGE_AGE, &actual) ||
+		count_damaged(&actual) != 0)
+	{
+		puts("A new history held damaged cells.");
+		passed = FALSE;
+	}
+
+	/* Every frame damages a different cell along the diagonal. */
+	for (index = 0; index < NUM_FRAMES; index++)
+	{
+		clear_damage(&frame);
+		add_damage(&frame, index * DAMAGE_CELL_LEN, 1,
+				   index * DAMAGE_CELL_LEN, 1);
+		push_damage(&history, &frame);
+	}
+
+	for (age = 1; age <= MAX_DAMAGE_AGE; age++)
+	{
+		clear_damage(&expected);
+
+		for (index = NUM_FRAMES - age; index < NUM_FRAMES; index++)
+		{
+			expected.rows[index] = 1ul << index;
+		}
+
+		if (!damage_since(&history, age, &actual) ||
+			!chkDamage(&actual, &expected, stdout))
+		{
+			printf("The damage since %i frames ago was wrong.\n", age);
+			passed = FALSE;
+		}
+	}
+
+	outResult(passed, stdout);
+}
+
+/**
+ * @brief Checks if damage_since() reports that a frame buffer has to be
+ * redrawn when its contents are unknown or it was composed longer ago than
+ * the history remembers.
+ *
+ * @param args Holds a list of arguments. (Unused)
+ */
+void t5Damage(ArgList *args)
+{
+	const int ages[] = {-1, 0, MAX_DAMAGE_AGE + 1, MAX_DAMAGE_AGE + 10};
+	const int NUM_AGES = sizeof(ages) / sizeof(ages[0]);
+
+	DamageHistory history;
+	Damage        frame;
+	Damage        actual;
+
+	int  index;
+	BOOL passed = TRUE;
+
+	init_damage_history(&history);
+	clear_damage(&frame);
+	add_damage(&frame, 0, SCRN_LEN, 0, SCRN_HEIGHT);
+
+	for (index = 0; index < MAX_DAMAGE_AGE; index++)
+	{
+		push_damage(&history, &frame);
+	}
+
+	for (index = 0; index < NUM_AGES; index++)
+	{
+		if (damage_since(&history, ages[index], &actual))
+		{
+			printf("The damage since %i frames ago was given.\n",
+				   ages[index]);
+			passed = FALSE;
+		}
+	}
+
+	if (!damage_since(&history, MAX_DAMAGE_AGE, &actual))
+	{
+		printf("The damage since %i frames ago was not given.\n",
+			   MAX_DAMAGE_AGE);
+		passed = FALSE;
+	}
+
+	outResult(passed, stdout);
+}
+
+/**
+ * @brief Adds areas to a Damage and checks that exactly the cells they touch
+ * are damaged.
+ *
+ * @param areas The areas to add, each given as its left-most column, length,
+ * top-most row and height.
+ * @param numAreas The number of areas to add.
+ * @param stream The stream to write the details of a failure to.
+ * @return TRUE if the right cells were damaged; FALSE otherwise.
+ */
+BOOL chkAreas(const int areas[][4], int numAreas, FILE *stream)
+{
+	Damage actual;
+	Damage expected;
+
+	int  index;
+	BOOL passed;
+
+	clear_damage(&actual);
+
+	for (index = 0; index < numAreas; index++)
+	{
+		add_damage(&actual, areas[index][0], areas[index][1], areas[index][2],
+				   areas[index][3]);
+	}
+
+	refDamage(&expected, areas, numAreas);
+
+	if (!(passed = chkDamage(&actual, &expected, stream)))
+	{
+		for (index = 0; index < numAreas; index++)
+		{
+			fprintf(stream, "An area at (%i, %i) was %i by %i.\n",
+					areas[index][0], areas[index][2], areas[index][1],
+					areas[index][3]);
+		}
+	}
+
+	return passed;
+}
+
+/**
+ * @brief Damages the given areas, copies the damaged cells from one frame
+ * buffer to another and checks that every long copied lies in a damaged cell
+ * while every long in a damaged cell was copied.
+ *
+ * @param areas The areas to damage, each given as its left-most column,
+ * length, top-most row and height.
+ * @param numAreas The number of areas to damage.
+ * @param stream The stream to write the details of a failure to.
+ * @return TRUE if exactly the damaged cells were copied; FALSE otherwise.
+ */
+BOOL chkCopy(const int areas[][4], int numAreas, FILE *stream)
+{
+	Damage damage;
+	Damage expected;
+
+	int    index;
+	int    y;
+	int    col;
+	UINT32 value;
+	BOOL   passed = TRUE;
+
+	clear_damage(&damage);
+
+	for (index = 0; index < numAreas; index++)
+	{
+		add_damage(&damage, areas[index][0], areas[index][1], areas[index][2],
+				   areas[index][3]);
+	}
+
+	refDamage(&expected, areas, numAreas);
+
+	for (index = 0; index < SCRN_LONGS + DMG_GUARD_LONGS; index++)
+	{
+		if (index < SCRN_LONGS)
+		{
+			dmgSrc[index] = 0x5A0FF0A5ul ^ ((UINT32)index * 0x01030507ul);
+		}
+
+		dmgDest[index] = dmgOrig[index] = 0x3C00C3FFul ^
+										  ((UINT32)index * 0x00070301ul);
+	}
+
+	copy_damaged(dmgDest, dmgSrc, &damage);
+
+	for (index = 0; index < SCRN_LONGS + DMG_GUARD_LONGS && passed; index++)
+	{
+		y = index / SCRN_LEN_LONG;
+		col = index % SCRN_LEN_LONG;
+
+		value = (y < SCRN_HEIGHT &&
+				 (expected.rows[y / DAMAGE_CELL_LEN] >> col) & 1 ?
+				 dmgSrc[index] : dmgOrig[index]);
+
+		if (dmgDest[index] != value)
+		{
+			fprintf(stream, "The long at column %i of row %i was %s.\n", col,
+					y, value == dmgSrc[index] ? "not copied" : "copied");
+			passed = FALSE;
+		}
+	}
+
+	return passed;
+}
+
+/**
+ * @brief Checks that two Damages hold the same damaged cells.
+ * @details The first row of cells that differs is reported.
+ *
+ * @param actual The Damage worked out by the damage tracking.
+ * @param expected The Damage that was expected.
+ * @param stream The stream to write the details of a failure to.
+ * @return TRUE if the Damages are the same; FALSE otherwise.
+ */
+BOOL chkDamage(const Damage* const actual, const Damage* const expected,
+			   FILE *stream)
+{
+	int row;
+
+	for (row = 0; row < DAMAGE_ROWS; row++)
+	{
+		if (actual->rows[row] != expected->rows[row])
+		{
+			fprintf(stream, "Row %i of cells was %08lX instead of %08lX.\n",
+					row, actual->rows[row], expected->rows[row]);
+			return FALSE;
+		}
+	}
+
+	return TRUE;
+}
+
+/**
+ * @brief Works out the cells damaged by the given areas a cell at a time.
+ *
+ * @param expected Returns the damaged cells.
+ * @param areas The areas, each given as its left-most column, length,
+ * top-most row and height.
+ * @param numAreas The number of areas.
+ */
+void refDamage(Damage* const expected, const int areas[][4], int numAreas)
+{
+	int row;
+	int col;
+	int index;
+
+	for (row = 0; row < DAMAGE_ROWS; row++)
+	{
+		expected->rows[row] = 0;
+
+		for (col = 0; col < DAMAGE_COLS; col++)
+		{
+			for (index = 0; index < numAreas; index++)
+			{
+				if (cellTouched(areas[index], row, col))
+				{
+					expected->rows[row] |= 1ul << col;
+				}
+			}
+		}
+	}
+}
+
+/**
+ * @brief Determines if the part of an area that lies on the screen overlaps a
+ * cell.
+ *
+ * @param area The area, given as its left-most column, length, top-most row
+ * and height.
+ * @param row The row of the cell.
+ * @param col The column of the cell.
+ * @return TRUE if the area touches the cell; FALSE otherwise.
+ */
+BOOL cellTouched(const int area[4], int row, int col)
+{
+	const int CELL_X = col * DAMAGE_CELL_LEN;
+	const int CELL_Y = row * DAMAGE_CELL_LEN;
+
+	int x1 = area[0];
+	int x2 = area[0] + area[1] - 1;
+	int y1 = area[2];
+	int y2 = area[2] + area[3] - 1;
+
+	if (x1 < 0)
+	{
+		x1 = 0;
+	}
+
+	if (x2 > SCRN_MAX_X)
+	{
+		x2 = SCRN_MAX_X;
+	}
+
+	if (y1 < 0)
+	{
+		y1 = 0;
+	}
+
+	if (y2 > SCRN_MAX_Y)
+	{
+		y2 = SCRN_MAX_Y;
+	}
+
+	return x1 <= x2 && y1 <= y2 &&
+		   x1 < CELL_X + DAMAGE_CELL_LEN && x2 >= CELL_X &&
+		   y1 < CELL_Y + DAMAGE_CELL_LEN && y2 >= CELL_Y;
+}
+
+/**
+ * @brief Outputs whether a test has succeeded or failed.
+ *
+ * @param passed Whether the test has succeeded.
+ * @param stream The stream to write the result to.
+ */
+void outResult(BOOL passed, FILE *stream)
+{
+	fputs(passed ? "The test has succeeded.\n" : "The test has failed.\n",
+		  stream);
+}
\ No newline at end of file
@@ -7,6 +7,7 @@
  */
 
 #include <stdio.h>
+#include <string.h>
 
 #include "arg_list.h"
 #include "events.h"
@@ -29,8 +30,12 @@ void t3ScoreBox(ArgList *args);
 void t4ScoreBox(ArgList *args);
 void t5ScoreBox(ArgList *args);
 void t6ScoreBox(ArgList *args);
+void t7ScoreBox(ArgList *args);
+void t8ScoreBox(ArgList *args);
+void t9ScoreBox(ArgList *args);
 
 void outScoreInfo(Score *scoreBox, FILE *stream);
+void outScoreBcd(const UINT8 bcd[], FILE *stream);
 
 void t1LivesBox(ArgList *args);
 void t2LivesBox(ArgList *args);
@@ -89,6 +94,18 @@ int main(int argc, char **argv)
 					 "Checks for a carry error if the score is incremented by one after holding the maximum possible score.",
 					 NULL, t6ScoreBox);
 
+	registerTestCase(suiteID,
+					 "Checks that adding one in BCD carries out of each of the lower digits of a score.",
+					 NULL, t7ScoreBox);
+
+	registerTestCase(suiteID,
+					 "Checks that adding one in BCD to a score of all nines rolls every digit over to zero.",
+					 NULL, t8ScoreBox);
+
+	registerTestCase(suiteID,
+					 "Checks that the BCD form of a score matches its binary value as the score is incremented.",
+					 NULL, t9ScoreBox);
+
 	suiteID = registerTestSuite("Tests the Lives Box.", modelTstMgr);
 
 	registerTestCase(suiteID,
@@ -274,6 +291,106 @@ void t6ScoreBox(ArgList *args)
 	printf("The score has a value of %lu.\n", scoreBox.value);
 }
 
+/**
+ * @brief Checks if adding one to a BCD value that ends in a run of nines
+ * carries out of each digit in turn, for every digit but the most significant.
+ * 
+ * @param args Holds a list of arguments. (Unused)
+ */
+void t7ScoreBox(ArgList *args)
+{
+	UINT8 sum[SCORE_BCD_BYTES];
+	UINT8 one[SCORE_BCD_BYTES];
+	UINT8 expected[SCORE_BCD_BYTES];
+
+	UINT32 power;
+	int    place;
+	BOOL   passed = TRUE;
+
+	toScoreBcd(1, one);
+
+	for (place = 1, power = 10; place < SCORE_DIGITS; place++, power *= 10)
+	{
+		toScoreBcd(power - 1, sum);
+		addScoreBcd(sum, one);
+		toScoreBcd(power, expected);
+
+		if (memcmp(sum, expected, SCORE_BCD_BYTES) != 0)
+		{
+			printf("Adding one to %lu gave ", power - 1);
+			outScoreBcd(sum, stdout);
+			putchar('\n');
+			passed = FALSE;
+		}
+	}
+
+	puts(passed ? "The test has succeeded." : "The test has failed.");
+}
+
+/**
+ * @brief Checks if adding one to a BCD value of all nines rolls every digit
+ * over to zero, dropping the carry out of the most significant digit.
+ * 
+ * @param args Holds a list of arguments. (Unused)
+ */
+void t8ScoreBox(ArgList *args)
+{
+	UINT8 sum[SCORE_BCD_BYTES];
+	UINT8 one[SCORE_BCD_BYTES];
+	UINT8 expected[SCORE_BCD_BYTES];
+
+	memset(sum, 0x99, SCORE_BCD_BYTES);
+	memset(expected, 0, SCORE_BCD_BYTES);
+	toScoreBcd(1, one);
+	addScoreBcd(sum, one);
+
+	puts(memcmp(sum, expected, SCORE_BCD_BYTES) != 0 ?
+		 "The test has failed." :
+		 "The test has succeeded.");
+	fputs("The sum is ", stdout);
+	outScoreBcd(sum, stdout);
+	puts(".");
+}
+
+/**
+ * @brief Checks if the BCD form of a score always matches its binary value
+ * while the score is incremented by amounts of varying length, up to and
+ * including the point where it saturates at the maximum possible score.
+ * 
+ * @param args Holds a list of arguments. (Unused)
+ */
+void t9ScoreBox(ArgList *args)
+{
+	Score  scoreBox;
+	UINT8  expected[SCORE_BCD_BYTES];
+	UINT32 increment;
+	BOOL   passed = TRUE;
+
+	initScore(0, 0, &scoreBox);
+
+	/* Each increment has one more digit than the last and is added a few times
+	   over, so that carries happen between digits of every length. */
+	for (increment = 7; scoreBox.value < UINT32_MAX;
+		 increment = increment * 10 + 3)
+	{
+		updateScore(increment, &scoreBox);
+		updateScore(increment, &scoreBox);
+		updateScore(increment, &scoreBox);
+		toScoreBcd(scoreBox.value, expected);
+
+		if (memcmp(scoreBox.bcd, expected, SCORE_BCD_BYTES) != 0)
+		{
+			printf("The score %lu is held in BCD as ", scoreBox.value);
+			outScoreBcd(scoreBox.bcd, stdout);
+			putchar('\n');
+			passed = FALSE;
+		}
+	}
+
+	puts(passed ? "The test has succeeded." : "The test has failed.");
+	printf("The score has a value of %lu.\n", scoreBox.value);
+}
+
 /**
  * @brief Outputs information about the individual components of the given
  * scoreBox to the given stream.
@@ -309,6 +426,23 @@ void outScoreInfo(Score *scoreBox, FILE *stream)
 	}
 }
 
+/**
+ * @brief Outputs every digit of a packed BCD score, leading zeros included, to
+ * the given stream.
+ * 
+ * @param bcd The packed BCD score. Holds SCORE_BCD_BYTES bytes.
+ * @param stream The stream to write the digits to.
+ */
+void outScoreBcd(const UINT8 bcd[], FILE *stream)
+{
+	int index;
+
+	for (index = 0; index < SCORE_BCD_BYTES; index++)
+	{
+		fprintf(stream, "%x%x", bcd[index] >> 4, bcd[index] & 0x0F);
+	}
+}
+
 /**
  * @brief Displays the text and location of a Lives Box associated with a
  * recently initialized player.
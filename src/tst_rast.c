@@ -18,6 +18,7 @@
 
 void rastTstCommon(void (*tstFunc)(ArgList *args), BOOL blackScreen,
 				   BOOL enableGridDots, BOOL destructive);
+UINT32 rowPattern(int row, int col);
 void gridDots(UINT32 *base);
 void off_curs(void);
 void on_curs(void);
@@ -52,6 +53,141 @@ void rastGDTstBlack(void (*tstFunc)(ArgList *args))
 	rastTstCommon(tstFunc, BLACK_SCREEN_ON, GRID_DOTS_ON, DESTRUCT_ON);
 }
 
+BOOL pixelSet(const UINT32* const base, int x, int y)
+{
+	const UINT8* const bytes = (const UINT8 *)base;
+
+	return (bytes[y * SCRN_LEN_BYTES + (x >> 3)] & (0x80 >> (x & 7))) != 0;
+}
+
+void putPixel(UINT32* const base, int x, int y, BOOL set)
+{
+	UINT8* const bytes = (UINT8 *)base;
+	const UINT8  bit   = 0x80 >> (x & 7);
+
+	if (x >= 0 && x < SCRN_LEN && y >= 0 && y < SCRN_HEIGHT)
+	{
+		if (set)
+		{
+			bytes[y * SCRN_LEN_BYTES + (x >> 3)] |= bit;
+		}
+		else
+		{
+			bytes[y * SCRN_LEN_BYTES + (x >> 3)] &= ~bit;
+		}
+	}
+}
+
+BOOL chkSameScrn(const UINT32* const actual, const UINT32* const expected)
+{
+	const UINT8* const actualBytes   = (const UINT8 *)actual;
+	const UINT8* const expectedBytes = (const UINT8 *)expected;
+
+	int index;
+
+	for (index = 0; index < SCRN_BYTES; index++)
+	{
+		if (actualBytes[index] != expectedBytes[index])
+		{
+			printf("The byte at (%i, %i) should be 0x%02X, not 0x%02X.\n",
+				   (index % SCRN_LEN_BYTES) << 3, index / SCRN_LEN_BYTES,
+				   expectedBytes[index], actualBytes[index]);
+			return FALSE;
+		}
+	}
+
+	return TRUE;
+}
+
+BOOL chkSpanRows(const UINT32* const base, int x1, int x2, int y, int height,
+				 BOOL blackScreen)
+{
+	int  row;
+	int  col;
+	BOOL inSpan;
+	BOOL expected;
+
+	for (row = (y > 0 ? y - 1 : 0);
+		 row <= y + height && row < SCRN_HEIGHT; row++)
+	{
+		for (col = 0; col < SCRN_LEN; col++)
+		{
+			inSpan = (row >= y && row < y + height && col >= x1 && col <= x2);
+
+			/* The grid dots are toggled, so they are clear on a black screen. */
+			if (inSpan)
+			{
+				expected = !blackScreen;
+			}
+			else
+			{
+				expected = (blackScreen !=
+							(row % 16 == 0 && col % 32 == 31));
+			}
+
+			if (pixelSet(base, col, row) != expected)
+			{
+				printf("The pixel at (%i, %i) should be %s.\n", col, row,
+					   expected ? "set" : "clear");
+				return FALSE;
+			}
+		}
+	}
+
+	return TRUE;
+}
+
+void fillRowPattern(UINT32* const base)
+{
+	int row;
+	int col;
+
+	for (row = 0; row < SCRN_HEIGHT; row++)
+	{
+		for (col = 0; col < SCRN_LEN_LONG; col++)
+		{
+			base[row * SCRN_LEN_LONG + col] = rowPattern(row, col);
+		}
+	}
+}
+
+BOOL chkScrolled(const UINT32* const base, int top, int bottom, int distance)
+{
+	int row;
+	int srcRow;
+	int col;
+
+	for (row = 0; row < SCRN_HEIGHT; row++)
+	{
+		srcRow = (row >= top + distance && row <= bottom ? row - distance :
+				  row);
+
+		for (col = 0; col < SCRN_LEN_LONG; col++)
+		{
+			if (base[row * SCRN_LEN_LONG + col] != rowPattern(srcRow, col))
+			{
+				printf("Row %i should hold what was on row %i.\n", row,
+					   srcRow);
+				return FALSE;
+			}
+		}
+	}
+
+	return TRUE;
+}
+
+/**
+ * @brief Gives the long that fillRowPattern() puts at a given place on screen.
+ * 
+ * @param row The row of the long (in pixels starting at zero).
+ * @param col The column of the long (in longs starting at zero).
+ * @return The long at that place.
+ */
+UINT32 rowPattern(int row, int col)
+{
+	return ((UINT32)row << 16) | ((UINT32)col << 8) | 0xA5;
+}
+
 /**
  * @brief Contains the common functionality shared by all the raster test
  * manager functions.
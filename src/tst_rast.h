@@ -12,6 +12,7 @@
 
 #include "arg_list.h"
 #include "bool.h"
+#include "types.h"
 
 #define CLEAR_ON  TRUE
 #define CLEAR_OFF FALSE
@@ -73,4 +74,82 @@ void rastGDTstBlack(void (*tstFunc)(ArgList *args));
  */
 void rastTstBlackPerserve(void (*tstFunc)(ArgList *args));
 
+/**
+ * @brief Determines if a pixel on screen is set.
+ * 
+ * @param base The location in memory of the start of the frame buffer.
+ * @param x The column of the pixel (in pixels starting at zero).
+ * @param y The row of the pixel (in pixels starting at zero).
+ * @return TRUE if the pixel is set (black); FALSE otherwise.
+ */
+BOOL pixelSet(const UINT32* const base, int x, int y);
+
+/**
+ * @brief Sets or clears a pixel on screen, without going through any of the
+ * raster functions under test.
+ * @details Pixels that lie off screen are ignored.
+ * 
+ * @param base The location in memory of the start of the frame buffer.
+ * @param x The column of the pixel (in pixels starting at zero).
+ * @param y The row of the pixel (in pixels starting at zero).
+ * @param set Whether the pixel should be set (black) rather than cleared.
+ */
+void putPixel(UINT32* const base, int x, int y, BOOL set);
+
+/**
+ * @brief Checks that two frame buffers hold the same image, byte for byte.
+ * @details The first byte that differs is written to stdout.
+ * 
+ * @param actual The frame buffer that was plotted to by the function under
+ * test.
+ * @param expected The frame buffer holding what actual should hold.
+ * @return TRUE if every byte of both frame buffers is the same; FALSE
+ * otherwise.
+ */
+BOOL chkSameScrn(const UINT32* const actual, const UINT32* const expected);
+
+/**
+ * @brief Checks that a span was filled on a screen set up with grid dots,
+ * without touching anything around it.
+ * @details Every row of the span, along with the rows just above and below it,
+ * is checked from one side of the screen to the other. Pixels outside of the
+ * span must still hold the background (see rastGDTstWhite() and
+ * rastGDTstBlack()). The first pixel that is wrong is written to stdout.
+ * 
+ * @param base The location in memory of the start of the frame buffer.
+ * @param x1 The left-most column of the span.
+ * @param x2 The right-most column of the span.
+ * @param y The top-most row of the span.
+ * @param height The number of rows in the span.
+ * @param blackScreen Whether the background is black, in which case the span
+ * should have been cleared rather than set.
+ * @return TRUE if the span and the rows around it are as expected; FALSE
+ * otherwise.
+ */
+BOOL chkSpanRows(const UINT32* const base, int x1, int x2, int y, int height,
+				 BOOL blackScreen);
+
+/**
+ * @brief Fills the entire screen with a pattern that is different on every row,
+ * so that rows which have been moved can be told apart.
+ * 
+ * @param base The location in memory of the start of the frame buffer.
+ */
+void fillRowPattern(UINT32* const base);
+
+/**
+ * @brief Checks that a screen filled by fillRowPattern() holds what it should
+ * once a block of its rows has been scrolled down.
+ * @details The rows of the block that were scrolled over must hold the rows
+ * from distance rows above them, while every other row must be as it was. The
+ * first row that is wrong is written to stdout.
+ * 
+ * @param base The location in memory of the start of the frame buffer.
+ * @param top The top-most row of the block.
+ * @param bottom The bottom-most row of the block.
+ * @param distance The number of rows that the block was scrolled down by.
+ * @return TRUE if every row on screen is as expected; FALSE otherwise.
+ */
+BOOL chkScrolled(const UINT32* const base, int top, int bottom, int distance);
+
 #endif
@@ -7,6 +7,9 @@
  * @copyright Copyright Academia Team 2023
  */
 
+#include <stdio.h>
+#include <string.h>
+
 #include "bool.h"
 #include "raster.h"
 #include "scrn.h"
@@ -91,6 +94,42 @@ void t11ClrArea(ArgList *args);
 void t12ClrArea(ArgList *args);
 void t13ClrArea(ArgList *args);
 
+void regSpanFillTests(BOOL blackScreen);
+void t1SpanFill(ArgList *args);
+void t2SpanFill(ArgList *args);
+void t3SpanFill(ArgList *args);
+void t4SpanFill(ArgList *args);
+void t5SpanFill(ArgList *args);
+BOOL tstSpan(ArgList *args, int x1, int x2, int y, int height);
+
+void regScrollDownTests(void);
+void t1ScrollDown(ArgList *args);
+void t2ScrollDown(ArgList *args);
+void t3ScrollDown(ArgList *args);
+void t4ScrollDown(ArgList *args);
+void t5ScrollDown(ArgList *args);
+BOOL tstScroll(ArgList *args, int top, int bottom, int distance);
+
+/**
+ * @brief The SaveList that the save_area() tests save backgrounds on.
+ */
+SaveList saveTstList;
+
+/**
+ * @brief A copy of the screen taken before any background is saved.
+ */
+UINT32 origScrn[SCRN_LONGS];
+
+void regSaveAreaTests(void);
+void t1SaveArea(ArgList *args);
+void t2SaveArea(ArgList *args);
+void t3SaveArea(ArgList *args);
+void t4SaveArea(ArgList *args);
+void t5SaveArea(ArgList *args);
+BOOL tstSaves(ArgList *args, const int areas[][4], int numAreas,
+			  int numSaved);
+BOOL longSaved(const int areas[][4], int numAreas, int row, int col);
+
 int main(int argc, char **argv)
 {
 	regPlotPxTests(BLACK_SCREEN_OFF);
@@ -99,6 +138,10 @@ int main(int argc, char **argv)
 	regHlineTests();
 	regRectAreaTests();
 	regClrAreaTests();
+	regSpanFillTests(BLACK_SCREEN_OFF);
+	regSpanFillTests(BLACK_SCREEN_ON);
+	regScrollDownTests();
+	regSaveAreaTests();
 
 	handleTests();
 
@@ -1493,4 +1536,673 @@ void t13ClrArea(ArgList *args)
 
 	clr_area((UINT32 *)getArgFromList("base", args), 0, RECT_LEN, 0,
 			  RECT_HEIGHT);
+}
+
+/**
+ * @brief Handle the registration of all tests related to the span_fill()
+ * function.
+ * @details Unlike the other tests, these check their own results, since a
+ * missing pixel at the edge of a span is hard to spot.
+ * 
+ * @param blackScreen Whether the tests registered should set spans on a white
+ * screen or clear them on a black one.
+ */
+void regSpanFillTests(BOOL blackScreen)
+{
+	TestSuiteID suiteID;
+
+	if (blackScreen)
+	{
+		suiteID = registerTestSuite("Tests clearing spans on a black surface.",
+									rastGDTstBlack);
+	}
+	else
+	{
+		suiteID = registerTestSuite("Tests setting spans on a white surface.",
+									rastGDTstWhite);
+	}
+
+	registerTestCase(suiteID,
+					 "When the span starts at every possible offset within a long.",
+					 NULL, t1SpanFill);
+
+	registerTestCase(suiteID,
+					 "When the span ends at every possible offset within its last long.",
+					 NULL, t2SpanFill);
+
+	registerTestCase(suiteID,
+					 "When the span starts and ends within the same long.",
+					 NULL, t3SpanFill);
+
+	registerTestCase(suiteID,
+					 "When the number of whole longs in the middle of the span is around the burst length of 13.",
+					 NULL, t4SpanFill);
+
+	registerTestCase(suiteID,
+					 "When the span takes up the entire length of the screen, or all but one pixel of it.",
+					 NULL, t5SpanFill);
+}
+
+/**
+ * @brief Tests span_fill() when the span starts at every possible offset
+ * within a long.
+ * @details The expected results are that 32 spans are filled, each starting
+ * one pixel further right than the one above it and all ending at the same
+ * column.
+ * 
+ * @param args The list of arguments required by the function.
+ * 
+ * - base: The location in memory to plot at.
+ * - blackScreen: Whether the spans are cleared rather than set.
+ */
+void t1SpanFill(ArgList *args)
+{
+	int  offset;
+	BOOL passed = TRUE;
+
+	for (offset = 0; offset < 32 && passed; offset++)
+	{
+		passed = tstSpan(args, 64 + offset, 407, 8 + offset * 12, 5);
+	}
+
+	puts(passed ? "The test has succeeded." : "The test has failed.");
+}
+
+/**
+ * @brief Tests span_fill() when the span ends at every possible offset within
+ * its last long.
+ * @details The expected results are that 32 spans are filled, all starting at
+ * the same column and each ending one pixel further right than the one above
+ * it.
+ * 
+ * @param args The list of arguments required by the function.
+ * 
+ * - base: The location in memory to plot at.
+ * - blackScreen: Whether the spans are cleared rather than set.
+ */
+void t2SpanFill(ArgList *args)
+{
+	int  offset;
+	BOOL passed = TRUE;
+
+	for (offset = 0; offset < 32 && passed; offset++)
+	{
+		passed = tstSpan(args, 40, 320 + offset, 8 + offset * 12, 5);
+	}
+
+	puts(passed ? "The test has succeeded." : "The test has failed.");
+}
+
+/**
+ * @brief Tests span_fill() when the span starts and ends within the same long.
+ * @details The expected results are that 32 narrow spans are filled, each
+ * starting one pixel further right than the one above it. The last of them is
+ * a single pixel wide.
+ * 
+ * @param args The list of arguments required by the function.
+ * 
+ * - base: The location in memory to plot at.
+ * - blackScreen: Whether the spans are cleared rather than set.
+ */
+void t3SpanFill(ArgList *args)
+{
+	int  offset;
+	BOOL passed = TRUE;
+
+	for (offset = 0; offset < 32 && passed; offset++)
+	{
+		passed = tstSpan(args, 160 + offset, 160 + offset + (31 - offset) / 2,
+						 8 + offset * 12, 5);
+	}
+
+	puts(passed ? "The test has succeeded." : "The test has failed.");
+}
+
+/**
+ * @brief Tests span_fill() when the number of whole longs in the middle of the
+ * span is around the number written by each movem burst.
+ * @details The expected results are that 19 spans are filled, with from 0 up
+ * to 18 whole longs between their partial ends.
+ * 
+ * @param args The list of arguments required by the function.
+ * 
+ * - base: The location in memory to plot at.
+ * - blackScreen: Whether the spans are cleared rather than set.
+ */
+void t4SpanFill(ArgList *args)
+{
+	const int MAX_MIDDLE_LONGS = SCRN_LEN_LONG - 2;
+
+	int  middleLongs;
+	BOOL passed = TRUE;
+
+	for (middleLongs = 0; middleLongs <= MAX_MIDDLE_LONGS && passed;
+		 middleLongs++)
+	{
+		passed = tstSpan(args, 7, (middleLongs + 1) * 32 + 20,
+						 8 + middleLongs * 20, 8);
+	}
+
+	puts(passed ? "The test has succeeded." : "The test has failed.");
+}
+
+/**
+ * @brief Tests span_fill() when the span takes up the entire length of the
+ * screen, or all but one pixel of it.
+ * @details The expected results are that a block of rows is filled from one
+ * side of the screen to the other, followed by two blocks that each leave a
+ * single column at one side of the screen untouched.
+ * 
+ * @param args The list of arguments required by the function.
+ * 
+ * - base: The location in memory to plot at.
+ * - blackScreen: Whether the spans are cleared rather than set.
+ */
+void t5SpanFill(ArgList *args)
+{
+	BOOL passed;
+
+	passed = tstSpan(args, 0, SCRN_MAX_X, 100, 50) &&
+			 tstSpan(args, 0, SCRN_MAX_X - 1, 200, 10) &&
+			 tstSpan(args, 1, SCRN_MAX_X, 250, 10);
+
+	puts(passed ? "The test has succeeded." : "The test has failed.");
+}
+
+/**
+ * @brief Fills a span with span_fill() and checks the result.
+ * 
+ * @param args The list of arguments passed to the test.
+ * @param x1 The left-most column of the span.
+ * @param x2 The right-most column of the span.
+ * @param y The top-most row of the span.
+ * @param height The number of rows in the span.
+ * @return TRUE if the span was filled correctly; FALSE otherwise.
+ */
+BOOL tstSpan(ArgList *args, int x1, int x2, int y, int height)
+{
+	UINT32* const base = (UINT32 *)getArgFromList("base", args);
+	const BOOL blackScreen = *(BOOL *)getArgFromList("blackScreen", args);
+
+	span_fill(base, x1, x2, y, height, !blackScreen);
+
+	return chkSpanRows(base, x1, x2, y, height, blackScreen);
+}
+
+/**
+ * @brief Handle the registration of all tests related to the scroll_down()
+ * function.
+ * @details These tests check their own results. The screen is covered by a
+ * pattern that differs on every row, so it is expected to look like noise.
+ */
+void regScrollDownTests(void)
+{
+	TestSuiteID suiteID;
+
+	suiteID = registerTestSuite("Tests scrolling rows down the screen.",
+								rastTstWhite);
+
+	registerTestCase(suiteID,
+					 "When part of the screen is scrolled down by a single row.",
+					 NULL, t1ScrollDown);
+
+	registerTestCase(suiteID,
+					 "When part of the screen is scrolled down by the height of a row of the world.",
+					 NULL, t2ScrollDown);
+
+	registerTestCase(suiteID,
+					 "When a block is scrolled down by one row less than its height, so only one row is moved.",
+					 NULL, t3ScrollDown);
+
+	registerTestCase(suiteID,
+					 "When a block is scrolled down by its height or more, so nothing is moved.",
+					 NULL, t4ScrollDown);
+
+	registerTestCase(suiteID,
+					 "When the entire screen is scrolled down.",
+					 NULL, t5ScrollDown);
+}
+
+/**
+ * @brief Tests scroll_down() when part of the screen is scrolled down by a
+ * single row.
+ * @details The expected results are that rows 100 to 298 move down a row,
+ * while every other row is left as it was.
+ * 
+ * @param args The list of arguments required by the function.
+ * 
+ * - base: The location in memory to plot at.
+ */
+void t1ScrollDown(ArgList *args)
+{
+	puts(tstScroll(args, 100, 299, 1) ?
+		 "The test has succeeded." :
+		 "The test has failed.");
+}
+
+/**
+ * @brief Tests scroll_down() when part of the screen is scrolled down by the
+ * height of a row of the world.
+ * @details The expected results are that rows 64 to 335 move down by 32 rows,
+ * while every other row is left as it was.
+ * 
+ * @param args The list of arguments required by the function.
+ * 
+ * - base: The location in memory to plot at.
+ */
+void t2ScrollDown(ArgList *args)
+{
+	puts(tstScroll(args, 64, 367, 32) ?
+		 "The test has succeeded." :
+		 "The test has failed.");
+}
+
+/**
+ * @brief Tests scroll_down() when a block is scrolled down by one row less
+ * than its height.
+ * @details The expected results are that row 200 is copied to row 209, while
+ * every other row is left as it was.
+ * 
+ * @param args The list of arguments required by the function.
+ * 
+ * - base: The location in memory to plot at.
+ */
+void t3ScrollDown(ArgList *args)
+{
+	puts(tstScroll(args, 200, 209, 9) ?
+		 "The test has succeeded." :
+		 "The test has failed.");
+}
+
+/**
+ * @brief Tests scroll_down() when a block is scrolled down by its height or
+ * more.
+ * @details The expected results are that no row is changed at all.
+ * 
+ * @param args The list of arguments required by the function.
+ * 
+ * - base: The location in memory to plot at.
+ */
+void t4ScrollDown(ArgList *args)
+{
+	puts(tstScroll(args, 200, 209, 10) && tstScroll(args, 200, 209, 20) ?
+		 "The test has succeeded." :
+		 "The test has failed.");
+}
+
+/**
+ * @brief Tests scroll_down() when the entire screen is scrolled down.
+ * @details The expected results are that rows 0 to 383 move down by 16 rows,
+ * while the top 16 rows are left as they were.
+ * 
+ * @param args The list of arguments required by the function.
+ * 
+ * - base: The location in memory to plot at.
+ */
+void t5ScrollDown(ArgList *args)
+{
+	puts(tstScroll(args, 0, SCRN_MAX_Y, 16) ?
+		 "The test has succeeded." :
+		 "The test has failed.");
+}
+
+/**
+ * @brief Covers the screen with a pattern that differs on every row, scrolls
+ * a block of it down with scroll_down() and checks the result.
+ * 
+ * @param args The list of arguments passed to the test.
+ * @param top The top-most row of the block.
+ * @param bottom The bottom-most row of the block.
+ * @param distance The number of rows to scroll the block down by.
+ * @return TRUE if the rows were scrolled correctly; FALSE otherwise.
+ */
+BOOL tstScroll(ArgList *args, int top, int bottom, int distance)
+{
+	UINT32* const base = (UINT32 *)getArgFromList("base", args);
+
+	fillRowPattern(base);
+	scroll_down(base, top, bottom, distance);
+
+	return chkScrolled(base, top, bottom, distance);
+}
+
+/**
+ * @brief Handle the registration of all tests related to the save_area() and
+ * restore_saves() functions.
+ * @details These tests check their own results. The screen is covered by a
+ * pattern that differs on every row, so it is expected to look like noise.
+ */
+void regSaveAreaTests(void)
+{
+	TestSuiteID suiteID;
+
+	suiteID = registerTestSuite("Tests saving and restoring the background under sprites.",
+								rastTstWhite);
+
+	registerTestCase(suiteID,
+					 "When single areas are saved, including ones that are not long aligned.",
+					 NULL, t1SaveArea);
+
+	registerTestCase(suiteID,
+					 "When areas that overlap are plotted over one after another.",
+					 NULL, t2SaveArea);
+
+	registerTestCase(suiteID,
+					 "When areas lie partly or entirely off the screen.",
+					 NULL, t3SaveArea);
+
+	registerTestCase(suiteID,
+					 "When more areas are saved than the list can hold.",
+					 NULL, t4SaveArea);
+
+	registerTestCase(suiteID,
+					 "When the areas saved need more room than the pool of the list has.",
+					 NULL, t5SaveArea);
+}
+
+/**
+ * @brief Tests save_area() and restore_saves() with single areas that lie on
+ * the screen.
+ * @details The expected results are that every long that the area touches is
+ * put back as it was, while the rest of the screen is left alone.
+ * 
+ * @param args The list of arguments required by the function.
+ * 
+ * - base: The location in memory to plot at.
+ */
+void t1SaveArea(ArgList *args)
+{
+	const int areas[][4] =
+	{
+		{0, 32, 0, 32},
+		{37, 32, 50, 32},
+		{31, 2, 100, 1},
+		{64, 1, 200, 8},
+		{200, 240, 300, 100}
+	};
+	const int NUM_AREAS = sizeof(areas) / sizeof(areas[0]);
+
+	int  index;
+	BOOL passed = TRUE;
+
+	for (index = 0; index < NUM_AREAS; index++)
+	{
+		passed &= tstSaves(args, &areas[index], 1, 1);
+	}
+
+	puts(passed ? "The test has succeeded." : "The test has failed.");
+}
+
+/**
+ * @brief Tests restore_saves() when areas that overlap are saved and plotted
+ * over one after another.
+ * @details Every area after the first saves part of what was plotted over the
+ * ones before it. The expected results are that the screen is put back
+ * exactly as it was before anything was plotted, which only happens if the
+ * areas are restored in the reverse of the order they were saved.
+ * 
+ * @param args The list of arguments required by the function.
+ * 
+ * - base: The location in memory to plot at.
+ */
+void t2SaveArea(ArgList *args)
+{
+	const int areas[][4] =
+	{
+		{40, 32, 60, 32},
+		{50, 32, 70, 32},
+		{45, 20, 65, 5}
+	};
+	const int NUM_AREAS = sizeof(areas) / sizeof(areas[0]);
+
+	UINT32* const base = (UINT32 *)getArgFromList("base", args);
+
+	int  index;
+	BOOL passed = TRUE;
+
+	fillRowPattern(base);
+	memcpy(origScrn, base, SCRN_BYTES);
+	init_save_list(&saveTstList, base);
+
+	for (index = 0; index < NUM_AREAS; index++)
+	{
+		passed &= save_area(&saveTstList, areas[index][0], areas[index][1],
+							areas[index][2], areas[index][3]);
+		rect_area(base, areas[index][0], areas[index][1], areas[index][2],
+				  areas[index][3]);
+	}
+
+	passed &= restore_saves(&saveTstList);
+	passed &= chkSameScrn(base, origScrn);
+
+	puts(passed ? "The test has succeeded." : "The test has failed.");
+}
+
+/**
+ * @brief Tests save_area() when areas lie partly or entirely off the screen.
+ * @details The expected results are that only the part of an area on the
+ * screen is saved and put back, and that an area entirely off the screen (or
+ * with no length or height) is accepted without anything being saved.
+ * 
+ * @param args The list of arguments required by the function.
+ * 
+ * - base: The location in memory to plot at.
+ */
+void t3SaveArea(ArgList *args)
+{
+	const int areas[][4] =
+	{
+		{-10, 32, -10, 32},
+		{620, 40, 390, 32},
+		{-31, 32, 200, 16},
+		{SCRN_MAX_X, 32, 100, 1},
+		{-40, 32, 100, 32},
+		{SCRN_LEN, 32, 100, 32},
+		{100, 32, -40, 32},
+		{100, 32, SCRN_HEIGHT, 32},
+		{100, 0, 100, 32},
+		{100, 32, 100, 0}
+	};
+	const int NUM_AREAS = sizeof(areas) / sizeof(areas[0]);
+
+	puts(tstSaves(args, areas, NUM_AREAS, NUM_AREAS) ?
+		 "The test has succeeded." :
+		 "The test has failed.");
+}
+
+/**
+ * @brief Tests save_area() when more areas are saved than a SaveList can hold.
+ * @details The expected results are that the area after the last one that
+ * fits is not saved and leaves the list incomplete, that restore_saves()
+ * still puts back every area that was saved but reports that the list was
+ * not complete, and that the list can be used as normal afterwards.
+ * 
+ * @param args The list of arguments required by the function.
+ * 
+ * - base: The location in memory to plot at.
+ */
+void t4SaveArea(ArgList *args)
+{
+	const int lastArea[][4] = {{300, 32, 180, 32}};
+
+	int areas[MAX_SAVED_AREAS + 2][4];
+
+	int  index;
+	BOOL passed;
+
+	for (index = 0; index < MAX_SAVED_AREAS + 2; index++)
+	{
+		areas[index][0] = (index % 16) * 40 + 3;
+		areas[index][1] = 20;
+		areas[index][2] = (index / 16) * 50 + 7;
+		areas[index][3] = 10;
+	}
+
+	passed = tstSaves(args, (const int (*)[4])areas, MAX_SAVED_AREAS + 2,
+					  MAX_SAVED_AREAS);
+	passed &= tstSaves(args, lastArea, 1, 1);
+
+	puts(passed ? "The test has succeeded." : "The test has failed.");
+}
+
+/**
+ * @brief Tests save_area() when the areas saved need more room than the pool
+ * of a SaveList has.
+ * @details The first three areas fill the pool exactly. The expected results
+ * are that they are saved and put back, while the areas after them (and an
+ * area larger than the whole pool) are not saved and leave the list
+ * incomplete.
+ * 
+ * @param args The list of arguments required by the function.
+ * 
+ * - base: The location in memory to plot at.
+ */
+void t5SaveArea(ArgList *args)
+{
+	const int poolAreas[][4] =
+	{
+		{0, 128, 0, 256},
+		{128, 128, 0, 256},
+		{256, 128, 0, 256},
+		{400, 1, 300, 1}
+	};
+	const int NUM_POOL_AREAS = sizeof(poolAreas) / sizeof(poolAreas[0]);
+
+	const int screenArea[][4] = {{0, SCRN_LEN, 0, SCRN_HEIGHT}};
+
+	BOOL passed;
+
+	passed = tstSaves(args, poolAreas, NUM_POOL_AREAS, NUM_POOL_AREAS - 1);
+	passed &= tstSaves(args, screenArea, 1, 0);
+
+	puts(passed ? "The test has succeeded." : "The test has failed.");
+}
+
+/**
+ * @brief Saves the background of the given areas, changes every pixel on the
+ * screen, restores the backgrounds and checks the result.
+ * @details The screen is covered by a pattern that differs on every row before
+ * anything is saved. Afterwards, every long that one of the saved areas
+ * touches must hold the pattern again, while every other long must still be
+ * changed.
+ * 
+ * @param args The list of arguments passed to the test.
+ * @param areas The areas to save, each given as its left-most column, length,
+ * top-most row and height.
+ * @param numAreas The number of areas to save.
+ * @param numSaved The number of areas expected to be saved before the list
+ * runs out of room.
+ * @return TRUE if the areas were saved and restored correctly; FALSE
+ * otherwise.
+ */
+BOOL tstSaves(ArgList *args, const int areas[][4], int numAreas,
+			  int numSaved)
+{
+	UINT32* const base = (UINT32 *)getArgFromList("base", args);
+
+	int  index;
+	int  row;
+	int  col;
+	BOOL saved;
+	BOOL passed = TRUE;
+
+	fillRowPattern(base);
+	memcpy(origScrn, base, SCRN_BYTES);
+	init_save_list(&saveTstList, base);
+
+	for (index = 0; index < numAreas; index++)
+	{
+		saved = save_area(&saveTstList, areas[index][0], areas[index][1],
+						  areas[index][2], areas[index][3]);
+
+		if (saved != (index < numSaved))
+		{
+			printf("Area %i was %s.\n", index,
+				   saved ? "saved when the list was full" : "not saved");
+			passed = FALSE;
+		}
+	}
+
+	for (index = 0; index < SCRN_LONGS; index++)
+	{
+		base[index] = ~base[index];
+	}
+
+	if (restore_saves(&saveTstList) != (numSaved == numAreas))
+	{
+		printf("restore_saves() did not report that the list was %s.\n",
+			   numSaved == numAreas ? "complete" : "incomplete");
+		passed = FALSE;
+	}
+
+	if (saveTstList.numAreas != 0 || saveTstList.poolUsed != 0 ||
+		!saveTstList.complete)
+	{
+		puts("The list was not emptied.");
+		passed = FALSE;
+	}
+
+	for (row = 0; row < SCRN_HEIGHT && passed; row++)
+	{
+		for (col = 0; col < SCRN_LEN_LONG && passed; col++)
+		{
+			index = row * SCRN_LEN_LONG + col;
+
+			if (base[index] != (longSaved(areas, numSaved, row, col) ?
+								origScrn[index] : ~origScrn[index]))
+			{
+				printf("The long at column %i of row %i is wrong.\n", col,
+					   row);
+				passed = FALSE;
+			}
+		}
+	}
+
+	return passed;
+}
+
+/**
+ * @brief Determines if a long on the screen is touched by any of the given
+ * areas once they are cropped to the screen.
+ * 
+ * @param areas The areas, each given as its left-most column, length,
+ * top-most row and height.
+ * @param numAreas The number of areas.
+ * @param row The row of the long.
+ * @param col The index of the long in its row.
+ * @return TRUE if the long is touched by an area; FALSE otherwise.
+ */
+BOOL longSaved(const int areas[][4], int numAreas, int row, int col)
+{
+	int x1;
+	int x2;
+	int y1;
+	int y2;
+	int index;
+
+	for (index = 0; index < numAreas; index++)
+	{
+		x1 = (areas[index][0] < 0 ? 0 : areas[index][0]);
+		x2 = areas[index][0] + areas[index][1] - 1;
+		y1 = (areas[index][2] < 0 ? 0 : areas[index][2]);
+		y2 = areas[index][2] + areas[index][3] - 1;
+
+		if (x2 > SCRN_MAX_X)
+		{
+			x2 = SCRN_MAX_X;
+		}
+
+		if (y2 > SCRN_MAX_Y)
+		{
+			y2 = SCRN_MAX_Y;
+		}
+
+		if (x1 <= x2 && y1 <= y2 && row >= y1 && row <= y2 &&
+			col >= x1 / 32 && col <= x2 / 32)
+		{
+			return TRUE;
+		}
+	}
+
+	return FALSE;
 }
\ No newline at end of file
@@ -0,0 +1,1121 @@
+/**
+ * @file tst_surf.c
+ * @author Academia Team
+ * @brief Contains functions aimed at testing the routines that plot to a
+ * Surface.
+ * @details Every routine is run on a surface whose memory is covered by a
+ * pattern first. The result expected of it is worked out a pixel at a time on
+ * a copy of the memory, and the two copies must then hold the same bytes. This
+ * way, anything that is plotted outside of the clip rectangle (or the bounds
+ * of the surface) shows up as well.
+ *
+ * @copyright Copyright Academia Team 2023
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "arg_list.h"
+#include "bool.h"
+#include "raster.h"
+#include "scrn.h"
+#include "surface.h"
+#include "test.h"
+#include "tst_hndl.h"
+#include "tst_rast.h"
+#include "types.h"
+
+/**
+ * @brief The height of every bitmap plotted by the tests.
+ */
+#define SURF_TST_HEIGHT 32
+
+/**
+ * @brief The number of columns in the run-length encoded bitmap.
+ */
+#define RLE_TST_COLUMNS 3
+
+/**
+ * @brief The height of the run-length encoded bitmap.
+ */
+#define RLE_TST_HEIGHT 40
+
+/**
+ * @brief The most words that the run-length encoded bitmap can take up, which
+ * is when every row of every column needs its own header.
+ */
+#define RLE_TST_WORDS (RLE_TST_COLUMNS * RLE_TST_HEIGHT * 2)
+
+/**
+ * @brief Determines if a pixel lies inside a clip rectangle.
+ */
+#define inClipRect(rect, x, y) \
+	((x) >= (rect)->left && (x) <= (rect)->right && \
+	 (y) >= (rect)->top && (y) <= (rect)->bottom)
+
+/**
+ * @brief A surface under test along with a copy of it that the expected
+ * results are plotted on.
+ * @details The copy has the same layout as the surface, but lives in refMem
+ * instead of mem.
+ */
+typedef struct
+{
+	Surface surf;
+	Surface ref;
+	UINT32* mem;
+	UINT32* refMem;
+	long    numLongs;
+} SurfTst;
+
+/**
+ * @brief The names of every RastMode, used when a test fails.
+ */
+const char* const rastModeNames[NUM_RAST_MODES] =
+{
+	"RAST_OR", "RAST_XOR", "RAST_COPY", "RAST_COPY_INV"
+};
+
+UINT32 refScrn[SCRN_LONGS];
+
+/**
+ * @brief The memory that guard-banded surfaces (and surfaces smaller than the
+ * screen) are tested on, along with the copy the expected results are plotted
+ * on.
+ */
+UINT32 guardMem[GUARD_SURFACE_LONGS];
+UINT32 refGuardMem[GUARD_SURFACE_LONGS];
+
+UINT32 surfTstBitmap32[SURF_TST_HEIGHT];
+UINT16 surfTstBitmap16[SURF_TST_HEIGHT];
+UINT8  surfTstBitmap8[SURF_TST_HEIGHT];
+UINT32 surfTstMasked[SURF_TST_HEIGHT * MASKED_ROW_LONGS];
+
+/**
+ * @brief The columns of the bitmap that is run-length encoded, along with the
+ * encoded bitmap.
+ */
+UINT16 rleTstColumns[RLE_TST_COLUMNS][RLE_TST_HEIGHT];
+UINT16 rleTstBitmap[RLE_TST_WORDS];
+
+void t1Surf(ArgList *args);
+void t2Surf(ArgList *args);
+void t3Surf(ArgList *args);
+void t4Surf(ArgList *args);
+void t5Surf(ArgList *args);
+void t6Surf(ArgList *args);
+void t7Surf(ArgList *args);
+
+BOOL tstSurfRast(const SurfTst* const tst, const int xs[], int numXs,
+				 const int ys[], int numYs);
+BOOL tstSurfMasked(const SurfTst* const tst, const int xs[], int numXs,
+				   const int ys[], int numYs);
+BOOL tstSurfRle(const SurfTst* const tst, int x, int y);
+
+void initSurfTst(SurfTst* const tst, UINT32* const mem, UINT32* const refMem,
+				 long numLongs);
+void clipRefSurf(SurfTst* const tst, int left, int top, int right,
+				 int bottom);
+void startSurfTst(const SurfTst* const tst);
+BOOL chkSurfTst(const SurfTst* const tst);
+
+BOOL refPixelSet(const Surface* const ref, int x, int y);
+void refPutPixel(const Surface* const ref, int x, int y, BOOL set);
+void refPlot(const Surface* const ref, int x, int y, int width, int height,
+			 const UINT32 rows[], RastMode mode);
+void refMasked(const Surface* const ref, int x, int y, int height,
+			   const UINT32* const masked);
+void refFill(const Surface* const ref, int x1, int x2, int y1, int y2,
+			 BOOL set);
+
+void initSurfTstBitmaps(void);
+void initRleTstBitmap(void);
+
+int main(int argc, char **argv)
+{
+	TestSuiteID suiteID;
+
+	initSurfTstBitmaps();
+	initRleTstBitmap();
+
+	suiteID = registerTestSuite("Tests the routines that plot to a Surface.",
+								rastTstWhite);
+
+	registerTestCase(suiteID,
+					 "Checks that 32, 16 and 8-bit wide bitmaps are plotted in every mode on a screen surface, including past its edges.",
+					 NULL, t1Surf);
+
+	registerTestCase(suiteID,
+					 "Checks that bitmaps are cropped to the clip rectangle of a surface, and to the bounds of a surface narrower than its pitch.",
+					 NULL, t2Surf);
+
+	registerTestCase(suiteID,
+					 "Checks that masked bitmaps plot the same as plot_masked32() on a screen surface and are cropped to a clip rectangle.",
+					 NULL, t3Surf);
+
+	registerTestCase(suiteID,
+					 "Checks that bitmaps inside the guard band of a surface are not clipped, while those that reach past it are.",
+					 NULL, t4Surf);
+
+	registerTestCase(suiteID,
+					 "Checks that a run-length encoded bitmap is decoded in every mode, including when it is clipped.",
+					 NULL, t5Surf);
+
+	registerTestCase(suiteID,
+					 "Checks that lines and rectangles are plotted and cleared within the clip rectangle.",
+					 NULL, t6Surf);
+
+	registerTestCase(suiteID,
+					 "Checks that load_surface() and present_surface() copy only the given rows and leave the guard band alone.",
+					 NULL, t7Surf);
+
+	handleTests();
+
+	return 0;
+}
+
+/**
+ * @brief Tests surf_plot_rast32(), surf_plot_rast16() and surf_plot_rast8() on
+ * a surface that covers the screen.
+ * @details The expected results are that the bitmaps are plotted in every
+ * mode, and that those lying partly or fully off the screen are cropped to it.
+ *
+ * @param args The list of arguments required by the function.
+ *
+ * - base: The location in memory to plot at.
+ */
+void t1Surf(ArgList *args)
+{
+	const int xs[] = {-40, -5, 0, 7, 16, 300, 608, 620, SCRN_LEN};
+	const int ys[] = {-40, -10, 0, 184, 390, SCRN_HEIGHT};
+	const int NUM_XS = sizeof(xs) / sizeof(xs[0]);
+	const int NUM_YS = sizeof(ys) / sizeof(ys[0]);
+
+	UINT32* const base = (UINT32 *)getArgFromList("base", args);
+
+	SurfTst tst;
+
+	initScrnSurface(&tst.surf, base);
+	initSurfTst(&tst, base, refScrn, SCRN_LONGS);
+
+	puts(tstSurfRast(&tst, xs, NUM_XS, ys, NUM_YS) ?
+		 "The test has succeeded." : "The test has failed.");
+}
+
+/**
+ * @brief Tests the raster routines on surfaces whose clip rectangle is smaller
+ * than the surface, and on a surface narrower than its pitch.
+ * @details The expected results are that nothing is plotted outside of the
+ * clip rectangle (which is cropped to the surface when it reaches past it),
+ * that nothing is plotted when the clip rectangle lies off the surface, and
+ * that nothing is plotted past the width of a surface.
+ *
+ * @param args The list of arguments required by the function.
+ *
+ * - base: The location in memory to plot at.
+ */
+void t2Surf(ArgList *args)
+{
+	const int xs[] = {80, 95, 100, 150, 290, 300};
+	const int ys[] = {30, 40, 100, 140};
+	const int NUM_XS = sizeof(xs) / sizeof(xs[0]);
+	const int NUM_YS = sizeof(ys) / sizeof(ys[0]);
+
+	const int edgeXs[] = {-20, 0, 40, 90};
+	const int edgeYs[] = {-10, 340, 380};
+	const int NUM_EDGE_XS = sizeof(edgeXs) / sizeof(edgeXs[0]);
+	const int NUM_EDGE_YS = sizeof(edgeYs) / sizeof(edgeYs[0]);
+
+	const int stripXs[] = {-10, 0, 100, 170, 180, 200};
+	const int stripYs[] = {-20, 0, 30, 47};
+	const int NUM_STRIP_XS = sizeof(stripXs) / sizeof(stripXs[0]);
+	const int NUM_STRIP_YS = sizeof(stripYs) / sizeof(stripYs[0]);
+
+	UINT32* const base = (UINT32 *)getArgFromList("base", args);
+
+	SurfTst tst;
+	BOOL    passed;
+
+	initScrnSurface(&tst.surf, base);
+	clip_surface(&tst.surf, 100, 50, 201, 91);
+	initSurfTst(&tst, base, refScrn, SCRN_LONGS);
+	clipRefSurf(&tst, 100, 50, 300, 140);
+
+	passed = tstSurfRast(&tst, xs, NUM_XS, ys, NUM_YS);
+
+	initScrnSurface(&tst.surf, base);
+	clip_surface(&tst.surf, -30, 350, 100, 100);
+	initSurfTst(&tst, base, refScrn, SCRN_LONGS);
+	clipRefSurf(&tst, 0, 350, 69, SCRN_MAX_Y);
+
+	passed &= tstSurfRast(&tst, edgeXs, NUM_EDGE_XS, edgeYs, NUM_EDGE_YS);
+
+	initScrnSurface(&tst.surf, base);
+	clip_surface(&tst.surf, SCRN_LEN, 0, 100, 100);
+	initSurfTst(&tst, base, refScrn, SCRN_LONGS);
+	clipRefSurf(&tst, SCRN_LEN, 0, SCRN_MAX_X, 99);
+
+	passed &= tstSurfRast(&tst, xs, NUM_XS, ys, NUM_YS);
+
+	init_surface(&tst.surf, guardMem + GUARD_PITCH, GUARD_PITCH, 200, 48);
+	initSurfTst(&tst, guardMem, refGuardMem, GUARD_SURFACE_LONGS);
+
+	passed &= tstSurfRast(&tst, stripXs, NUM_STRIP_XS, stripYs,
+						  NUM_STRIP_YS);
+
+	init_surface(&tst.surf, guardMem + GUARD_PITCH, GUARD_PITCH, 200, 48);
+	clip_surface(&tst.surf, 150, 30, 100, 100);
+	initSurfTst(&tst, guardMem, refGuardMem, GUARD_SURFACE_LONGS);
+	clipRefSurf(&tst, 150, 30, 199, 47);
+
+	passed &= tstSurfRast(&tst, stripXs, NUM_STRIP_XS, stripYs,
+						  NUM_STRIP_YS);
+
+	puts(passed ? "The test has succeeded." : "The test has failed.");
+}
+
+/**
+ * @brief Tests surf_plot_masked32().
+ * @details The expected results are that the masked bitmap plots exactly what
+ * plot_masked32() does on a surface that covers the screen, and that it is
+ * cropped to the clip rectangle of a surface.
+ *
+ * @param args The list of arguments required by the function.
+ *
+ * - base: The location in memory to plot at.
+ */
+void t3Surf(ArgList *args)
+{
+	const int xs[] = {-40, -5, 0, 7, 16, 300, 608, 620, SCRN_LEN};
+	const int ys[] = {-40, -10, 0, 184, 390, SCRN_HEIGHT};
+	const int NUM_XS = sizeof(xs) / sizeof(xs[0]);
+	const int NUM_YS = sizeof(ys) / sizeof(ys[0]);
+
+	const int clipXs[] = {80, 95, 100, 150, 290, 300};
+	const int clipYs[] = {30, 40, 100, 140};
+	const int NUM_CLIP_XS = sizeof(clipXs) / sizeof(clipXs[0]);
+	const int NUM_CLIP_YS = sizeof(clipYs) / sizeof(clipYs[0]);
+
+	UINT32* const base = (UINT32 *)getArgFromList("base", args);
+
+	Surface surf;
+	SurfTst tst;
+
+	int  xIndex;
+	int  yIndex;
+	BOOL passed = TRUE;
+
+	initScrnSurface(&surf, base);
+
+	for (yIndex = 0; yIndex < NUM_YS; yIndex++)
+	{
+		for (xIndex = 0; xIndex < NUM_XS; xIndex++)
+		{
+			fillRowPattern(base);
+			memcpy(refScrn, base, SCRN_BYTES);
+
+			surf_plot_masked32(&surf, xs[xIndex], ys[yIndex], SURF_TST_HEIGHT,
+							   surfTstMasked);
+			plot_masked32(refScrn, xs[xIndex], ys[yIndex], SURF_TST_HEIGHT,
+						  surfTstMasked);
+
+			if (!chkSameScrn(base, refScrn))
+			{
+				printf("The masked bitmap was plotted at (%i, %i).\n",
+					   xs[xIndex], ys[yIndex]);
+				passed = FALSE;
+			}
+		}
+	}
+
+	initScrnSurface(&tst.surf, base);
+	clip_surface(&tst.surf, 100, 50, 201, 91);
+	initSurfTst(&tst, base, refScrn, SCRN_LONGS);
+	clipRefSurf(&tst, 100, 50, 300, 140);
+
+	passed &= tstSurfMasked(&tst, clipXs, NUM_CLIP_XS, clipYs, NUM_CLIP_YS);
+
+	puts(passed ? "The test has succeeded." : "The test has failed.");
+}
+
+/**
+ * @brief Tests the raster routines on a guard-banded surface.
+ * @details The expected results are that bitmaps which lie inside the guard
+ * band are plotted whole (even on the guard band), while bitmaps that reach
+ * past the guard band are cropped to the surface.
+ *
+ * @param args Holds a list of arguments. (Unused)
+ */
+void t4Surf(ArgList *args)
+{
+	const int xs[] = {-70, -64, -20, 0, 300, 620, 672, 680};
+	const int ys[] = {-40, -32, -10, 200, 395, 400, 420};
+	const int NUM_XS = sizeof(xs) / sizeof(xs[0]);
+	const int NUM_YS = sizeof(ys) / sizeof(ys[0]);
+
+	SurfTst tst;
+	BOOL    passed;
+
+	init_guard_surface(&tst.surf, guardMem);
+	initSurfTst(&tst, guardMem, refGuardMem, GUARD_SURFACE_LONGS);
+
+	passed = tstSurfRast(&tst, xs, NUM_XS, ys, NUM_YS);
+	passed &= tstSurfMasked(&tst, xs, NUM_XS, ys, NUM_YS);
+
+	puts(passed ? "The test has succeeded." : "The test has failed.");
+}
+
+/**
+ * @brief Tests surf_plot_rle().
+ * @details The bitmap is made up of runs of blank and filled rows along with
+ * rows that each differ. The expected results are that it is decoded to the
+ * same pixels as its columns would be plotted in every mode, and that it is
+ * cropped to the screen and the clip rectangle of the surface.
+ *
+ * @param args The list of arguments required by the function.
+ *
+ * - base: The location in memory to plot at.
+ */
+void t5Surf(ArgList *args)
+{
+	const int xs[] = {-48, -20, 0, 8, 100, 600};
+	const int ys[] = {-10, 0, 200, 370};
+	const int NUM_XS = sizeof(xs) / sizeof(xs[0]);
+	const int NUM_YS = sizeof(ys) / sizeof(ys[0]);
+
+	UINT32* const base = (UINT32 *)getArgFromList("base", args);
+
+	SurfTst tst;
+
+	int  xIndex;
+	int  yIndex;
+	BOOL passed = TRUE;
+
+	initScrnSurface(&tst.surf, base);
+	initSurfTst(&tst, base, refScrn, SCRN_LONGS);
+
+	for (yIndex = 0; yIndex < NUM_YS; yIndex++)
+	{
+		for (xIndex = 0; xIndex < NUM_XS; xIndex++)
+		{
+			passed &= tstSurfRle(&tst, xs[xIndex], ys[yIndex]);
+		}
+	}
+
+	initScrnSurface(&tst.surf, base);
+	clip_surface(&tst.surf, 110, 205, 20, 20);
+	initSurfTst(&tst, base, refScrn, SCRN_LONGS);
+	clipRefSurf(&tst, 110, 205, 129, 224);
+
+	passed &= tstSurfRle(&tst, 100, 200);
+	passed &= tstSurfRle(&tst, 120, 190);
+
+	puts(passed ? "The test has succeeded." : "The test has failed.");
+}
+
+/**
+ * @brief Tests surf_hline(), surf_rect_area() and surf_clr_area().
+ * @details The expected results are that every pixel of the line or rectangle
+ * inside the clip rectangle is set (or cleared), that the ends of a line may
+ * be given in either order, and that nothing is plotted for a rectangle with
+ * no length or height.
+ *
+ * @param args The list of arguments required by the function.
+ *
+ * - base: The location in memory to plot at.
+ */
+void t6Surf(ArgList *args)
+{
+	const int x1s[] = {-10, 0, 5, 31, 32, 100, 630};
+	const int x2s[] = {0, 31, 40, 63, 64, 645};
+	const int NUM_X1S = sizeof(x1s) / sizeof(x1s[0]);
+	const int NUM_X2S = sizeof(x2s) / sizeof(x2s[0]);
+
+	const int areas[][4] =
+	{
+		{0, SCRN_LEN, 0, SCRN_HEIGHT},
+		{-10, 50, -10, 30},
+		{5, 1, 7, 1},
+		{33, 94, 100, 20},
+		{600, 100, 390, 20},
+		{100, 0, 100, 10},
+		{100, 10, 100, 0},
+		{100, -5, 100, 10}
+	};
+	const int NUM_AREAS = sizeof(areas) / sizeof(areas[0]);
+
+	UINT32* const base = (UINT32 *)getArgFromList("base", args);
+
+	SurfTst tst;
+
+	int  clipped;
+	int  index;
+	int  x2Index;
+	int  left;
+	int  right;
+	BOOL passed = TRUE;
+
+	for (clipped = 0; clipped < 2; clipped++)
+	{
+		initScrnSurface(&tst.surf, base);
+
+		if (clipped)
+		{
+			clip_surface(&tst.surf, 20, 95, 600, 10);
+		}
+
+		initSurfTst(&tst, base, refScrn, SCRN_LONGS);
+
+		if (clipped)
+		{
+			clipRefSurf(&tst, 20, 95, 619, 104);
+		}
+
+		for (index = 0; index < NUM_X1S; index++)
+		{
+			for (x2Index = 0; x2Index < NUM_X2S; x2Index++)
+			{
+				left = (x1s[index] < x2s[x2Index] ? x1s[index] :
+						x2s[x2Index]);
+				right = (x1s[index] < x2s[x2Index] ? x2s[x2Index] :
+						 x1s[index]);
+
+				startSurfTst(&tst);
+				surf_hline(&tst.surf, x1s[index], x2s[x2Index], 100);
+				surf_hline(&tst.surf, x2s[x2Index], x1s[index], 102);
+				refFill(&tst.ref, left, right, 100, 100, TRUE);
+				refFill(&tst.ref, left, right, 102, 102, TRUE);
+
+				if (!chkSurfTst(&tst))
+				{
+					printf("The line was plotted from %i to %i.\n",
+						   x1s[index], x2s[x2Index]);
+					passed = FALSE;
+				}
+			}
+		}
+
+		for (index = 0; index < NUM_AREAS; index++)
+		{
+			startSurfTst(&tst);
+			surf_rect_area(&tst.surf, areas[index][0], areas[index][1],
+						   areas[index][2], areas[index][3]);
+			surf_clr_area(&tst.surf, areas[index][0] + 2, areas[index][1] - 4,
+						  areas[index][2] + 2, areas[index][3] - 4);
+
+			if (areas[index][1] > 0 && areas[index][3] > 0)
+			{
+				refFill(&tst.ref, areas[index][0],
+						areas[index][0] + areas[index][1] - 1, areas[index][2],
+						areas[index][2] + areas[index][3] - 1, TRUE);
+			}
+
+			if (areas[index][1] > 4 && areas[index][3] > 4)
+			{
+				refFill(&tst.ref, areas[index][0] + 2,
+						areas[index][0] + areas[index][1] - 3,
+						areas[index][2] + 2,
+						areas[index][2] + areas[index][3] - 3, FALSE);
+			}
+
+			if (!chkSurfTst(&tst))
+			{
+				printf("The area at (%i, %i) was %i by %i.\n",
+					   areas[index][0], areas[index][2], areas[index][1],
+					   areas[index][3]);
+				passed = FALSE;
+			}
+		}
+	}
+
+	puts(passed ? "The test has succeeded." : "The test has failed.");
+}
+
+/**
+ * @brief Tests load_surface() and present_surface() on a guard-banded surface.
+ * @details The expected results are that only the rows asked for are copied,
+ * and that neither the guard band of the surface nor the rest of the screen
+ * is touched.
+ *
+ * @param args The list of arguments required by the function.
+ *
+ * - base: The location in memory to plot at.
+ */
+void t7Surf(ArgList *args)
+{
+	const int rows[][2] = {{0, 0}, {10, 20}, {SCRN_MAX_Y, SCRN_MAX_Y},
+						   {0, SCRN_MAX_Y}};
+	const int NUM_ROWS = sizeof(rows) / sizeof(rows[0]);
+
+	UINT32* const base = (UINT32 *)getArgFromList("base", args);
+
+	SurfTst tst;
+
+	int  index;
+	int  x;
+	int  y;
+	BOOL passed = TRUE;
+
+	init_guard_surface(&tst.surf, guardMem);
+	initSurfTst(&tst, guardMem, refGuardMem, GUARD_SURFACE_LONGS);
+
+	for (index = 0; index < NUM_ROWS; index++)
+	{
+		startSurfTst(&tst);
+		fillRowPattern(base);
+
+		load_surface(&tst.surf, base, rows[index][0], rows[index][1]);
+
+		for (y = rows[index][0]; y <= rows[index][1]; y++)
+		{
+			for (x = 0; x < SCRN_LEN; x++)
+			{
+				refPutPixel(&tst.ref, x, y, pixelSet(base, x, y));
+			}
+		}
+
+		if (!chkSurfTst(&tst))
+		{
+			printf("Rows %i to %i were loaded.\n", rows[index][0],
+				   rows[index][1]);
+			passed = FALSE;
+		}
+
+		startSurfTst(&tst);
+		memset(base, 0, SCRN_BYTES);
+		memset(refScrn, 0, SCRN_BYTES);
+
+		present_surface(&tst.surf, base, rows[index][0], rows[index][1]);
+
+		for (y = rows[index][0]; y <= rows[index][1]; y++)
+		{
+			for (x = 0; x < SCRN_LEN; x++)
+			{
+				putPixel(refScrn, x, y, refPixelSet(&tst.surf, x, y));
+			}
+		}
+
+		if (!chkSameScrn(base, refScrn))
+		{
+			printf("Rows %i to %i were presented.\n", rows[index][0],
+				   rows[index][1]);
+			passed = FALSE;
+		}
+	}
+
+	puts(passed ? "The test has succeeded." : "The test has failed.");
+}
+
+/**
+ * @brief Plots a 32, 16 and 8-bit wide bitmap in every mode at every
+ * combination of the given positions, and checks each result.
+ *
+ * @param tst The surface to plot on.
+ * @param xs The left-most columns to plot the bitmaps at.
+ * @param numXs The number of columns in xs.
+ * @param ys The top-most rows to plot the bitmaps at.
+ * @param numYs The number of rows in ys.
+ * @return TRUE if every result was as expected; FALSE otherwise.
+ */
+BOOL tstSurfRast(const SurfTst* const tst, const int xs[], int numXs,
+				 const int ys[], int numYs)
+{
+	UINT32 rows16[SURF_TST_HEIGHT];
+	UINT32 rows8[SURF_TST_HEIGHT];
+
+	RastMode mode;
+
+	int  row;
+	int  xIndex;
+	int  yIndex;
+	BOOL passed = TRUE;
+
+	for (row = 0; row < SURF_TST_HEIGHT; row++)
+	{
+		rows16[row] = (UINT32)surfTstBitmap16[row] << 16;
+		rows8[row] = (UINT32)surfTstBitmap8[row] << 24;
+	}
+
+	for (yIndex = 0; yIndex < numYs; yIndex++)
+	{
+		for (xIndex = 0; xIndex < numXs; xIndex++)
+		{
+			for (mode = RAST_OR; mode < NUM_RAST_MODES; mode++)
+			{
+				startSurfTst(tst);
+				surf_plot_rast32(&tst->surf, xs[xIndex], ys[yIndex],
+								 SURF_TST_HEIGHT, surfTstBitmap32, mode);
+				refPlot(&tst->ref, xs[xIndex], ys[yIndex], 32,
+						SURF_TST_HEIGHT, surfTstBitmap32, mode);
+
+				if (!chkSurfTst(tst))
+				{
+					printf("surf_plot_rast32 plotted at (%i, %i) with %s.\n",
+						   xs[xIndex], ys[yIndex], rastModeNames[mode]);
+					passed = FALSE;
+				}
+
+				startSurfTst(tst);
+				surf_plot_rast16(&tst->surf, xs[xIndex], ys[yIndex],
+								 SURF_TST_HEIGHT, surfTstBitmap16, mode);
+				refPlot(&tst->ref, xs[xIndex], ys[yIndex], 16,
+						SURF_TST_HEIGHT, rows16, mode);
+
+				if (!chkSurfTst(tst))
+				{
+					printf("surf_plot_rast16 plotted at (%i, %i) with %s.\n",
+						   xs[xIndex], ys[yIndex], rastModeNames[mode]);
+					passed = FALSE;
+				}
+
+				startSurfTst(tst);
+				surf_plot_rast8(&tst->surf, xs[xIndex], ys[yIndex],
+								SURF_TST_HEIGHT, surfTstBitmap8, mode);
+				refPlot(&tst->ref, xs[xIndex], ys[yIndex], 8,
+						SURF_TST_HEIGHT, rows8, mode);
+
+				if (!chkSurfTst(tst))
+				{
+					printf("surf_plot_rast8 plotted at (%i, %i) with %s.\n",
+						   xs[xIndex], ys[yIndex], rastModeNames[mode]);
+					passed = FALSE;
+				}
+			}
+		}
+	}
+
+	return passed;
+}
+
+/**
+ * @brief Plots a masked bitmap at every combination of the given positions,
+ * and checks each result.
+ *
+ * @param tst The surface to plot on.
+ * @param xs The left-most columns to plot the bitmap at.
+ * @param numXs The number of columns in xs.
+ * @param ys The top-most rows to plot the bitmap at.
+ * @param numYs The number of rows in ys.
+ * @return TRUE if every result was as expected; FALSE otherwise.
+ */
+BOOL tstSurfMasked(const SurfTst* const tst, const int xs[], int numXs,
+				   const int ys[], int numYs)
+{
+	int  xIndex;
+	int  yIndex;
+	BOOL passed = TRUE;
+
+	for (yIndex = 0; yIndex < numYs; yIndex++)
+	{
+		for (xIndex = 0; xIndex < numXs; xIndex++)
+		{
+			startSurfTst(tst);
+			surf_plot_masked32(&tst->surf, xs[xIndex], ys[yIndex],
+							   SURF_TST_HEIGHT, surfTstMasked);
+			refMasked(&tst->ref, xs[xIndex], ys[yIndex], SURF_TST_HEIGHT,
+					  surfTstMasked);
+
+			if (!chkSurfTst(tst))
+			{
+				printf("surf_plot_masked32 plotted at (%i, %i).\n",
+					   xs[xIndex], ys[yIndex]);
+				passed = FALSE;
+			}
+		}
+	}
+
+	return passed;
+}
+
+/**
+ * @brief Decodes the run-length encoded bitmap in every mode at the given
+ * position, and checks each result.
+ *
+ * @param tst The surface to plot on.
+ * @param x The left-most column to plot the bitmap at.
+ * @param y The top-most row to plot the bitmap at.
+ * @return TRUE if every result was as expected; FALSE otherwise.
+ */
+BOOL tstSurfRle(const SurfTst* const tst, int x, int y)
+{
+	UINT32 rows[RLE_TST_HEIGHT];
+
+	RastMode mode;
+
+	int  col;
+	int  row;
+	BOOL passed = TRUE;
+
+	for (mode = RAST_OR; mode < NUM_RAST_MODES; mode++)
+	{
+		startSurfTst(tst);
+		surf_plot_rle(&tst->surf, x, y, RLE_TST_COLUMNS * RLE_COLUMN_LEN,
+					  RLE_TST_HEIGHT, rleTstBitmap, mode);
+
+		for (col = 0; col < RLE_TST_COLUMNS; col++)
+		{
+			for (row = 0; row < RLE_TST_HEIGHT; row++)
+			{
+				rows[row] = (UINT32)rleTstColumns[col][row] << 16;
+			}
+
+			refPlot(&tst->ref, x + col * RLE_COLUMN_LEN, y, RLE_COLUMN_LEN,
+					RLE_TST_HEIGHT, rows, mode);
+		}
+
+		if (!chkSurfTst(tst))
+		{
+			printf("surf_plot_rle plotted at (%i, %i) with %s.\n", x, y,
+				   rastModeNames[mode]);
+			passed = FALSE;
+		}
+	}
+
+	return passed;
+}
+
+/**
+ * @brief Sets up the copy of a surface that the expected results are plotted
+ * on.
+ * @details The surface itself must already be set up.
+ *
+ * @param tst The surface under test.
+ * @param mem The memory that holds the surface.
+ * @param refMem The memory to hold the copy, which must be as large as mem.
+ * @param numLongs The number of longs of memory that mem holds.
+ */
+void initSurfTst(SurfTst* const tst, UINT32* const mem, UINT32* const refMem,
+				 long numLongs)
+{
+	tst->mem = mem;
+	tst->refMem = refMem;
+	tst->numLongs = numLongs;
+
+	tst->ref = tst->surf;
+	tst->ref.base = refMem + (tst->surf.base - mem);
+}
+
+/**
+ * @brief Sets the clip rectangle of the copy of a surface that the expected
+ * results are plotted on.
+ * @details This is used in place of the clip rectangle that clip_surface()
+ * worked out for the surface under test, so that a wrong one is caught.
+ *
+ * @param tst The surface under test.
+ * @param left The left-most column of the rectangle.
+ * @param top The top-most row of the rectangle.
+ * @param right The right-most column of the rectangle.
+ * @param bottom The bottom-most row of the rectangle.
+ */
+void clipRefSurf(SurfTst* const tst, int left, int top, int right,
+				 int bottom)
+{
+	tst->ref.clip.left = left;
+	tst->ref.clip.top = top;
+	tst->ref.clip.right = right;
+	tst->ref.clip.bottom = bottom;
+
+	tst->ref.guard = tst->ref.clip;
+}
+
+/**
+ * @brief Covers the memory of a surface with a pattern that differs on every
+ * long, and copies it to the memory that the expected results are plotted on.
+ *
+ * @param tst The surface under test.
+ */
+void startSurfTst(const SurfTst* const tst)
+{
+	long index;
+
+	for (index = 0; index < tst->numLongs; index++)
+	{
+		tst->mem[index] = 0x5A0FF0A5UL ^ ((UINT32)index * 0x01030507UL);
+	}
+
+	memcpy(tst->refMem, tst->mem, tst->numLongs * sizeof(UINT32));
+}
+
+/**
+ * @brief Checks that the memory of a surface holds the same bytes as the
+ * memory the expected results were plotted on.
+ * @details The first byte that differs is reported.
+ *
+ * @param tst The surface under test.
+ * @return TRUE if the memory is the same; FALSE otherwise.
+ */
+BOOL chkSurfTst(const SurfTst* const tst)
+{
+	const UINT8* const actual   = (const UINT8 *)tst->mem;
+	const UINT8* const expected = (const UINT8 *)tst->refMem;
+	const long         NUM_BYTES = tst->numLongs * sizeof(UINT32);
+
+	long index;
+
+	for (index = 0; index < NUM_BYTES && actual[index] == expected[index];
+		 index++);
+
+	if (index < NUM_BYTES)
+	{
+		printf("Byte %li of the surface memory was %02X instead of %02X.\n",
+			   index, actual[index], expected[index]);
+	}
+
+	return index == NUM_BYTES;
+}
+
+/**
+ * @brief Determines if a pixel of a surface is set.
+ * @details The pixel may lie anywhere in the memory of the surface, including
+ * on its guard band.
+ *
+ * @param ref The surface to read from.
+ * @param x The column of the pixel (in pixels starting at zero).
+ * @param y The row of the pixel (in pixels starting at zero).
+ * @return TRUE if the pixel is set; FALSE otherwise.
+ */
+BOOL refPixelSet(const Surface* const ref, int x, int y)
+{
+	const UINT8* const bytes = (const UINT8 *)surfaceRow(ref, y);
+
+	return (bytes[(x - (x & 7)) / 8] & (0x80 >> (x & 7))) != 0;
+}
+
+/**
+ * @brief Sets or clears a pixel of a surface.
+ * @details The pixel may lie anywhere in the memory of the surface, including
+ * on its guard band.
+ *
+ * @param ref The surface to plot on.
+ * @param x The column of the pixel (in pixels starting at zero).
+ * @param y The row of the pixel (in pixels starting at zero).
+ * @param set When true, the pixel is set. Otherwise, it is cleared.
+ */
+void refPutPixel(const Surface* const ref, int x, int y, BOOL set)
+{
+	UINT8* const bytes = (UINT8 *)surfaceRow(ref, y);
+	const UINT8  bit   = 0x80 >> (x & 7);
+
+	if (set)
+	{
+		bytes[(x - (x & 7)) / 8] |= bit;
+	}
+	else
+	{
+		bytes[(x - (x & 7)) / 8] &= ~bit;
+	}
+}
+
+/**
+ * @brief Plots a bitmap on a surface a pixel at a time.
+ * @details The bitmap is not clipped if it lies inside the guard rectangle of
+ * the surface. Otherwise, it is cropped to the clip rectangle.
+ *
+ * @param ref The surface to plot on.
+ * @param x The left-most column to plot the bitmap at.
+ * @param y The top-most row to plot the bitmap at.
+ * @param width The width of the bitmap (32 or less).
+ * @param height The height of the bitmap.
+ * @param rows The rows of the bitmap with their left-most pixel in the highest
+ * bit.
+ * @param mode The way in which the bitmap is to be combined with the surface.
+ */
+void refPlot(const Surface* const ref, int x, int y, int width, int height,
+			 const UINT32 rows[], RastMode mode)
+{
+	const ClipRect* const limit = (inGuardBand(ref, x, y, width, height) ?
+								   &ref->guard : &ref->clip);
+
+	BOOL bit;
+	BOOL set;
+
+	int row;
+	int col;
+
+	for (row = 0; row < height; row++)
+	{
+		for (col = 0; col < width; col++)
+		{
+			if (inClipRect(limit, x + col, y + row))
+			{
+				bit = (rows[row] >> (31 - col)) & 1;
+				set = refPixelSet(ref, x + col, y + row);
+
+				switch(mode)
+				{
+					case RAST_OR:
+						set |= bit;
+						break;
+					case RAST_XOR:
+						set ^= bit;
+						break;
+					case RAST_COPY:
+						set = bit;
+						break;
+					case RAST_COPY_INV:
+						set = !bit;
+						break;
+				}
+
+				refPutPixel(ref, x + col, y + row, set);
+			}
+		}
+	}
+}
+
+/**
+ * @brief Plots a masked bitmap on a surface a pixel at a time.
+ * @details Every pixel in the mask is cleared before every pixel in the image
+ * is set. The bitmap is clipped the same way as in refPlot().
+ *
+ * @param ref The surface to plot on.
+ * @param x The left-most column to plot the bitmap at.
+ * @param y The top-most row to plot the bitmap at.
+ * @param height The height of the bitmap.
+ * @param masked The masked bitmap, holding MASKED_ROW_LONGS longs per row.
+ */
+void refMasked(const Surface* const ref, int x, int y, int height,
+			   const UINT32* const masked)
+{
+	const ClipRect* const limit = (inGuardBand(ref, x, y, 32, height) ?
+								   &ref->guard : &ref->clip);
+
+	UINT32 mask;
+	UINT32 image;
+
+	int row;
+	int col;
+
+	for (row = 0; row < height; row++)
+	{
+		mask = masked[row * MASKED_ROW_LONGS];
+		image = masked[row * MASKED_ROW_LONGS + 1];
+
+		for (col = 0; col < 32; col++)
+		{
+			if (inClipRect(limit, x + col, y + row))
+			{
+				if ((mask >> (31 - col)) & 1)
+				{
+					refPutPixel(ref, x + col, y + row, FALSE);
+				}
+
+				if ((image >> (31 - col)) & 1)
+				{
+					refPutPixel(ref, x + col, y + row, TRUE);
+				}
+			}
+		}
+	}
+}
+
+/**
+ * @brief Sets or clears every pixel of a rectangular area of a surface that
+ * lies inside its clip rectangle, a pixel at a time.
+ *
+ * @param ref The surface to plot on.
+ * @param x1 The left-most column of the area.
+ * @param x2 The right-most column of the area.
+ * @param y1 The top-most row of the area.
+ * @param y2 The bottom-most row of the area.
+ * @param set When true, the area is set. Otherwise, it is cleared.
+ */
+void refFill(const Surface* const ref, int x1, int x2, int y1, int y2,
+			 BOOL set)
+{
+	int x;
+	int y;
+
+	for (y = y1; y <= y2; y++)
+	{
+		for (x = x1; x <= x2; x++)
+		{
+			if (inClipRect(&ref->clip, x, y))
+			{
+				refPutPixel(ref, x, y, set);
+			}
+		}
+	}
+}
+
+/**
+ * @brief Fills in the bitmaps that are plotted by the tests.
+ * @details Every row differs from those around it, and the left-most and
+ * right-most pixels are set on most rows, so that a bitmap plotted a row or a
+ * pixel out of place is caught.
+ */
+void initSurfTstBitmaps(void)
+{
+	int row;
+
+	for (row = 0; row < SURF_TST_HEIGHT; row++)
+	{
+		surfTstBitmap32[row] = 0x8001F00FUL ^
+							   ((UINT32)(row + 1) * 0x01020409UL);
+		surfTstBitmap16[row] = (UINT16)(surfTstBitmap32[row] >> 8);
+		surfTstBitmap8[row] = (UINT8)(surfTstBitmap32[row] >> 12);
+
+		surfTstMasked[row * MASKED_ROW_LONGS] = 0x0FF0F00FUL ^
+			((UINT32)(row + 1) * 0x00810204UL);
+		surfTstMasked[row * MASKED_ROW_LONGS + 1] = 0x3C3C00FFUL ^
+			((UINT32)(row + 3) * 0x02040801UL);
+	}
+}
+
+/**
+ * @brief Fills in the columns of the run-length encoded bitmap and encodes
+ * them.
+ * @details The columns hold runs of blank and filled rows as well as rows that
+ * differ from each other, so that every kind of packet is decoded. Two or more
+ * rows in a row that are the same are encoded as a run.
+ */
+void initRleTstBitmap(void)
+{
+	UINT16* rle = rleTstBitmap;
+	UINT16* header;
+
+	int col;
+	int row;
+	int count;
+
+	for (row = 0; row < RLE_TST_HEIGHT; row++)
+	{
+		rleTstColumns[0][row] = (row < 10 || row >= 30 ? 0 :
+								 row < 20 ? 0xF00F :
+								 (UINT16)(0x1234 ^ row * 0x0101));
+		rleTstColumns[1][row] = (UINT16)(0x8001 ^ row * 0x0203);
+		rleTstColumns[2][row] = (row < 5 ? 0xFFFF : row < 20 ? 0 :
+								 row % 4 < 2 ? 0xAAAA : 0x5555);
+	}
+
+	for (col = 0; col < RLE_TST_COLUMNS; col++)
+	{
+		for (row = 0; row < RLE_TST_HEIGHT;)
+		{
+			header = rle++;
+
+			for (count = 1; row + count < RLE_TST_HEIGHT &&
+				 rleTstColumns[col][row + count] == rleTstColumns[col][row];
+				 count++);
+
+			if (count > 1)
+			{
+				*header = RLE_RUN | count;
+				*rle++ = rleTstColumns[col][row];
+				row += count;
+			}
+			else
+			{
+				for (count = 0; row < RLE_TST_HEIGHT &&
+					 (row + 1 == RLE_TST_HEIGHT ||
+					  rleTstColumns[col][row + 1] != rleTstColumns[col][row]);
+					 count++, row++)
+				{
+					*rle++ = rleTstColumns[col][row];
+				}
+
+				*header = count;
+			}
+		}
+	}
+}
\ No newline at end of file
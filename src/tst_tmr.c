@@ -0,0 +1,377 @@
+/**
+ * @file tst_tmr.c
+ * @author Academia Team
+ * @brief Contains functions aimed at testing the timer wheel.
+ * @details The wheel is moved on by hand rather than by the VBL clock, so
+ * every test runs in an instant and gives the same results every time.
+ *
+ * @copyright Copyright Academia Team 2023
+ */
+
+#include <stdio.h>
+
+#include "arg_list.h"
+#include "bool.h"
+#include "input.h"
+#include "test.h"
+#include "timer.h"
+#include "tst_hndl.h"
+#include "types.h"
+#include "vector.h"
+
+/**
+ * @brief The most times a test records a timer expiring.
+ */
+#define MAX_FIRES 64
+
+/**
+ * @brief The wheel that every test runs its timers on.
+ */
+TimerWheel tstWheel;
+
+/**
+ * @brief The ticks that the timer under test has expired on, in order.
+ */
+UINT32 fireTicks[MAX_FIRES];
+int    numFires;
+
+void timerTstMgr(void (*tstFunc)(ArgList *args));
+
+void t1Timer(ArgList *args);
+void t2Timer(ArgList *args);
+void t3Timer(ArgList *args);
+void t4Timer(ArgList *args);
+void t5Timer(ArgList *args);
+
+BOOL chkOneShot(UINT32 start, UINT32 delay, BOOL stepwise, FILE *stream);
+void runWheel(UINT32 end, BOOL stepwise);
+void recordFire(void);
+void outResult(BOOL passed, FILE *stream);
+
+int main(int argc, char **argv)
+{
+	TestSuiteID suiteID;
+
+	suiteID = registerTestSuite("Tests the timer wheel.", timerTstMgr);
+
+	registerTestCase(suiteID,
+					 "Checks that a timer expires on exactly the tick it was started for, and only once.",
+					 NULL, t1Timer);
+
+	registerTestCase(suiteID,
+					 "Checks that timers expire on time when they have to move down from the 32 and 32x32 tick levels.",
+					 NULL, t2Timer);
+
+	registerTestCase(suiteID,
+					 "Checks that timers expire on time when the wheel is moved on many ticks at once.",
+					 NULL, t3Timer);
+
+	registerTestCase(suiteID,
+					 "Checks that a periodic timer is started again every time it expires.",
+					 NULL, t4Timer);
+
+	registerTestCase(suiteID,
+					 "Checks that a timer which is stopped never expires, whichever level of the wheel it is held in.",
+					 NULL, t5Timer);
+
+	handleTests();
+
+	return 0;
+}
+
+/**
+ * @brief Sets up an environment for testing the timer wheel.
+ * @details It ensures that a test doesn't end until a key is pressed.
+ *
+ * @param tstFunc The function to test the timer wheel.
+ */
+void timerTstMgr(void (*tstFunc)(ArgList *args))
+{
+	ArgList args;
+	Vector origKybd = initKybd();
+	IKBD_Scancode scancode;
+
+	initArgList(&args);
+
+	tstFunc(&args);
+
+	while ((scancode = getKey()) == NO_KEY);
+
+	restoreKybd(origKybd);
+}
+
+/**
+ * @brief Checks if a timer expires on exactly the tick it was started for, and
+ * only once, for delays within the lowest level of the wheel.
+ *
+ * @param args Holds a list of arguments. (Unused)
+ */
+void t1Timer(ArgList *args)
+{
+	const UINT32 delays[] = {1, 2, 5, 17, 30, 31};
+	const int    NUM_DELAYS = sizeof(delays) / sizeof(delays[0]);
+
+	int  index;
+	BOOL passed = TRUE;
+
+	for (index = 0; index < NUM_DELAYS; index++)
+	{
+		passed &= chkOneShot(0, delays[index], TRUE, stdout);
+		passed &= chkOneShot(1000, delays[index], TRUE, stdout);
+	}
+
+	/* A delay of zero is taken as one. */
+	passed &= chkOneShot(0, 0, TRUE, stdout);
+
+	outResult(passed, stdout);
+}
+
+/**
+ * @brief Checks if timers expire on time when their deadlines lie on either
+ * side of the start of a slot in the 32 and 32x32 tick levels, so that they
+ * have to be moved down one or two levels first.
+ *
+ * @param args Holds a list of arguments. (Unused)
+ */
+void t2Timer(ArgList *args)
+{
+	const UINT32 starts[] = {0, 1, 31, 32, 1000, 1023, 1024, 32767};
+	const UINT32 delays[] = {31, 32, 33, 63, 64, 65, 1023, 1024, 1025, 2047,
+							 2048, 2049};
+	const int    NUM_STARTS = sizeof(starts) / sizeof(starts[0]);
+	const int    NUM_DELAYS = sizeof(delays) / sizeof(delays[0]);
+
+	int  start;
+	int  delay;
+	BOOL passed = TRUE;
+
+	for (start = 0; start < NUM_STARTS; start++)
+	{
+		for (delay = 0; delay < NUM_DELAYS; delay++)
+		{
+			passed &= chkOneShot(starts[start], delays[delay], TRUE, stdout);
+		}
+	}
+
+	outResult(passed, stdout);
+}
+
+/**
+ * @brief Checks if timers expire on time when the wheel is moved on many ticks
+ * at once, as it is after the game has been held up.
+ *
+ * @param args Holds a list of arguments. (Unused)
+ */
+void t3Timer(ArgList *args)
+{
+	const UINT32 delays[] = {1, 31, 32, 33, 1023, 1024, 1025, 20000};
+	const int    NUM_DELAYS = sizeof(delays) / sizeof(delays[0]);
+
+	int  index;
+	BOOL passed = TRUE;
+
+	for (index = 0; index < NUM_DELAYS; index++)
+	{
+		passed &= chkOneShot(0, delays[index], FALSE, stdout);
+		passed &= chkOneShot(1000, delays[index], FALSE, stdout);
+	}
+
+	outResult(passed, stdout);
+}
+
+/**
+ * @brief Checks if a periodic timer is started again every time it expires,
+ * including when its period is longer than a slot of the lowest level.
+ *
+ * @param args Holds a list of arguments. (Unused)
+ */
+void t4Timer(ArgList *args)
+{
+	const UINT32 periods[] = {1, 7, 32, 40, 1100};
+	const int    NUM_PERIODS = sizeof(periods) / sizeof(periods[0]);
+	const int    NUM_REPEATS = 20;
+	const UINT32 DELAY = 3;
+
+	Timer  timer;
+	UINT32 end;
+	int    index;
+	int    fire;
+	BOOL   passed = TRUE;
+
+	for (index = 0; index < NUM_PERIODS; index++)
+	{
+		end = DELAY + periods[index] * (NUM_REPEATS - 1);
+
+		init_timer_wheel(&tstWheel, 0);
+		init_timer(&timer, recordFire);
+		numFires = 0;
+
+		start_timer(&tstWheel, &timer, DELAY, periods[index]);
+		runWheel(end, TRUE);
+
+		if (numFires != NUM_REPEATS || !timer_pending(&timer))
+		{
+			printf("A timer with a period of %lu expired %i times.\n",
+				   periods[index], numFires);
+			passed = FALSE;
+		}
+
+		for (fire = 0; fire < numFires; fire++)
+		{
+			if (fireTicks[fire] != DELAY + periods[index] * fire)
+			{
+				printf("A timer with a period of %lu expired on tick %lu.\n",
+					   periods[index], fireTicks[fire]);
+				passed = FALSE;
+			}
+		}
+
+		stop_timer(&timer);
+	}
+
+	outResult(passed, stdout);
+}
+
+/**
+ * @brief Checks if a timer that is stopped half way to its deadline never
+ * expires, whether it is held in the lowest level of the wheel or in one of
+ * the levels above it.
+ *
+ * @param args Holds a list of arguments. (Unused)
+ */
+void t5Timer(ArgList *args)
+{
+	const UINT32 delays[] = {1, 5, 31, 32, 100, 1024, 5000};
+	const int    NUM_DELAYS = sizeof(delays) / sizeof(delays[0]);
+
+	Timer oneShot;
+	Timer periodic;
+	int   index;
+	BOOL  passed = TRUE;
+
+	for (index = 0; index < NUM_DELAYS; index++)
+	{
+		init_timer_wheel(&tstWheel, 0);
+		init_timer(&oneShot, recordFire);
+		init_timer(&periodic, recordFire);
+		numFires = 0;
+
+		start_timer(&tstWheel, &oneShot, delays[index], 0);
+		start_timer(&tstWheel, &periodic, delays[index], delays[index]);
+
+		/* Half way to the deadline, the timers may have moved down a level. */
+		runWheel(delays[index] / 2, TRUE);
+		stop_timer(&oneShot);
+		stop_timer(&periodic);
+
+		/* Stopping a timer twice must do no harm. */
+		stop_timer(&oneShot);
+
+		runWheel(delays[index] * 3, TRUE);
+
+		if (numFires != 0 || timer_pending(&oneShot) ||
+			timer_pending(&periodic))
+		{
+			printf("A timer stopped with a delay of %lu expired %i times.\n",
+				   delays[index], numFires);
+			passed = FALSE;
+		}
+	}
+
+	outResult(passed, stdout);
+}
+
+/**
+ * @brief Runs a timer that expires once and checks that it expires on exactly
+ * the tick it was started for.
+ *
+ * @param start The tick to start the wheel at.
+ * @param delay The delay to start the timer with.
+ * @param stepwise When TRUE, the wheel is moved on a tick at a time; otherwise
+ * it is moved straight on to well past the deadline.
+ * @param stream The stream to write the details of a failure to.
+ * @return TRUE if the timer expired once, on the right tick; FALSE otherwise.
+ */
+BOOL chkOneShot(UINT32 start, UINT32 delay, BOOL stepwise, FILE *stream)
+{
+	const UINT32 EXTRA_TICKS = 40;
+
+	Timer  timer;
+	UINT32 deadline = start + (delay == 0 ? 1 : delay);
+	BOOL   passed;
+
+	init_timer_wheel(&tstWheel, start);
+	init_timer(&timer, recordFire);
+	numFires = 0;
+
+	start_timer(&tstWheel, &timer, delay, 0);
+	runWheel(deadline + EXTRA_TICKS, stepwise);
+
+	passed = (numFires == 1 && fireTicks[0] == deadline &&
+			  !timer_pending(&timer));
+
+	if (!passed)
+	{
+		fprintf(stream, "A timer started on tick %lu with a delay of %lu ",
+				start, delay);
+
+		if (numFires == 1)
+		{
+			fprintf(stream, "expired on tick %lu.\n", fireTicks[0]);
+		}
+		else
+		{
+			fprintf(stream, "expired %i times.\n", numFires);
+		}
+	}
+
+	return passed;
+}
+
+/**
+ * @brief Moves the wheel used by the tests on to the given tick.
+ *
+ * @param end The tick to move the wheel on to.
+ * @param stepwise When TRUE, the wheel is moved on a tick at a time; otherwise
+ * it is moved on in one go.
+ */
+void runWheel(UINT32 end, BOOL stepwise)
+{
+	if (stepwise)
+	{
+		while (tstWheel.now < end)
+		{
+			advance_timers(&tstWheel, tstWheel.now + 1);
+		}
+	}
+	else
+	{
+		advance_timers(&tstWheel, end);
+	}
+}
+
+/**
+ * @brief Records the tick that the wheel used by the tests is on when a timer
+ * expires.
+ */
+void recordFire(void)
+{
+	if (numFires < MAX_FIRES)
+	{
+		fireTicks[numFires] = tstWheel.now;
+	}
+
+	numFires++;
+}
+
+/**
+ * @brief Outputs whether a test has succeeded or failed.
+ *
+ * @param passed Whether the test has succeeded.
+ * @param stream The stream to write the result to.
+ */
+void outResult(BOOL passed, FILE *stream)
+{
+	fputs(passed ? "The test has succeeded.\n" : "The test has failed.\n",
+		  stream);
+}
\ No newline at end of file
@@ -10,6 +10,8 @@
 #ifndef TYPES_H
 #define TYPES_H
 
+#include "cpu.h"
+
 /**
  * @brief The value that needs to be used during a right bitshift to get the
  * equivalent of a division by 8.
@@ -100,7 +102,13 @@ typedef signed short SINT16;
 
 #define UINT32_BYTES 4
 
+/* An int is only 16 bits wide on the Atari ST, while a long is 64 bits wide on
+most hosts. */
+#ifdef M68K_CPU
 typedef unsigned long UINT32;
+#else
+typedef unsigned int UINT32;
+#endif
 
 
 #ifndef SINT32_MAX
@@ -115,6 +123,18 @@ typedef unsigned long UINT32;
 
 #define SINT32_BYTES 4
 
+#ifdef M68K_CPU
 typedef signed long SINT32;
+#else
+typedef signed int SINT32;
+#endif
+
+
+/**
+ * @brief An unsigned type wide enough to hold an address, for when its
+ * alignment needs to be worked out.
+ * @details A long is as wide as a pointer on both the Atari ST and LP64 hosts.
+ */
+typedef unsigned long UINTPTR;
 
 #endif
@@ -6,8 +6,11 @@
  * @copyright Copyright 2023 Academia Team
  */
 
+#include <stddef.h>
+
 #include "bool.h"
 #include "ints.h"
+#include "raster.h"
 #include "types.h"
 #include "vbl.h"
 #include "vector.h"
@@ -22,6 +25,12 @@ UINT16 rendReq   =  FALSE;
 void (*registeredFuncs[MAX_REGISTERED_VBL_FUNCS])(void);
 int fillLevel = 0;
 
+/**
+ * @brief The frame buffer to be shown at the next vertical blank, or NULL if
+ * there is none waiting to be shown.
+ */
+UINT16* queuedBase = NULL;
+
 void reset_rend_req(void);
 
 UINT32 get_time(void)
@@ -72,6 +81,12 @@ void vbl_main(void)
 
 	vertTimer++;
 
+	if (queuedBase != NULL)
+	{
+		set_video_base(queuedBase);
+		queuedBase = NULL;
+	}
+
 	for (index = 0; index < fillLevel; index++)
 	{
 		registeredFuncs[index]();
@@ -80,6 +95,27 @@ void vbl_main(void)
 	rendReq = TRUE;
 }
 
+void queue_flip(UINT16* const base)
+{
+	int    oldIpl;
+
+	oldIpl = set_ipl(MASK_ALL_INTERRUPTS);
+	queuedBase = base;
+	set_ipl(oldIpl);
+}
+
+UINT16* get_queued_base(void)
+{
+	UINT16* base;
+	int     oldIpl;
+
+	oldIpl = set_ipl(MASK_ALL_INTERRUPTS);
+	base = queuedBase;
+	set_ipl(oldIpl);
+
+	return base;
+}
+
 BOOL vbl_register(void (*func)(void))
 {
 	BOOL success = FALSE;
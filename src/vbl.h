@@ -51,6 +51,24 @@ Vector vbl_init(void);
  */
 void vbl_isr(void);
 
+/**
+ * @brief Queues a frame buffer to be shown at the next vertical blank.
+ * @details Only the newest frame buffer queued is kept, so if a frame buffer is
+ * still waiting to be shown when another one is queued, it is never shown.
+ * Queuing NULL removes any frame buffer that is waiting to be shown.
+ * 
+ * @param base The location in memory of the frame buffer to show.
+ */
+void queue_flip(UINT16* const base);
+
+/**
+ * @brief Returns the frame buffer waiting to be shown at the next vertical
+ * blank.
+ * 
+ * @return The location in memory of the frame buffer; NULL if there is none.
+ */
+UINT16* get_queued_base(void);
+
 /**
  * @brief Register a function to be run while the VBL ISR runs.
  * @details The functions will be run in the order that they are defined.